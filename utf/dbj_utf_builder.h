@@ -0,0 +1,259 @@
+#pragma once
+#ifndef DBJ_UTF_BUILDER_INC
+#define DBJ_UTF_BUILDER_INC
+
+#include <stdarg.h>
+#include <stdio.h>
+#include "dbj_utf_cpp.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+utf8 string builder, one growing buffer, amortized O(1) appends.
+
+    dbj::utf::utf8_builder out;
+    out.reserve(4096);
+    out.append("{\"name\":\"").append(name16, name16_units).append("\",\"id\":")
+       .append_int(id).append(',').append_format("\"load\":%.2f}", load);
+
+    dbj::utf::utf8_string response = out.finish(); // buffer is handed over, no copy
+
+utf16 and utf32 pieces are transcoded straight into the buffer, with the
+dbj::utf converters. utf8 pieces are copied as they are.
+
+Buffer grows by doubling, from the utf_allocator given (heap by default).
+It is always zero terminated.
+
+utf16/utf32 input the (lenient) converters reject is appended up to the
+point of failure; the first failure is kept in status().
+*/
+
+namespace dbj::utf {
+
+    class utf8_builder final {
+        utf8_builder(const utf8_builder&) = delete;
+        utf8_builder& operator=(const utf8_builder&) = delete;
+
+    public:
+        enum : size_t { min_capacity = 64 };
+
+        explicit utf8_builder(const utf_allocator* allocator = heap_allocator()) noexcept
+            : allocator_(allocator)
+        {
+        }
+
+        explicit utf8_builder(size_t reserve_bytes, const utf_allocator* allocator = heap_allocator())
+            : allocator_(allocator)
+        {
+            reserve(reserve_bytes);
+        }
+
+        utf8_builder(utf8_builder&& that) noexcept
+            : data_(that.data_), size_(that.size_), capacity_(that.capacity_),
+            allocator_(that.allocator_), status_(that.status_)
+        {
+            that.data_ = nullptr;
+            that.size_ = that.capacity_ = 0;
+            that.status_ = conversionOK;
+        }
+
+        ~utf8_builder() { allocator_->deallocate(data_, capacity_); }
+
+        // bytes appended so far
+        size_t size() const noexcept { return size_; }
+        // bytes that fit without growing, terminator not included
+        size_t capacity() const noexcept { return capacity_ ? capacity_ - 1 : 0; }
+        // zero terminated
+        const char* c_str() const noexcept { return data_ ? data_ : ""; }
+
+        conversion_result status() const noexcept { return status_; }
+
+        // room for bytes more, at least
+        void reserve(size_t bytes)
+        {
+            if (size_ + bytes + 1 > capacity_)
+                grow(size_ + bytes + 1);
+        }
+
+        void clear() noexcept
+        {
+            size_ = 0;
+            status_ = conversionOK;
+            if (data_)
+                data_[0] = 0;
+        }
+
+        utf8_builder& append(const char* src, size_t bytes)
+        {
+            reserve(bytes);
+            memcpy(data_ + size_, src, bytes);
+            size_ += bytes;
+            data_[size_] = 0;
+            return *this;
+        }
+
+        utf8_builder& append(const char* src) { return append(src, strlen(src)); }
+
+        utf8_builder& append(const char16_t* src, size_t units) { return append(src, units, encoding::utf16); }
+        utf8_builder& append(const char32_t* src, size_t units) { return append(src, units, encoding::utf32); }
+
+        utf8_builder& append(const utf8_string& src) { return append(src.get(), src.bytes()); }
+        utf8_builder& append(const utf16_string& src) {
+            return append(reinterpret_cast<const char16_t*>(src.get()), src.units());
+        }
+        utf8_builder& append(const utf32_string& src) { return append(src.get(), src.length()); }
+
+        // ASCII char
+        utf8_builder& append(char c)
+        {
+            reserve(1);
+            data_[size_++] = c;
+            data_[size_] = 0;
+            return *this;
+        }
+
+        // one code point, illegal ones are appended as U+FFFD
+        utf8_builder& append(char32_t cp)
+        {
+            reserve(4);
+            unsigned char* target = reinterpret_cast<unsigned char*>(data_ + size_);
+
+            if (cp > LINENOISE_UNI_MAX_LEGAL_UTF32 || (cp >= LINENOISE_UNI_SUR_HIGH_START && cp <= LINENOISE_UNI_SUR_LOW_END))
+                cp = LINENOISE_UNI_REPLACEMENT_CHAR;
+
+            if (cp < 0x80) {
+                target[0] = (unsigned char)cp;
+                size_ += 1;
+            }
+            else if (cp < 0x800) {
+                target[0] = (unsigned char)(0xC0 | (cp >> 6));
+                target[1] = (unsigned char)(0x80 | (cp & 0x3F));
+                size_ += 2;
+            }
+            else if (cp < 0x10000) {
+                target[0] = (unsigned char)(0xE0 | (cp >> 12));
+                target[1] = (unsigned char)(0x80 | ((cp >> 6) & 0x3F));
+                target[2] = (unsigned char)(0x80 | (cp & 0x3F));
+                size_ += 3;
+            }
+            else {
+                target[0] = (unsigned char)(0xF0 | (cp >> 18));
+                target[1] = (unsigned char)(0x80 | ((cp >> 12) & 0x3F));
+                target[2] = (unsigned char)(0x80 | ((cp >> 6) & 0x3F));
+                target[3] = (unsigned char)(0x80 | (cp & 0x3F));
+                size_ += 4;
+            }
+            data_[size_] = 0;
+            return *this;
+        }
+
+        utf8_builder& append_uint(unsigned long long value)
+        {
+            char digits[20];
+            unsigned count = 0;
+            do {
+                digits[count++] = char('0' + value % 10);
+                value /= 10;
+            } while (value);
+
+            reserve(count);
+            while (count)
+                data_[size_++] = digits[--count];
+            data_[size_] = 0;
+            return *this;
+        }
+
+        utf8_builder& append_int(long long value)
+        {
+            if (value < 0) {
+                append('-');
+                // no overflow for the smallest value
+                return append_uint(0ull - (unsigned long long)value);
+            }
+            return append_uint((unsigned long long)value);
+        }
+
+        // as printf %.*g
+        utf8_builder& append_double(double value, int precision = 17)
+        {
+            return append_format("%.*g", precision, value);
+        }
+
+        // printf style, formatted straight into the buffer
+        utf8_builder& append_format(const char* format, ...)
+        {
+            va_list args;
+            va_start(args, format);
+            va_list again;
+            va_copy(again, args);
+
+            reserve(min_capacity);
+            int needed = vsnprintf(data_ + size_, capacity_ - size_, format, args);
+            if (needed > 0 && size_t(needed) >= capacity_ - size_) {
+                reserve(size_t(needed));
+                needed = vsnprintf(data_ + size_, capacity_ - size_, format, again);
+            }
+            if (needed > 0)
+                size_ += size_t(needed);
+            data_[size_] = 0;
+
+            va_end(again);
+            va_end(args);
+            return *this;
+        }
+
+        /*
+        hand the buffer over to the utf8_string, no copy
+        builder is left empty and can be reused
+        */
+        utf8_string finish()
+        {
+            if (!data_)
+                return utf8_string("", 0, allocator_);
+
+            utf8_string result(data_, capacity_, size_, allocator_);
+            data_ = nullptr;
+            size_ = capacity_ = 0;
+            status_ = conversionOK;
+            return result;
+        }
+
+    private:
+        utf8_builder& append(const void* src, size_t units, encoding from)
+        {
+            reserve(transcoded_length(src, units, from, encoding::utf8));
+            size_t written = 0;
+            const conversion_result result = transcode(src, units, from, data_ + size_, capacity_ - size_, encoding::utf8, written);
+            if (result != conversionOK && status_ == conversionOK)
+                status_ = result;
+            size_ += written;
+            data_[size_] = 0;
+            return *this;
+        }
+
+        // at least needed bytes, terminator included
+        void grow(size_t needed)
+        {
+            size_t capacity = capacity_ > min_capacity ? capacity_ : size_t(min_capacity);
+            while (capacity < needed)
+                capacity *= 2;
+
+            char* block = static_cast<char*>(allocator_->allocate_or_throw(capacity));
+            if (data_)
+                memcpy(block, data_, size_ + 1);
+            else
+                block[0] = 0;
+            allocator_->deallocate(data_, capacity_);
+            data_ = block;
+            capacity_ = capacity;
+        }
+
+        char* data_{};
+        size_t size_{};
+        size_t capacity_{}; // of the block, terminator included
+        const utf_allocator* allocator_;
+        conversion_result status_{ conversionOK };
+    };
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_BUILDER_INC
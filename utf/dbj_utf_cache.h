@@ -0,0 +1,328 @@
+#pragma once
+#ifndef DBJ_UTF_CACHE_INC
+#define DBJ_UTF_CACHE_INC
+
+#include <stdlib.h>
+#include <new>
+#include <atomic>
+#include <mutex>
+#include "dbj_utf_utils.h"
+#include "dbj_utf_hash.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Optional memoizing cache in front of the dbj::utf converters.
+
+Header names, enum labels, tenant names ... are converted again and again.
+Cache them:
+
+    dbj::utf::conversion_cache cache(4096);
+
+    dbj::utf::shared_text t = cache.convert(name, name_len, encoding::utf8, encoding::utf16);
+    if (t) use(t.utf16(), t.size());
+
+Key is (source bytes, source encoding, target encoding). Result is immutable
+and reference counted, it stays valid after it is evicted from the cache.
+
+Cache is set associative, 8 ways per set, CLOCK (second chance) eviction
+inside the set. Sets are guarded by the sharded locks. Conversion itself
+is done outside of any lock.
+
+Illegal input is not cached, convert() returns the empty shared_text.
+*/
+
+namespace dbj::utf {
+
+    namespace detail {
+
+        /*
+        one allocation per entry
+        header | key bytes padded to 8 | result units + terminator
+        */
+        struct alignas(8) text_block final {
+            std::atomic<long> refs;
+            uint64_t hash;
+            size_t size;     // result code units, no terminator
+            size_t key_size; // source bytes
+            encoding from;
+            encoding to;
+
+            static size_t key_room(size_t key_size) noexcept { return (key_size + 7) & ~size_t(7); }
+
+            const unsigned char* key() const noexcept { return reinterpret_cast<const unsigned char*>(this + 1); }
+            const void* data() const noexcept { return key() + key_room(key_size); }
+
+            static void release(text_block* block) noexcept
+            {
+                if (block && block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    block->~text_block();
+                    free(block);
+                }
+            }
+
+            static text_block* acquire(text_block* block) noexcept
+            {
+                if (block)
+                    block->refs.fetch_add(1, std::memory_order_relaxed);
+                return block;
+            }
+
+            // nullptr on illegal source or no memory
+            static text_block* make(const void* src, size_t src_units, encoding from, encoding to, uint64_t hash) noexcept
+            {
+                const size_t key_size = src_units * code_unit_size(from);
+                const size_t length = transcoded_length(src, src_units, from, to);
+                const size_t bytes = sizeof(text_block) + key_room(key_size) + (length + 1) * code_unit_size(to);
+
+                void* memory = malloc(bytes);
+                if (!memory)
+                    return nullptr;
+
+                text_block* block = new (memory) text_block{};
+                block->refs.store(1, std::memory_order_relaxed);
+                block->hash = hash;
+                block->key_size = key_size;
+                block->from = from;
+                block->to = to;
+                memcpy(const_cast<unsigned char*>(block->key()), src, key_size);
+
+                size_t written = 0;
+                if (conversionOK != transcode(src, src_units, from,
+                    const_cast<void*>(block->data()), length + 1, to, written)) {
+                    release(block);
+                    return nullptr;
+                }
+                block->size = written;
+                return block;
+            }
+
+            bool matches(uint64_t hash_arg, const void* src, size_t bytes, encoding from_arg, encoding to_arg) const noexcept
+            {
+                return hash == hash_arg && key_size == bytes && from == from_arg && to == to_arg
+                    && 0 == memcmp(key(), src, bytes);
+            }
+        };
+    } // detail
+
+    /*
+    immutable result of the conversion, cheap to copy
+    */
+    class shared_text final {
+    public:
+        shared_text() noexcept = default;
+
+        explicit shared_text(detail::text_block* adopted) noexcept : block_(adopted) {}
+
+        shared_text(const shared_text& other) noexcept : block_(detail::text_block::acquire(other.block_)) {}
+
+        shared_text(shared_text&& other) noexcept : block_(other.block_) { other.block_ = nullptr; }
+
+        shared_text& operator=(const shared_text& other) noexcept {
+            if (this != &other) {
+                detail::text_block::release(block_);
+                block_ = detail::text_block::acquire(other.block_);
+            }
+            return *this;
+        }
+
+        shared_text& operator=(shared_text&& other) noexcept {
+            if (this != &other) {
+                detail::text_block::release(block_);
+                block_ = other.block_;
+                other.block_ = nullptr;
+            }
+            return *this;
+        }
+
+        ~shared_text() { detail::text_block::release(block_); }
+
+        explicit operator bool() const noexcept { return block_ != nullptr; }
+
+        // in code units of the target encoding
+        size_t size() const noexcept { return block_ ? block_->size : 0; }
+
+        encoding target() const noexcept { return block_ ? block_->to : encoding::utf8; }
+
+        // zero terminated, nullptr if empty or not in that encoding
+        const char* utf8() const noexcept {
+            return block_ && block_->to == encoding::utf8 ? static_cast<const char*>(block_->data()) : nullptr;
+        }
+        const char16_t* utf16() const noexcept {
+            return block_ && block_->to == encoding::utf16 ? static_cast<const char16_t*>(block_->data()) : nullptr;
+        }
+        const char32_t* utf32() const noexcept {
+            return block_ && block_->to == encoding::utf32 ? static_cast<const char32_t*>(block_->data()) : nullptr;
+        }
+
+    private:
+        detail::text_block* block_{};
+    };
+
+    class conversion_cache final {
+        conversion_cache(const conversion_cache&) = delete;
+        conversion_cache& operator=(const conversion_cache&) = delete;
+
+    public:
+        enum : unsigned { ways = 8, shards = 16 };
+
+        struct statistics final {
+            uint64_t hits;
+            uint64_t misses;
+            uint64_t evictions;
+        };
+
+        /*
+        capacity is in entries, rounded up to the power of 2 number of sets
+        0 capacity (or no memory) makes the cache a pass through
+        */
+        explicit conversion_cache(size_t capacity = 4096) noexcept
+        {
+            if (capacity == 0)
+                return;
+
+            size_t sets = 1;
+            while (sets * ways < capacity)
+                sets <<= 1;
+
+            sets_ = static_cast<set*>(calloc(sets, sizeof(set)));
+            if (sets_)
+                set_mask_ = sets - 1;
+        }
+
+        ~conversion_cache()
+        {
+            clear();
+            free(sets_);
+        }
+
+        /*
+        src_units is the number of code units in the source encoding
+        returns the empty shared_text on illegal source
+        */
+        shared_text convert(const void* src, size_t src_units, encoding from, encoding to) noexcept
+        {
+            const size_t bytes = src_units * code_unit_size(from);
+            const uint64_t hash = hash_bytes(src, bytes, (uint64_t(from) << 8) | uint64_t(to));
+
+            if (!sets_) {
+                misses_.fetch_add(1, std::memory_order_relaxed);
+                return shared_text(detail::text_block::make(src, src_units, from, to, hash));
+            }
+
+            const size_t set_index = size_t(hash) & set_mask_;
+            set& the_set = sets_[set_index];
+            std::mutex& lock = locks_[set_index % shards];
+
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                for (unsigned w = 0; w < ways; ++w) {
+                    detail::text_block* block = the_set.blocks[w];
+                    if (block && block->matches(hash, src, bytes, from, to)) {
+                        the_set.referenced |= uint8_t(1u << w);
+                        hits_.fetch_add(1, std::memory_order_relaxed);
+                        return shared_text(detail::text_block::acquire(block));
+                    }
+                }
+            }
+
+            misses_.fetch_add(1, std::memory_order_relaxed);
+
+            // outside of the lock
+            detail::text_block* made = detail::text_block::make(src, src_units, from, to, hash);
+            if (!made)
+                return shared_text{};
+
+            detail::text_block* evicted = nullptr;
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                // someone might have been faster
+                for (unsigned w = 0; w < ways; ++w) {
+                    detail::text_block* block = the_set.blocks[w];
+                    if (block && block->matches(hash, src, bytes, from, to)) {
+                        detail::text_block::acquire(block);
+                        evicted = made;
+                        made = block;
+                        break;
+                    }
+                }
+                if (!evicted) {
+                    const unsigned victim = the_set.clock_victim();
+                    evicted = the_set.blocks[victim];
+                    the_set.blocks[victim] = detail::text_block::acquire(made);
+                    the_set.referenced &= uint8_t(~(1u << victim));
+                    if (evicted)
+                        evictions_.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            // free outside of the lock
+            detail::text_block::release(evicted);
+            return shared_text(made);
+        }
+
+        shared_text to_utf8(const char16_t* src, size_t units) noexcept { return convert(src, units, encoding::utf16, encoding::utf8); }
+        shared_text to_utf8(const char32_t* src, size_t units) noexcept { return convert(src, units, encoding::utf32, encoding::utf8); }
+        shared_text to_utf16(const char* src, size_t units) noexcept { return convert(src, units, encoding::utf8, encoding::utf16); }
+        shared_text to_utf16(const char32_t* src, size_t units) noexcept { return convert(src, units, encoding::utf32, encoding::utf16); }
+        shared_text to_utf32(const char* src, size_t units) noexcept { return convert(src, units, encoding::utf8, encoding::utf32); }
+        shared_text to_utf32(const char16_t* src, size_t units) noexcept { return convert(src, units, encoding::utf16, encoding::utf32); }
+
+        statistics stats() const noexcept
+        {
+            return statistics{
+                hits_.load(std::memory_order_relaxed),
+                misses_.load(std::memory_order_relaxed),
+                evictions_.load(std::memory_order_relaxed)
+            };
+        }
+
+        size_t capacity() const noexcept { return sets_ ? (set_mask_ + 1) * ways : 0; }
+
+        void clear() noexcept
+        {
+            if (!sets_)
+                return;
+            for (size_t s = 0; s <= set_mask_; ++s) {
+                std::lock_guard<std::mutex> guard(locks_[s % shards]);
+                for (unsigned w = 0; w < ways; ++w) {
+                    detail::text_block::release(sets_[s].blocks[w]);
+                    sets_[s].blocks[w] = nullptr;
+                }
+                sets_[s].referenced = 0;
+                sets_[s].hand = 0;
+            }
+        }
+
+    private:
+        struct set final {
+            detail::text_block* blocks[ways];
+            uint8_t referenced; // one bit per way
+            uint8_t hand;
+
+            // CLOCK: first free way, or the first not referenced since the last sweep
+            unsigned clock_victim() noexcept
+            {
+                for (unsigned w = 0; w < ways; ++w)
+                    if (!blocks[w])
+                        return w;
+                for (;;) {
+                    const unsigned w = hand;
+                    hand = uint8_t((hand + 1) % ways);
+                    if (referenced & (1u << w))
+                        referenced &= uint8_t(~(1u << w));
+                    else
+                        return w;
+                }
+            }
+        };
+
+        set* sets_{};
+        size_t set_mask_{};
+        std::mutex locks_[shards];
+        std::atomic<uint64_t> hits_{};
+        std::atomic<uint64_t> misses_{};
+        std::atomic<uint64_t> evictions_{};
+    };
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_CACHE_INC
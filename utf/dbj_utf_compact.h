@@ -0,0 +1,281 @@
+#pragma once
+#ifndef DBJ_UTF_COMPACT_INC
+#define DBJ_UTF_COMPACT_INC
+
+#include "dbj_utf_cpp.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Fixed width string, in the narrowest width its content fits,
+as Python 3 str does (PEP 393):
+
+    1 byte  -- all code points <= U+00FF, that is Latin-1
+    2 bytes -- all code points <= U+FFFF, that is UCS-2
+    4 bytes -- anything else, UTF-32
+
+    dbj::utf::compact_string name(json_name, json_name_bytes);
+    // "Zoë" is 3 bytes, not 12 as in the utf32_string
+    char32_t c = name.at(2); // O(1), any width
+
+    char32_t row[80];
+    size_t n = name.copy(0, 80, row);
+
+Width is decided by one pass over the source, then one pass fills the
+block. Narrowing from and widening into utf32 are SSE2 pack and unpack.
+
+Width is always the narrowest one, so equal strings have equal width
+and equality is one memcmp.
+
+utf16 surrogate pairs become one code point, lone surrogates are kept as
+they are. Illegal utf8 sequences become U+FFFD, one per byte, as decode_utf8 does.
+*/
+
+namespace dbj::utf {
+
+    class compact_string final {
+        compact_string(const compact_string&) = delete;
+        compact_string& operator=(const compact_string&) = delete;
+
+    public:
+        explicit compact_string(const utf_allocator* allocator = heap_allocator()) noexcept
+            : allocator_(allocator)
+        {
+        }
+
+        // utf8
+        compact_string(const char* src, size_t bytes, const utf_allocator* allocator = heap_allocator())
+            : allocator_(allocator)
+        {
+            if (!bytes)
+                return;
+            if (simd::ascii_prefix(src, bytes) == bytes) {
+                memcpy(allocate(bytes, 1), src, bytes);
+                return;
+            }
+
+            const char* end = src + bytes;
+            size_t length = 0;
+            char32_t high = 0, cp = 0;
+            for (const char* walker = src; walker < end; ++length) {
+                walker += decode_utf8(walker, end, cp);
+                high |= cp;
+            }
+
+            void* block = allocate(length, width_for(high));
+            size_t j = 0;
+            for (const char* walker = src; walker < end; ++j) {
+                walker += decode_utf8(walker, end, cp);
+                store(block, j, cp);
+            }
+        }
+
+        // utf16
+        compact_string(const char16_t* src, size_t units, const utf_allocator* allocator = heap_allocator())
+            : allocator_(allocator)
+        {
+            if (!units)
+                return;
+            const uint32_t bits = simd::or_16(src, units);
+            if (bits <= 0xFF) {
+                simd::narrow_16_to_8(static_cast<uint8_t*>(allocate(units, 1)), src, units);
+                return;
+            }
+
+            size_t length = 0;
+            char32_t high = 0;
+            for (size_t j = 0; j < units; ++length)
+                high |= next_16(src, units, j);
+
+            if (length == units && high <= 0xFFFF) {
+                memcpy(allocate(units, 2), src, units * sizeof(char16_t));
+                return;
+            }
+
+            void* block = allocate(length, width_for(high));
+            size_t j = 0;
+            for (size_t n = 0; n < length; ++n)
+                store(block, n, next_16(src, units, j));
+        }
+
+        // utf32
+        compact_string(const char32_t* src, size_t units, const utf_allocator* allocator = heap_allocator())
+            : allocator_(allocator)
+        {
+            assign(src, units);
+        }
+
+        explicit compact_string(const utf32_string& src, const utf_allocator* allocator = heap_allocator())
+            : allocator_(allocator)
+        {
+            assign(src.get(), src.length());
+        }
+
+        compact_string(compact_string&& that) noexcept
+            : data_(that.data_), length_(that.length_), width_(that.width_), allocator_(that.allocator_)
+        {
+            that.data_ = nullptr;
+            that.length_ = 0;
+            that.width_ = 1;
+        }
+
+        compact_string& operator=(compact_string&& that) noexcept
+        {
+            if (this != &that) {
+                release();
+                data_ = that.data_;
+                length_ = that.length_;
+                width_ = that.width_;
+                allocator_ = that.allocator_;
+                that.data_ = nullptr;
+                that.length_ = 0;
+                that.width_ = 1;
+            }
+            return *this;
+        }
+
+        ~compact_string() { release(); }
+
+        // code points
+        size_t length() const noexcept { return length_; }
+        bool empty() const noexcept { return length_ == 0; }
+        // bytes per code point, 1, 2 or 4
+        unsigned width() const noexcept { return width_; }
+        // bytes held
+        size_t bytes() const noexcept { return length_ * width_; }
+        // length() units of width() bytes, not zero terminated
+        const void* data() const noexcept { return data_; }
+
+        const utf_allocator* allocator() const noexcept { return allocator_; }
+
+        // code point n, 0 if out of range
+        char32_t at(size_t n) const noexcept
+        {
+            if (n >= length_)
+                return 0;
+            switch (width_) {
+            case 1: return static_cast<const uint8_t*>(data_)[n];
+            case 2: return static_cast<const uint16_t*>(data_)[n];
+            default: return static_cast<const char32_t*>(data_)[n];
+            }
+        }
+
+        char32_t operator[](size_t n) const noexcept { return at(n); }
+
+        /*
+        count code points from pos into dst, clipped to the end
+        returns the number copied, dst is not zero terminated
+        */
+        size_t copy(size_t pos, size_t count, char32_t* dst) const noexcept
+        {
+            if (pos >= length_)
+                return 0;
+            if (count > length_ - pos)
+                count = length_ - pos;
+            switch (width_) {
+            case 1: simd::widen_8_to_32(dst, static_cast<const uint8_t*>(data_) + pos, count); break;
+            case 2: simd::widen_16_to_32(dst, static_cast<const uint16_t*>(data_) + pos, count); break;
+            default: memcpy(dst, static_cast<const char32_t*>(data_) + pos, count * sizeof(char32_t));
+            }
+            return count;
+        }
+
+        friend bool operator==(const compact_string& a, const compact_string& b) noexcept {
+            return a.length_ == b.length_ && a.width_ == b.width_ && (!a.length_ || 0 == memcmp(a.data_, b.data_, a.bytes()));
+        }
+        friend bool operator!=(const compact_string& a, const compact_string& b) noexcept { return !(a == b); }
+
+        /*
+        into the other dbj::utf strings
+        */
+        utf32_string to_utf32(const utf_allocator* allocator = heap_allocator()) const
+        {
+            utf32_string result(allocator);
+            result._data = result.allocate(length_ + 1);
+            copy(0, length_, result._data);
+            result._length = length_;
+            result._flags = text_flags::scan(result._data, length_);
+            return result;
+        }
+
+        utf8_string to_utf8(const utf_allocator* allocator = heap_allocator()) const
+        {
+            if (width_ == 4)
+                return utf8_string(static_cast<const char32_t*>(data_), length_, allocator);
+            if (width_ == 2)
+                return utf8_string(static_cast<const char16_t*>(data_), length_, allocator);
+            const char* latin = static_cast<const char*>(data_);
+            if (simd::ascii_prefix(latin, length_) == length_)
+                return utf8_string(latin ? latin : "", length_, allocator);
+            return utf8_string(to_utf32(), allocator);
+        }
+
+        utf16_string to_utf16(const utf_allocator* allocator = heap_allocator()) const
+        {
+            if (width_ == 4)
+                return utf16_string(static_cast<const char32_t*>(data_), length_, allocator);
+            if (width_ == 2)
+                return utf16_string(static_cast<const char16_t*>(data_), length_, allocator);
+            return utf16_string(to_utf32(), allocator);
+        }
+
+    private:
+        static unsigned width_for(char32_t high) noexcept { return high <= 0xFF ? 1 : high <= 0xFFFF ? 2 : 4; }
+
+        // one code point from src[j], j is moved past it
+        static char32_t next_16(const char16_t* src, size_t units, size_t& j) noexcept
+        {
+            const char32_t unit = src[j++];
+            if (unit >= LINENOISE_UNI_SUR_HIGH_START && unit <= LINENOISE_UNI_SUR_HIGH_END
+                && j < units && src[j] >= LINENOISE_UNI_SUR_LOW_START && src[j] <= LINENOISE_UNI_SUR_LOW_END)
+                return ((unit - LINENOISE_UNI_SUR_HIGH_START) << 10) + (src[j++] - LINENOISE_UNI_SUR_LOW_START) + 0x10000;
+            return unit;
+        }
+
+        void store(void* block, size_t n, char32_t cp) noexcept
+        {
+            switch (width_) {
+            case 1: static_cast<uint8_t*>(block)[n] = (uint8_t)cp; break;
+            case 2: static_cast<uint16_t*>(block)[n] = (uint16_t)cp; break;
+            default: static_cast<char32_t*>(block)[n] = cp;
+            }
+        }
+
+        void assign(const char32_t* src, size_t units)
+        {
+            if (!units)
+                return;
+            const uint32_t bits = simd::or_32(src, units);
+            // or of all the values fits exactly when each of them does
+            void* block = allocate(units, width_for(bits));
+            switch (width_) {
+            case 1: simd::narrow_32_to_8(static_cast<uint8_t*>(block), src, units); break;
+            case 2: simd::narrow_32_to_16(static_cast<uint16_t*>(block), src, units); break;
+            default: memcpy(block, src, units * sizeof(char32_t));
+            }
+        }
+
+        void* allocate(size_t length, unsigned width)
+        {
+            length_ = length;
+            width_ = uint8_t(width);
+            if (!length)
+                return nullptr;
+            data_ = allocator_->allocate_or_throw(length * width);
+            return data_;
+        }
+
+        void release() noexcept
+        {
+            allocator_->deallocate(data_, bytes());
+            data_ = nullptr;
+        }
+
+        void* data_{};
+        size_t length_{};
+        uint8_t width_{ 1 };
+        const utf_allocator* allocator_;
+    };
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_COMPACT_INC
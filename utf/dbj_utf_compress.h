@@ -0,0 +1,462 @@
+#pragma once
+#ifndef DBJ_UTF_COMPRESS_INC
+#define DBJ_UTF_COMPRESS_INC
+
+#include <stdlib.h>
+#include <string.h>
+#include "dbj_utf_memory.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Static dictionary compression of many short utf8 strings, after FSST
+(Boncz, Neumann, Leis, "FSST: Fast Random Access String Compression", VLDB 2020).
+
+    dbj::utf::symbol_table table;
+    table.train(sample, sample_sizes, sample_count); // a few thousand strings
+
+    dbj::utf::compressed_strings urls(table);
+    size_t id = urls.append(url, url_size);
+    ...
+    char buffer[2048];
+    size_t size = urls.get(id, buffer, sizeof(buffer));
+    if (urls.equal(id, other_url, other_url_size)) ... // on the compressed form
+
+Table holds up to 255 symbols of 1 to 8 bytes, each is replaced by one byte
+code. Byte that is not covered is written as the escape code and the byte.
+Typical text compresses 2 to 3 times, every string on its own, so each one
+can be decoded alone.
+
+Decoding is one table load and one 8 byte store per code. Compression is
+greedy and deterministic: with the same table equal strings have equal codes,
+and equality is one memcmp of the codes.
+
+Training runs five rounds of: compress the sample, count the symbols and
+the pairs of symbols that follow each other, keep the 255 which save the
+most bytes. Lookup is as in the FSST paper: 64K table on the first two bytes,
+and 1024 slot hash on the first three bytes for the longer symbols.
+
+Table must outlive the compressed strings. Symbols are kept as the little
+endian 64 bit words.
+*/
+
+namespace dbj::utf {
+
+    class symbol_table final {
+        symbol_table(const symbol_table&) = delete;
+        symbol_table& operator=(const symbol_table&) = delete;
+
+    public:
+        enum : unsigned { max_symbols = 255, escape = 255, max_symbol_length = 8, hash_size = 1024, rounds = 5 };
+
+        // empty table, every byte is escaped
+        symbol_table()
+        {
+            short_ = static_cast<uint16_t*>(detail::checked(DBJ_UTF_MALLOC(0x10000 * sizeof(uint16_t))));
+            build(nullptr, 0);
+        }
+
+        ~symbol_table() { DBJ_UTF_FREE(short_); }
+
+        // symbols in use
+        unsigned size() const noexcept { return size_; }
+
+        // symbol code, its bytes and length
+        uint64_t symbol(unsigned code) const noexcept { return value_[code]; }
+        unsigned symbol_length(unsigned code) const noexcept { return length_[code]; }
+
+        /*
+        on the sample of the strings that will be compressed
+        the sample does not need to be big, FSST uses 16KB
+        on bad_alloc the table is the one of the rounds done, usable
+        */
+        void train(const char* const* strings, const size_t* sizes, size_t count)
+        {
+            enum : unsigned { codes = 512 }; // 255 symbols, 256 bytes escaped
+            uint32_t* single = static_cast<uint32_t*>(DBJ_UTF_MALLOC(codes * sizeof(uint32_t)));
+            uint32_t* pairs = static_cast<uint32_t*>(DBJ_UTF_MALLOC(codes * codes * sizeof(uint32_t)));
+            if (!single || !pairs) {
+                DBJ_UTF_FREE(pairs);
+                DBJ_UTF_FREE(single);
+                throw std::bad_alloc();
+            }
+
+            for (unsigned round = 0; round < rounds; ++round) {
+                memset(single, 0, codes * sizeof(uint32_t));
+                memset(pairs, 0, codes * codes * sizeof(uint32_t));
+
+                for (size_t s = 0; s < count; ++s) {
+                    unsigned previous = codes;
+                    encode(strings[s], sizes[s], [&](unsigned code, uint8_t byte) {
+                        // escaped bytes are counted as codes 256 ..
+                        const unsigned counted = code == escape ? 256 + byte : code;
+                        single[counted] += 1;
+                        // the first byte on its own, as a future single byte symbol
+                        if (code != escape && length_[code] > 1)
+                            single[256 + byte] += 1;
+                        if (previous != codes)
+                            pairs[previous * codes + counted] += 1;
+                        previous = counted;
+                    });
+                }
+
+                size_t candidates_count = 0;
+                for (unsigned j = 0; j < codes * codes; ++j)
+                    candidates_count += pairs[j] != 0;
+                candidates_count += codes;
+
+                candidate* candidates = static_cast<candidate*>(DBJ_UTF_MALLOC(candidates_count * sizeof(candidate)));
+                if (!candidates) {
+                    DBJ_UTF_FREE(pairs);
+                    DBJ_UTF_FREE(single);
+                    throw std::bad_alloc();
+                }
+                size_t used = 0;
+
+                for (unsigned a = 0; a < codes; ++a) {
+                    if (!single[a])
+                        continue;
+                    const uint64_t value = a < 256 ? value_[a] : a - 256;
+                    const unsigned length = a < 256 ? length_[a] : 1;
+                    candidates[used++] = candidate{ value, length, uint64_t(single[a]) * length };
+
+                    for (unsigned b = 0; b < codes; ++b) {
+                        const uint32_t seen = pairs[a * codes + b];
+                        if (!seen)
+                            continue;
+                        const uint64_t second = b < 256 ? value_[b] : b - 256;
+                        const unsigned second_length = b < 256 ? length_[b] : 1;
+                        const unsigned joined = length + second_length;
+                        if (joined > max_symbol_length)
+                            continue;
+                        candidates[used++] = candidate{ value | (second << (8 * length)), joined, uint64_t(seen) * joined };
+                    }
+                }
+
+                // the same symbol can come from more than one pair
+                qsort(candidates, used, sizeof(candidate), by_symbol);
+                size_t unique = 0;
+                for (size_t j = 0; j < used; ++j) {
+                    if (unique && candidates[unique - 1].value == candidates[j].value && candidates[unique - 1].length == candidates[j].length)
+                        candidates[unique - 1].gain += candidates[j].gain;
+                    else
+                        candidates[unique++] = candidates[j];
+                }
+                qsort(candidates, unique, sizeof(candidate), by_gain);
+
+                build(candidates, unique);
+                DBJ_UTF_FREE(candidates);
+            }
+
+            DBJ_UTF_FREE(pairs);
+            DBJ_UTF_FREE(single);
+        }
+
+        // compressed size is never more than this
+        static constexpr size_t compressed_bound(size_t bytes) noexcept { return 2 * bytes; }
+
+        // dst must hold compressed_bound(bytes), returns the compressed size
+        size_t compress(const char* src, size_t bytes, uint8_t* dst) const noexcept
+        {
+            uint8_t* out = dst;
+            encode(src, bytes, [&](unsigned code, uint8_t byte) {
+                *out++ = uint8_t(code);
+                if (code == escape)
+                    *out++ = byte;
+            });
+            return size_t(out - dst);
+        }
+
+        size_t decompressed_size(const uint8_t* codes, size_t size) const noexcept
+        {
+            size_t result = 0;
+            for (size_t j = 0; j < size; ++j) {
+                const unsigned code = codes[j];
+                j += code == escape;
+                result += length_[code];
+            }
+            return result;
+        }
+
+        /*
+        as snprintf: writes what fits into dst, returns the whole decompressed size
+        dst is not zero terminated
+        */
+        size_t decompress(const uint8_t* codes, size_t size, char* dst, size_t capacity) const noexcept
+        {
+            char* out = dst;
+            size_t j = 0;
+            // while every symbol fits, the 8 byte store is unconditional
+            while (j < size && capacity - size_t(out - dst) >= max_symbol_length) {
+                const unsigned code = codes[j++];
+                if (code != escape) {
+                    memcpy(out, &value_[code], max_symbol_length);
+                    out += length_[code];
+                }
+                else if (j < size) {
+                    *out++ = char(codes[j++]);
+                }
+            }
+
+            size_t written = size_t(out - dst);
+            size_t result = written;
+            while (j < size) {
+                const unsigned code = codes[j++];
+                uint64_t value = value_[code];
+                unsigned length = length_[code];
+                if (code == escape) {
+                    if (j == size)
+                        break;
+                    value = codes[j++];
+                }
+                const size_t room = capacity - written;
+                const size_t fits = length < room ? length : room;
+                if (fits)
+                    memcpy(dst + written, &value, fits);
+                written += fits;
+                result += length;
+            }
+            return result;
+        }
+
+    private:
+        struct candidate final {
+            uint64_t value;
+            unsigned length;
+            uint64_t gain;
+        };
+
+        struct hash_entry final {
+            uint64_t value;
+            uint8_t length; // 0 is empty
+            uint8_t code;
+        };
+
+        static int by_symbol(const void* a, const void* b)
+        {
+            const candidate& x = *static_cast<const candidate*>(a);
+            const candidate& y = *static_cast<const candidate*>(b);
+            if (x.length != y.length)
+                return x.length < y.length ? -1 : 1;
+            return x.value < y.value ? -1 : x.value > y.value;
+        }
+
+        // biggest gain first, longer symbol first, then by the symbol
+        static int by_gain(const void* a, const void* b)
+        {
+            const candidate& x = *static_cast<const candidate*>(a);
+            const candidate& y = *static_cast<const candidate*>(b);
+            if (x.gain != y.gain)
+                return x.gain > y.gain ? -1 : 1;
+            return -by_symbol(a, b);
+        }
+
+        // of the first three bytes
+        static unsigned hash_of(uint64_t word) noexcept
+        {
+            return (uint32_t(word & 0xFFFFFF) * 2654435761u) >> (32 - 10);
+        }
+
+        static uint16_t short_code(unsigned length, unsigned code) noexcept { return uint16_t((length << 8) | code); }
+
+        /*
+        the best candidates get the codes, in that order
+        longer symbol is dropped when its hash slot is taken
+        */
+        void build(const candidate* candidates, size_t count) noexcept
+        {
+            size_ = 0;
+            memset(hash_, 0, sizeof(hash_));
+            for (unsigned b = 0; b < 256; ++b)
+                byte_[b] = short_code(1, escape);
+
+            for (size_t j = 0; j < count && size_ < max_symbols; ++j) {
+                const candidate& c = candidates[j];
+                if (c.length >= 3) {
+                    hash_entry& slot = hash_[hash_of(c.value)];
+                    if (slot.length)
+                        continue;
+                    slot = hash_entry{ c.value, uint8_t(c.length), uint8_t(size_) };
+                }
+                else if (c.length == 1) {
+                    byte_[c.value] = short_code(1, size_);
+                }
+                value_[size_] = c.value;
+                length_[size_] = uint8_t(c.length);
+                ++size_;
+            }
+
+            for (unsigned key = 0; key < 0x10000; ++key)
+                short_[key] = byte_[key & 0xFF];
+            for (unsigned code = 0; code < size_; ++code)
+                if (length_[code] == 2)
+                    short_[value_[code]] = short_code(2, code);
+
+            // escape decodes as one byte
+            value_[escape] = 0;
+            length_[escape] = 1;
+        }
+
+        /*
+        greedy, longest symbol first
+        emit(code, byte) -- byte is the first byte of the symbol, the escaped one for escape
+        */
+        template <typename F>
+        void encode(const char* src, size_t bytes, F&& emit) const noexcept
+        {
+            const uint8_t* walker = reinterpret_cast<const uint8_t*>(src);
+            const uint8_t* end = walker + bytes;
+
+            while (walker < end) {
+                const size_t left = size_t(end - walker);
+                uint64_t word = 0;
+                memcpy(&word, walker, left < 8 ? left : 8);
+
+                const hash_entry& entry = hash_[hash_of(word)];
+                if (entry.length && entry.length <= left && ((word ^ entry.value) << (64 - 8 * entry.length)) == 0) {
+                    emit(entry.code, *walker);
+                    walker += entry.length;
+                    continue;
+                }
+
+                const uint16_t code = left >= 2 ? short_[word & 0xFFFF] : byte_[*walker];
+                emit(code & 0xFF, *walker);
+                walker += code >> 8;
+            }
+        }
+
+        uint64_t value_[256]{};
+        uint8_t length_[256]{};
+        unsigned size_{};
+        uint16_t byte_[256]{};
+        uint16_t* short_{};
+        hash_entry hash_[hash_size]{};
+    };
+
+    /*
+    compressed strings, one after the other, and their offsets
+    index is the order of append
+    */
+    class compressed_strings final {
+        compressed_strings(const compressed_strings&) = delete;
+        compressed_strings& operator=(const compressed_strings&) = delete;
+
+    public:
+        explicit compressed_strings(const symbol_table& table, const utf_allocator* allocator = heap_allocator()) noexcept
+            : table_(table), allocator_(allocator)
+        {
+        }
+
+        ~compressed_strings()
+        {
+            allocator_->deallocate(data_, capacity_);
+            allocator_->deallocate(offsets_, offsets_capacity_ * sizeof(size_t));
+        }
+
+        // index of the string appended
+        size_t append(const char* src, size_t bytes)
+        {
+            if (count_ + 2 > offsets_capacity_)
+                grow_offsets();
+            if (size_ + symbol_table::compressed_bound(bytes) > capacity_)
+                grow(size_ + symbol_table::compressed_bound(bytes));
+
+            size_ += table_.compress(src, bytes, data_ + size_);
+            offsets_[++count_] = size_;
+            return count_ - 1;
+        }
+
+        size_t count() const noexcept { return count_; }
+        // compressed bytes held, offsets not included
+        size_t compressed_bytes() const noexcept { return size_; }
+
+        // compressed form of the string index
+        const uint8_t* codes(size_t index, size_t& size) const noexcept
+        {
+            assert(index < count_);
+            size = offsets_[index + 1] - offsets_[index];
+            return data_ + offsets_[index];
+        }
+
+        // bytes of the string index
+        size_t size_of(size_t index) const noexcept
+        {
+            size_t size = 0;
+            const uint8_t* compressed = codes(index, size);
+            return table_.decompressed_size(compressed, size);
+        }
+
+        // as symbol_table::decompress
+        size_t get(size_t index, char* dst, size_t capacity) const noexcept
+        {
+            size_t size = 0;
+            const uint8_t* compressed = codes(index, size);
+            return table_.decompress(compressed, size, dst, capacity);
+        }
+
+        bool equal(size_t a, size_t b) const noexcept
+        {
+            size_t size_a = 0, size_b = 0;
+            const uint8_t* codes_a = codes(a, size_a);
+            const uint8_t* codes_b = codes(b, size_b);
+            return size_a == size_b && 0 == memcmp(codes_a, codes_b, size_a);
+        }
+
+        // src is compressed, not the stored string decompressed
+        bool equal(size_t index, const char* src, size_t bytes) const
+        {
+            size_t size = 0;
+            const uint8_t* compressed = codes(index, size);
+            // every code stands for one byte at least
+            if (size > symbol_table::compressed_bound(bytes))
+                return false;
+
+            uint8_t local[256];
+            uint8_t* probe = symbol_table::compressed_bound(bytes) <= sizeof(local)
+                ? local : static_cast<uint8_t*>(allocator_->allocate_or_throw(symbol_table::compressed_bound(bytes)));
+            const size_t probe_size = table_.compress(src, bytes, probe);
+            const bool result = probe_size == size && 0 == memcmp(probe, compressed, size);
+            if (probe != local)
+                allocator_->deallocate(probe, symbol_table::compressed_bound(bytes));
+            return result;
+        }
+
+    private:
+        void grow(size_t needed)
+        {
+            size_t capacity = capacity_ ? capacity_ : size_t(4096);
+            while (capacity < needed)
+                capacity *= 2;
+            uint8_t* block = static_cast<uint8_t*>(allocator_->allocate_or_throw(capacity));
+            if (size_)
+                memcpy(block, data_, size_);
+            allocator_->deallocate(data_, capacity_);
+            data_ = block;
+            capacity_ = capacity;
+        }
+
+        void grow_offsets()
+        {
+            const size_t capacity = offsets_capacity_ ? 2 * offsets_capacity_ : size_t(64);
+            size_t* block = static_cast<size_t*>(allocator_->allocate_or_throw(capacity * sizeof(size_t)));
+            if (offsets_)
+                memcpy(block, offsets_, (count_ + 1) * sizeof(size_t));
+            else
+                block[0] = 0;
+            allocator_->deallocate(offsets_, offsets_capacity_ * sizeof(size_t));
+            offsets_ = block;
+            offsets_capacity_ = capacity;
+        }
+
+        const symbol_table& table_;
+        const utf_allocator* allocator_;
+        uint8_t* data_{};
+        size_t size_{};
+        size_t capacity_{};
+        size_t* offsets_{}; // count_ + 1, the first is 0
+        size_t offsets_capacity_{};
+        size_t count_{};
+    };
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_COMPRESS_INC
@@ -231,13 +231,13 @@ namespace dbj::utf {
                     if (a < 0xA0) return false;
                     break;
                 case 0xED:
-                    if (a > 0x9F) return false;
+                    if (a < 0x80 || a > 0x9F) return false;
                     break;
                 case 0xF0:
                     if (a < 0x90) return false;
                     break;
                 case 0xF4:
-                    if (a > 0x8F) return false;
+                    if (a < 0x80 || a > 0x8F) return false;
                     break;
                 default:
                     if (a < 0x80) return false;
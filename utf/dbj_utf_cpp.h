@@ -3,71 +3,255 @@
 #define DBJ_UTF_CPP_INC
 
 #include "dbj_utf_utils.h"
-/* 
+#include "dbj_utf_simd.h"
+#include "dbj_utf_memory.h"
+#include "dbj_utf_hash.h"
+#include "dbj_utf_property.h"
+#include "dbj_wcwidth.h"
+/*
 C++ dbj utf types using dbj utf functions
+
+Constructors are already walking every unit, so they also record what
+they have seen: all ASCII, all BMP, contains combining marks, contains
+control chars. That makes length, random access, width and re-encoding
+of the (most common) ASCII strings O(1) or a straight copy.
+
+Any of the three can be made from utf8, utf16 or utf32 source directly,
+there is no utf32 detour, see the make_utf*_string() factories.
+
+Buffers are sized exactly, one pass over the source counts the units
+needed. All three are movable, moving is noexcept and never allocates.
+
+Memory comes from the utf_allocator given to the constructor, the heap by
+default, or the arena or the pool from dbj_utf_memory.h.
+
+Short strings do not touch the heap. Each class has inline buffer sized so that
+the whole object is two cache lines (128 bytes). Only above that capacity
+the buffer is allocated.
+
+NOTE: flags are computed on construction and kept exact by set(), thus
+reading them is a plain read, from any number of threads. Writing through
+get() does not update them, call refresh_flags() after doing that.
 */
 
 namespace dbj::utf {
+
+    /*
+    what the string contains, bits of the utf strings flags
+    */
+    struct text_flags final {
+        enum : uint8_t {
+            ascii = 1,      // all code points < 0x80
+            bmp = 2,        // all code points <= 0xFFFF, ie. one utf16 unit each
+            combining = 4,  // contains Mn, Mc or Me
+            control = 8,    // contains C0 or C1 control, width is -1
+            known = 0x80    // flags are up to date
+        };
+
+        static constexpr uint8_t of_empty() noexcept { return known | ascii | bmp; }
+
+        // flags of the two texts joined
+        static constexpr uint8_t join(uint8_t a, uint8_t b) noexcept {
+            return uint8_t(known | (a & b & (ascii | bmp)) | ((a | b) & (combining | control)));
+        }
+
+        /*
+        accumulates the flags one code point at a time
+        */
+        struct tally final {
+            bool non_ascii{}, non_bmp{}, marks{}, controls{};
+
+            void add(char32_t cp) noexcept
+            {
+                if (cp < 0x80) {
+                    controls |= (cp < 0x20 || cp == 0x7F);
+                    return;
+                }
+                non_ascii = true;
+                controls |= cp < 0xA0;
+                non_bmp |= cp > 0xFFFF;
+                // there are no marks bellow U+0300
+                if (!marks && cp >= 0x300)
+                    marks = properties(cp).is_mark();
+            }
+
+            uint8_t result() const noexcept
+            {
+                return uint8_t(known
+                    | (non_ascii ? 0 : ascii)
+                    | (non_bmp ? 0 : bmp)
+                    | (marks ? combining : 0)
+                    | (controls ? control : 0));
+            }
+        };
+
+        static uint8_t of(char32_t cp) noexcept
+        {
+            tally t;
+            t.add(cp);
+            return t.result();
+        }
+
+        static uint8_t scan(const char32_t* src, size_t len) noexcept
+        {
+            tally t;
+            for (size_t j = 0; j < len; ++j)
+                t.add(src[j]);
+            return t.result();
+        }
+
+        // code_points is set to the number of code points in src
+        static uint8_t scan_utf8(const char* src, size_t bytes, size_t& code_points) noexcept
+        {
+            const size_t prefix = simd::ascii_prefix(src, bytes);
+            if (prefix == bytes) {
+                code_points = bytes;
+                return scan_ascii(src, bytes);
+            }
+
+            tally t;
+            t.controls = simd::printable_ascii_prefix(src, prefix) != prefix;
+            code_points = prefix;
+
+            const char* walker = src + prefix;
+            const char* end = src + bytes;
+            char32_t cp = 0;
+            while (walker < end) {
+                walker += decode_utf8(walker, end, cp);
+                t.add(cp);
+                ++code_points;
+            }
+            return t.result();
+        }
+
+        // code_points is set to the number of code points in src
+        static uint8_t scan_utf16(const char16_t* src, size_t units, size_t& code_points) noexcept
+        {
+            tally t;
+            code_points = 0;
+            for (size_t u = 0; u < units; ++code_points) {
+                char32_t cp = src[u++];
+                if (cp >= LINENOISE_UNI_SUR_HIGH_START && cp <= LINENOISE_UNI_SUR_HIGH_END && u < units
+                    && src[u] >= LINENOISE_UNI_SUR_LOW_START && src[u] <= LINENOISE_UNI_SUR_LOW_END) {
+                    cp = ((cp - LINENOISE_UNI_SUR_HIGH_START) << linenoise_halfshift)
+                        + (src[u++] - LINENOISE_UNI_SUR_LOW_START) + linenoise_halfbase;
+                }
+                t.add(cp);
+            }
+            return t.result();
+        }
+
+        // src is all ASCII
+        static uint8_t scan_ascii(const char* src, size_t len) noexcept
+        {
+            return uint8_t(known | ascii | bmp
+                | (simd::printable_ascii_prefix(src, len) == len ? 0 : control));
+        }
+    };
+
     /*
     utf32 string is the lowest common denominator
     */
+    class compact_string;
+
     class utf32_string final {
+        friend class compact_string;
+
     public:
-        utf32_string() : _length(0), _data(nullptr) {
-            // note: parens intentional, _data must be properly initialized
-            _data = new char32_t[1]();
+        // code units held inline, terminator included
+        enum : size_t { inline_capacity = (128 - 5 * sizeof(void*)) / sizeof(char32_t) };
+
+        utf32_string() : utf32_string(heap_allocator()) {
         }
 
-        explicit utf32_string(const char* src) : _length(0), _data(nullptr) {
-            size_t len = strlen(src);
-            // note: parens intentional, _data must be properly initialized
-            _data = new char32_t[len + 1]();
-            copy_string_8_to_32(_data, len + 1, _length, src);
+        explicit utf32_string(const utf_allocator* allocator)
+            : _length(0), _capacity(0), _data(_inline), _allocator(allocator), _flags(text_flags::of_empty()) {
+            _inline[0] = 0;
         }
 
-        explicit utf32_string(const char8_t* src) 
-            :    utf32_string(reinterpret_cast<const char*>(src))
-        {
+        /*
+        zero terminated sources use the heap, the counted constructors take
+        the allocator; (src, 0) is then never ambiguous
+        */
+        explicit utf32_string(const char* src) : utf32_string(src, strlen(src)) {
         }
 
-        explicit utf32_string(const char32_t* src) : _length(0), _data(nullptr) {
-            for (_length = 0; src[_length] != 0; ++_length) {
+        /*
+        from utf8 or utf16, src_units in the source encoding
+        one direct conversion into the exactly sized buffer
+        */
+        utf32_string(const char* src, size_t src_units, const utf_allocator* allocator = heap_allocator())
+            : _length(0), _capacity(0), _data(nullptr), _allocator(allocator), _flags(0) {
+            if (simd::ascii_prefix(src, src_units) == src_units) {
+                _data = allocate(src_units + 1);
+                // no need for the converter
+                for (size_t j = 0; j < src_units; ++j)
+                    _data[j] = (unsigned char)src[j];
+                _length = src_units;
+                _flags = text_flags::scan_ascii(src, src_units);
             }
+            else {
+                init(src, src_units, encoding::utf8);
+            }
+        }
+
+        utf32_string(const char16_t* src, size_t src_units, const utf_allocator* allocator = heap_allocator())
+            : _length(0), _capacity(0), _data(nullptr), _allocator(allocator), _flags(0) {
+            init(src, src_units, encoding::utf16);
+        }
+
+        explicit utf32_string(const char8_t* src)
+            :    utf32_string(reinterpret_cast<const char*>(src))
+        {
+        }
 
-            // note: parens intentional, _data must be properly initialized
-            _data = new char32_t[_length + 1]();
-            memcpy(_data, src, _length * sizeof(char32_t));
+        explicit utf32_string(const char32_t* src) : utf32_string(src, strlen_32(src)) {
         }
 
-        explicit utf32_string(const char32_t* src, int len) : _length(len), _data(nullptr) {
-            // note: parens intentional, _data must be properly initialized
-            _data = new char32_t[len + 1]();
+        explicit utf32_string(const char32_t* src, size_t len, const utf_allocator* allocator = heap_allocator())
+            : _length(len), _capacity(0), _data(nullptr), _allocator(allocator), _flags(0) {
+            _data = allocate(len + 1);
             memcpy(_data, src, len * sizeof(char32_t));
+            _flags = text_flags::scan(_data, _length);
         }
 
-        explicit utf32_string(int len) : _length(0), _data(nullptr) {
-            // note: parens intentional, _data must be properly initialized
-            _data = new char32_t[len]();
+        explicit utf32_string(int len, const utf_allocator* allocator = heap_allocator())
+            : _length(0), _capacity(0), _data(nullptr), _allocator(allocator), _flags(text_flags::of_empty()) {
+            _data = allocate(len);
         }
 
-        explicit utf32_string(const utf32_string& that) : _length(that._length), _data(nullptr) {
-            // note: parens intentional, _data must be properly initialized
-            _data = new char32_t[_length + 1]();
+        // the copy uses the same allocator
+        explicit utf32_string(const utf32_string& that)
+            : _length(that._length), _capacity(0), _data(nullptr), _allocator(that._allocator), _flags(that._flags) {
+            _data = allocate(_length + 1);
             memcpy(_data, that._data, sizeof(char32_t) * _length);
         }
 
+        // keeps its own allocator; on bad_alloc this is left as it was
         utf32_string& operator=(const utf32_string& that) {
             if (this != &that) {
-                delete[] _data;
-                _data = new char32_t[that._length]();
-                _length = that._length;
-                memcpy(_data, that._data, sizeof(char32_t) * _length);
+                utf32_string copy(that._data, that._length, _allocator);
+                release();
+                take(copy);
             }
 
             return *this;
         }
 
-        ~utf32_string() { delete[] _data; }
+        utf32_string(utf32_string&& that) noexcept
+            : _length(0), _capacity(0), _data(_inline), _allocator(that._allocator), _flags(0) {
+            take(that);
+        }
+
+        utf32_string& operator=(utf32_string&& that) noexcept {
+            if (this != &that) {
+                release();
+                take(that);
+            }
+            return *this;
+        }
+
+        ~utf32_string() { release(); }
 
     public:
         char32_t* get() const { return _data; }
@@ -76,50 +260,316 @@ namespace dbj::utf {
 
         const char32_t& operator[](size_t pos) const { return _data[pos]; }
 
-        char32_t& operator[](size_t pos) { return _data[pos]; }
+        /*
+        code point at pos is replaced, flags are kept exact
+        O(1), unless the old code point was the reason for some flag, and
+        cp is not, then the whole string is scanned
+        */
+        void set(size_t pos, char32_t cp) {
+            assert(pos < _length);
+            const uint8_t was = text_flags::of(_data[pos]);
+            const uint8_t now = text_flags::of(cp);
+            _data[pos] = cp;
+            if (text_flags::join(was, now) == now)
+                _flags = text_flags::join(_flags, now);
+            else
+                refresh_flags();
+        }
+
+        uint8_t flags() const { return _flags; }
+
+        void refresh_flags() { _flags = text_flags::scan(_data, _length); }
+
+        bool is_ascii() const { return flags() & text_flags::ascii; }
+        bool is_bmp() const { return flags() & text_flags::bmp; }
+        bool has_combining() const { return flags() & text_flags::combining; }
+
+        /*
+        as dbj_wcswidth, O(1) for ASCII without control chars
+        */
+        int width() const {
+            const uint8_t f = flags();
+            if ((f & text_flags::ascii) && !(f & text_flags::control))
+                return int(_length);
+            return dbj_wcswidth(_data, _length);
+        }
+
+        bool is_inline() const { return _data == _inline; }
+
+        /*
+        searching and ordering, SSE2 kernels, npos if not found
+        */
+        size_t find(char32_t cp, size_t from = 0) const { return find_32(_data, _length, cp, from); }
+        size_t rfind(char32_t cp, size_t from = npos) const { return rfind_32(_data, _length, cp, from); }
+
+        size_t find(const utf32_string& what, size_t from = 0) const {
+            return find_32(_data, _length, what._data, what._length, from);
+        }
+        size_t rfind(const utf32_string& what, size_t from = npos) const {
+            return rfind_32(_data, _length, what._data, what._length, from);
+        }
+
+        int compare(const utf32_string& other) const { return compare_32(_data, _length, other._data, other._length); }
+
+        friend bool operator==(const utf32_string& a, const utf32_string& b) {
+            return a._length == b._length && simd::mismatch_32(a._data, b._data, a._length) == a._length;
+        }
+        friend bool operator!=(const utf32_string& a, const utf32_string& b) { return !(a == b); }
+        friend bool operator<(const utf32_string& a, const utf32_string& b) { return a.compare(b) < 0; }
+
+        const utf_allocator* allocator() const { return _allocator; }
 
     private:
 
-        void initFromBuffer() {
-            for (_length = 0; _data[_length] != 0; ++_length) {
+        char32_t* allocate(size_t units) {
+            if (units <= inline_capacity) {
+                memset(_inline, 0, units * sizeof(char32_t));
+                return _inline;
             }
+            char32_t* block = static_cast<char32_t*>(_allocator->allocate_or_throw(units * sizeof(char32_t)));
+            // _data must be properly initialized
+            memset(block, 0, units * sizeof(char32_t));
+            _capacity = units;
+            return block;
+        }
+
+        void release() {
+            if (_data != _inline)
+                _allocator->deallocate(_data, _capacity * sizeof(char32_t));
+            _data = _inline;
+        }
+
+        // that is left empty
+        void take(utf32_string& that) noexcept {
+            if (that._data == that._inline) {
+                memcpy(_inline, that._inline, (that._length + 1) * sizeof(char32_t));
+                _data = _inline;
+            }
+            else {
+                _data = that._data;
+                _capacity = that._capacity;
+            }
+            _allocator = that._allocator;
+            _length = that._length;
+            _flags = that._flags;
+
+            that._data = that._inline;
+            that._inline[0] = 0;
+            that._length = 0;
+            that._flags = text_flags::of_empty();
+        }
+
+        void init(const void* src, size_t src_units, encoding from) {
+            const size_t units = transcoded_length(src, src_units, from, encoding::utf32) + 1;
+            _data = allocate(units);
+            // on illegal source, what was converted is kept
+            transcode(src, src_units, from, _data, units, encoding::utf32, _length);
+            if (_length >= units)
+                _length = units - 1;
+            _data[_length] = 0;
+            _flags = text_flags::scan(_data, _length);
+        }
+
+        void initFromBuffer() {
+            _length = strlen_32(_data);
+            _flags = text_flags::scan(_data, _length);
         }
 
         // size_t chars() const { return _length; }
 
         size_t _length;
+        size_t _capacity; // of the allocated block, in units
         char32_t* _data;
+        const utf_allocator* _allocator;
+        uint8_t _flags;
+        char32_t _inline[inline_capacity];
     };
 
+    static_assert(sizeof(utf32_string) <= 128);
+
+    class utf8_builder;
+
     class utf8_string final {
         utf8_string(const utf8_string&) = delete;
         utf8_string& operator=(const utf8_string&) = delete;
 
+        friend class utf8_builder;
+
     public:
+        enum : size_t { inline_capacity = 128 - (3 * sizeof(size_t) + 2 * sizeof(void*) + sizeof(uint8_t)) };
+
         utf8_string() = delete;
 
-        explicit utf8_string(const utf32_string& src) 
-            : len_(src.length() * 4 + 1 ),
-            data_(new char[len_])
+        explicit utf8_string(const utf32_string& src, const utf_allocator* allocator = heap_allocator())
+            : len_(exact_size(src)),
+            length_(src.length()),
+            allocator_(allocator),
+            flags_(src.flags())
 
         {
-            assert(len_ > 1);
+            assert(len_ > 0);
+            data_ = allocate(len_);
             assert(data_);
-            copy_string_32_to_8(data_, len_, src.get());
+            if (flags_ & text_flags::ascii) {
+                // straight narrowing copy
+                const char32_t* source = src.get();
+                for (size_t j = 0; j < length_; ++j)
+                    data_[j] = (char)source[j];
+                data_[length_] = 0;
+                bytes_ = length_;
+            }
+            else {
+                const conversion_result result = transcode(src.get(), src.length(), encoding::utf32, data_, len_, encoding::utf8, bytes_);
+                if (bytes_ >= len_)
+                    bytes_ = len_ - 1;
+                data_[bytes_] = 0;
+                // values above U+10FFFF were replaced, flags are of the result
+                if (result != conversionOK)
+                    flags_ = text_flags::scan_utf8(data_, bytes_, length_);
+            }
             assert(data_);
         }
 
-        ~utf8_string() { delete[] data_; }
+        /*
+        from utf8, utf16 or utf32, src_units in the source encoding
+        one direct conversion into the exactly sized buffer
+        */
+        utf8_string(const char* src, size_t src_units, const utf_allocator* allocator = heap_allocator())
+            : allocator_(allocator) {
+            init(src, src_units, encoding::utf8);
+        }
+        utf8_string(const char16_t* src, size_t src_units, const utf_allocator* allocator = heap_allocator())
+            : allocator_(allocator) {
+            init(src, src_units, encoding::utf16);
+        }
+        utf8_string(const char32_t* src, size_t src_units, const utf_allocator* allocator = heap_allocator())
+            : allocator_(allocator) {
+            init(src, src_units, encoding::utf32);
+        }
+
+        utf8_string(utf8_string&& that) noexcept {
+            take(that);
+        }
+
+        utf8_string& operator=(utf8_string&& that) noexcept {
+            if (this != &that) {
+                release();
+                take(that);
+            }
+            return *this;
+        }
+
+        ~utf8_string() { release(); }
 
     public:
         char* get() const noexcept { return data_; }
         size_t size() const noexcept { return len_;  }
 
+        const utf_allocator* allocator() const noexcept { return allocator_; }
+
+        // bytes without the terminator
+        size_t bytes() const noexcept { return bytes_; }
+        // code points, O(1)
+        size_t length() const noexcept { return length_; }
+
+        uint8_t flags() const noexcept { return flags_; }
+        bool is_ascii() const noexcept { return flags_ & text_flags::ascii; }
+        bool is_bmp() const noexcept { return flags_ & text_flags::bmp; }
+        bool has_combining() const noexcept { return flags_ & text_flags::combining; }
+
+        /*
+        code point at the index, O(1) for ASCII, otherwise a scan
+        */
+        char32_t at(size_t index) const noexcept {
+            if (flags_ & text_flags::ascii)
+                return index < bytes_ ? (unsigned char)data_[index] : 0;
+
+            const char* walker = data_;
+            const char* end = data_ + bytes_;
+            char32_t cp = 0;
+            for (size_t j = 0; walker < end; ++j) {
+                walker += decode_utf8(walker, end, cp);
+                if (j == index)
+                    return cp;
+            }
+            return 0;
+        }
+
     private:
+        /*
+        adopt the zero terminated block from the allocator, no copy
+        capacity is the block size in bytes
+        */
+        utf8_string(char* block, size_t capacity, size_t bytes, const utf_allocator* allocator)
+            : len_(capacity), data_(block), bytes_(bytes), allocator_(allocator)
+        {
+            assert(bytes_ < len_);
+            flags_ = text_flags::scan_utf8(data_, bytes_, length_);
+        }
+
+        // bytes needed, terminator included
+        static size_t exact_size(const utf32_string& src) noexcept {
+            if (src.is_ascii())
+                return src.length() + 1;
+            return transcoded_length(src.get(), src.length(), encoding::utf32, encoding::utf8) + 1;
+        }
+
+        void init(const void* src, size_t src_units, encoding from) {
+            len_ = transcoded_length(src, src_units, from, encoding::utf8) + 1;
+            data_ = allocate(len_);
+            // on illegal source, what was converted is kept
+            transcode(src, src_units, from, data_, len_, encoding::utf8, bytes_);
+            if (bytes_ >= len_)
+                bytes_ = len_ - 1;
+            data_[bytes_] = 0;
+            flags_ = text_flags::scan_utf8(data_, bytes_, length_);
+        }
+
+        char* allocate(size_t units) {
+            if (units <= inline_capacity)
+                return inline_;
+            return static_cast<char*>(allocator_->allocate_or_throw(units * sizeof(char)));
+        }
+
+        void release() noexcept {
+            if (data_ != inline_)
+                allocator_->deallocate(data_, len_ * sizeof(char));
+            data_ = inline_;
+        }
+
+        // that is left empty
+        void take(utf8_string& that) noexcept {
+            if (that.data_ == that.inline_) {
+                memcpy(inline_, that.inline_, that.bytes_ + 1);
+                data_ = inline_;
+            }
+            else {
+                data_ = that.data_;
+            }
+            len_ = that.len_;
+            allocator_ = that.allocator_;
+            length_ = that.length_;
+            bytes_ = that.bytes_;
+            flags_ = that.flags_;
+
+            that.data_ = that.inline_;
+            that.inline_[0] = 0;
+            that.len_ = 1;
+            that.length_ = that.bytes_ = 0;
+            that.flags_ = text_flags::of_empty();
+        }
+
         size_t len_{};
         char* data_{};
+        size_t length_{};
+        size_t bytes_{};
+        const utf_allocator* allocator_{ heap_allocator() };
+        uint8_t flags_{};
+        char inline_[inline_capacity];
     };
 
+    static_assert(sizeof(utf8_string) <= 128);
+
     class utf16_string final {
 
         // no copy
@@ -127,20 +577,72 @@ namespace dbj::utf {
         utf16_string& operator=(const utf16_string&) = delete;
 
     public:
+        enum : size_t { inline_capacity = (128 - (3 * sizeof(size_t) + 2 * sizeof(void*) + sizeof(uint8_t))) / sizeof(char16_t) };
+
         utf16_string() = delete;
 
-        explicit utf16_string(const utf32_string& src) 
-            : len_(src.length() * 2 + 1 ),
-            data_(new char16_t[len_])
+        explicit utf16_string(const utf32_string& src, const utf_allocator* allocator = heap_allocator())
+            : len_(exact_size(src)),
+            length_(src.length()),
+            allocator_(allocator),
+            flags_(src.flags())
 
         {
-            assert(len_ > 1);
+            assert(len_ > 0);
+            data_ = allocate(len_);
             assert(data_);
-            copy_string_32_to_16(data_, len_, src.get());
+            if (flags_ & text_flags::bmp) {
+                // one unit per code point, surrogates are replaced as the converter would
+                const char32_t* source = src.get();
+                for (size_t j = 0; j < length_; ++j)
+                    data_[j] = (source[j] >= LINENOISE_UNI_SUR_HIGH_START && source[j] <= LINENOISE_UNI_SUR_LOW_END)
+                    ? char16_t(LINENOISE_UNI_REPLACEMENT_CHAR) : char16_t(source[j]);
+                data_[length_] = 0;
+                units_ = length_;
+            }
+            else {
+                const conversion_result result = transcode(src.get(), src.length(), encoding::utf32, data_, len_, encoding::utf16, units_);
+                if (units_ >= len_)
+                    units_ = len_ - 1;
+                data_[units_] = 0;
+                // values above U+10FFFF were replaced, flags are of the result
+                // lenient converter replaces them without an error, then no pair is written
+                if (result != conversionOK || units_ == length_)
+                    flags_ = text_flags::scan_utf16(data_, units_, length_);
+            }
             assert(data_);
         }
 
-        ~utf16_string() { delete[] data_; }
+        /*
+        from utf8, utf16 or utf32, src_units in the source encoding
+        one direct conversion into the exactly sized buffer
+        */
+        utf16_string(const char* src, size_t src_units, const utf_allocator* allocator = heap_allocator())
+            : allocator_(allocator) {
+            init(src, src_units, encoding::utf8);
+        }
+        utf16_string(const char16_t* src, size_t src_units, const utf_allocator* allocator = heap_allocator())
+            : allocator_(allocator) {
+            init(src, src_units, encoding::utf16);
+        }
+        utf16_string(const char32_t* src, size_t src_units, const utf_allocator* allocator = heap_allocator())
+            : allocator_(allocator) {
+            init(src, src_units, encoding::utf32);
+        }
+
+        utf16_string(utf16_string&& that) noexcept {
+            take(that);
+        }
+
+        utf16_string& operator=(utf16_string&& that) noexcept {
+            if (this != &that) {
+                release();
+                take(that);
+            }
+            return *this;
+        }
+
+        ~utf16_string() { release(); }
 
     public:
 #ifdef WIN32
@@ -151,11 +653,189 @@ namespace dbj::utf {
 
         size_t size() const noexcept { return len_;  }
 
+        const utf_allocator* allocator() const noexcept { return allocator_; }
+
+        // utf16 units without the terminator
+        size_t units() const noexcept { return units_; }
+        // code points, O(1)
+        size_t length() const noexcept { return length_; }
+
+        uint8_t flags() const noexcept { return flags_; }
+        bool is_ascii() const noexcept { return flags_ & text_flags::ascii; }
+        bool is_bmp() const noexcept { return flags_ & text_flags::bmp; }
+        bool has_combining() const noexcept { return flags_ & text_flags::combining; }
+
+        /*
+        code point at the index, O(1) for BMP, otherwise a scan
+        */
+        char32_t at(size_t index) const noexcept {
+            if (flags_ & text_flags::bmp)
+                return index < units_ ? data_[index] : 0;
+
+            size_t j = 0;
+            for (size_t u = 0; u < units_; ++j) {
+                char32_t cp = data_[u++];
+                if (cp >= LINENOISE_UNI_SUR_HIGH_START && cp <= LINENOISE_UNI_SUR_HIGH_END && u < units_) {
+                    cp = ((cp - LINENOISE_UNI_SUR_HIGH_START) << linenoise_halfshift)
+                        + (data_[u++] - LINENOISE_UNI_SUR_LOW_START) + linenoise_halfbase;
+                }
+                if (j == index)
+                    return cp;
+            }
+            return 0;
+        }
+
     private:
+        // units needed, terminator included
+        static size_t exact_size(const utf32_string& src) noexcept {
+            if (src.is_bmp())
+                return src.length() + 1;
+            return transcoded_length(src.get(), src.length(), encoding::utf32, encoding::utf16) + 1;
+        }
+
+        void init(const void* src, size_t src_units, encoding from) {
+            const char* ascii = static_cast<const char*>(src);
+            const bool widen = from == encoding::utf8 && simd::ascii_prefix(ascii, src_units) == src_units;
+
+            len_ = widen ? src_units + 1 : transcoded_length(src, src_units, from, encoding::utf16) + 1;
+            data_ = allocate(len_);
+
+            if (widen) {
+                // no need for the converter
+                for (size_t j = 0; j < src_units; ++j)
+                    data_[j] = (unsigned char)ascii[j];
+                data_[src_units] = 0;
+                units_ = length_ = src_units;
+                flags_ = text_flags::scan_ascii(ascii, src_units);
+                return;
+            }
+
+            // on illegal source, what was converted is kept
+            transcode(src, src_units, from, data_, len_, encoding::utf16, units_);
+            if (units_ >= len_)
+                units_ = len_ - 1;
+            data_[units_] = 0;
+            flags_ = text_flags::scan_utf16(data_, units_, length_);
+        }
+
+        char16_t* allocate(size_t units) {
+            if (units <= inline_capacity)
+                return inline_;
+            return static_cast<char16_t*>(allocator_->allocate_or_throw(units * sizeof(char16_t)));
+        }
+
+        void release() noexcept {
+            if (data_ != inline_)
+                allocator_->deallocate(data_, len_ * sizeof(char16_t));
+            data_ = inline_;
+        }
+
+        // that is left empty
+        void take(utf16_string& that) noexcept {
+            if (that.data_ == that.inline_) {
+                memcpy(inline_, that.inline_, (that.units_ + 1) * sizeof(char16_t));
+                data_ = inline_;
+            }
+            else {
+                data_ = that.data_;
+            }
+            len_ = that.len_;
+            allocator_ = that.allocator_;
+            length_ = that.length_;
+            units_ = that.units_;
+            flags_ = that.flags_;
+
+            that.data_ = that.inline_;
+            that.inline_[0] = 0;
+            that.len_ = 1;
+            that.length_ = that.units_ = 0;
+            that.flags_ = text_flags::of_empty();
+        }
+
         size_t len_{};
         char16_t * data_{};
+        size_t length_{};
+        size_t units_{};
+        const utf_allocator* allocator_{ heap_allocator() };
+        uint8_t flags_{};
+        char16_t inline_[inline_capacity];
     };
 
+    static_assert(sizeof(utf16_string) <= 128);
+
+    /*
+    factories, from the zero terminated or the counted source of any encoding
+    the counted ones take the allocator, zero terminated ones use the heap
+    */
+    inline utf8_string make_utf8_string(const char* src, size_t units, const utf_allocator* allocator = heap_allocator()) {
+        return utf8_string(src, units, allocator);
+    }
+    inline utf8_string make_utf8_string(const char* src) {
+        return utf8_string(src, strlen(src));
+    }
+    inline utf8_string make_utf8_string(const char16_t* src, size_t units, const utf_allocator* allocator = heap_allocator()) {
+        return utf8_string(src, units, allocator);
+    }
+    inline utf8_string make_utf8_string(const char16_t* src) {
+        return utf8_string(src, strlen_16(src));
+    }
+    inline utf8_string make_utf8_string(const char32_t* src, size_t units, const utf_allocator* allocator = heap_allocator()) {
+        return utf8_string(src, units, allocator);
+    }
+    inline utf8_string make_utf8_string(const char32_t* src) {
+        return utf8_string(src, strlen_32(src));
+    }
+
+    inline utf16_string make_utf16_string(const char* src, size_t units, const utf_allocator* allocator = heap_allocator()) {
+        return utf16_string(src, units, allocator);
+    }
+    inline utf16_string make_utf16_string(const char* src) {
+        return utf16_string(src, strlen(src));
+    }
+    inline utf16_string make_utf16_string(const char16_t* src, size_t units, const utf_allocator* allocator = heap_allocator()) {
+        return utf16_string(src, units, allocator);
+    }
+    inline utf16_string make_utf16_string(const char16_t* src) {
+        return utf16_string(src, strlen_16(src));
+    }
+    inline utf16_string make_utf16_string(const char32_t* src, size_t units, const utf_allocator* allocator = heap_allocator()) {
+        return utf16_string(src, units, allocator);
+    }
+    inline utf16_string make_utf16_string(const char32_t* src) {
+        return utf16_string(src, strlen_32(src));
+    }
+
+    inline utf32_string make_utf32_string(const char* src, size_t units, const utf_allocator* allocator = heap_allocator()) {
+        return utf32_string(src, units, allocator);
+    }
+    inline utf32_string make_utf32_string(const char* src) {
+        return utf32_string(src, strlen(src));
+    }
+    inline utf32_string make_utf32_string(const char16_t* src, size_t units, const utf_allocator* allocator = heap_allocator()) {
+        return utf32_string(src, units, allocator);
+    }
+    inline utf32_string make_utf32_string(const char16_t* src) {
+        return utf32_string(src, strlen_16(src));
+    }
+    inline utf32_string make_utf32_string(const char32_t* src, size_t units, const utf_allocator* allocator = heap_allocator()) {
+        return utf32_string(src, units, allocator);
+    }
+    inline utf32_string make_utf32_string(const char32_t* src) {
+        return utf32_string(src);
+    }
+
+    /*
+    same value for the same text, whatever the string type, see dbj_utf_hash.h
+    */
+    inline uint64_t hash_text(const utf8_string& src, uint64_t seed = 0) noexcept {
+        return hash_text(src.get(), src.bytes(), seed);
+    }
+    inline uint64_t hash_text(const utf16_string& src, uint64_t seed = 0) noexcept {
+        return hash_text(reinterpret_cast<const char16_t*>(src.get()), src.units(), seed);
+    }
+    inline uint64_t hash_text(const utf32_string& src, uint64_t seed = 0) noexcept {
+        return hash_text(src.get(), src.length(), seed);
+    }
+
 } // namespace dbj::utf
 #endif // !DBJ_UTF_CPP_INC
-
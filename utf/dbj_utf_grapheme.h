@@ -0,0 +1,327 @@
+#pragma once
+#ifndef DBJ_UTF_GRAPHEME_INC
+#define DBJ_UTF_GRAPHEME_INC
+
+#include "dbj_utf_utils.h"
+#include "dbj_utf_grapheme_tables.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Extended grapheme cluster segmentation, as per UAX #29
+https://www.unicode.org/reports/tr29/
+
+Cluster is what user sees as one character: emoji ZWJ sequences,
+flags, base + combining marks, CR LF, Hangul syllables ...
+Cursor movement, truncation and width must be done per cluster,
+not per code point.
+
+Table driven. Grapheme_Cluster_Break class of the code point comes from the
+generated trie (utf/tools/dbj_ucd_gen.py). The pair rules GB3 .. GB999 are
+folded in one class x class table at compile time. Only GB11 (emoji ZWJ
+sequences) and GB12/13 (flags) need a bit of state beside the previous class.
+
+ASCII followed by ASCII is a boundary, except CR LF. Thus for ASCII text
+iterators emit one cluster per byte without any table lookup.
+
+    using namespace dbj::utf;
+    utf8_grapheme_iterator it(text, text_size);
+    size_t offset{}, length{};
+    while (it.next(offset, length)) {
+        // text + offset is the start of the cluster, length is in bytes
+    }
+
+    size_t clusters = count_grapheme_clusters(text, text_size);
+*/
+
+namespace dbj::utf {
+
+    // must match the generator
+    enum class grapheme_class : uint8_t {
+        Other, CR, LF, Control, Extend, ZWJ, Regional_Indicator,
+        Prepend, SpacingMark, L, V, T, LV, LVT,
+        Extended_Pictographic,
+        count_
+    };
+
+    inline grapheme_class grapheme_class_of(char32_t cp) noexcept
+    {
+        using namespace detail;
+
+        if (cp > 0x10FFFF)
+            return grapheme_class::Other;
+
+        const unsigned i2 = (unsigned(grapheme_stage1[cp >> (grapheme_shift2 + grapheme_shift3)]) << grapheme_shift2)
+            | ((cp >> grapheme_shift3) & ((1u << grapheme_shift2) - 1));
+        const unsigned i3 = (unsigned(grapheme_stage2[i2]) << grapheme_shift3)
+            | (cp & ((1u << grapheme_shift3) - 1));
+
+        return grapheme_class(grapheme_stage3[i3]);
+    }
+
+    namespace detail {
+
+        // no table for ASCII
+        constexpr grapheme_class grapheme_class_of_ascii(unsigned char c) noexcept
+        {
+            return c == '\r' ? grapheme_class::CR
+                : c == '\n' ? grapheme_class::LF
+                : (c < 0x20 || c == 0x7F) ? grapheme_class::Control
+                : grapheme_class::Other;
+        }
+
+        enum grapheme_rule : uint8_t {
+            grapheme_break = 0,
+            grapheme_join,
+            grapheme_join_if_emoji_zwj, // GB11
+            grapheme_join_if_odd_ri     // GB12, GB13
+        };
+
+        constexpr grapheme_rule grapheme_pair_rule(grapheme_class prev, grapheme_class next) noexcept
+        {
+            using gc = grapheme_class;
+
+            auto is_control = [](gc c) { return c == gc::CR || c == gc::LF || c == gc::Control; };
+
+            // GB3
+            if (prev == gc::CR && next == gc::LF) return grapheme_join;
+            // GB4, GB5
+            if (is_control(prev) || is_control(next)) return grapheme_break;
+            // GB6
+            if (prev == gc::L && (next == gc::L || next == gc::V || next == gc::LV || next == gc::LVT))
+                return grapheme_join;
+            // GB7
+            if ((prev == gc::LV || prev == gc::V) && (next == gc::V || next == gc::T))
+                return grapheme_join;
+            // GB8
+            if ((prev == gc::LVT || prev == gc::T) && next == gc::T)
+                return grapheme_join;
+            // GB9, GB9a
+            if (next == gc::Extend || next == gc::ZWJ || next == gc::SpacingMark)
+                return grapheme_join;
+            // GB9b
+            if (prev == gc::Prepend)
+                return grapheme_join;
+            // GB11
+            if (prev == gc::ZWJ && next == gc::Extended_Pictographic)
+                return grapheme_join_if_emoji_zwj;
+            // GB12, GB13
+            if (prev == gc::Regional_Indicator && next == gc::Regional_Indicator)
+                return grapheme_join_if_odd_ri;
+            // GB999
+            return grapheme_break;
+        }
+
+        constexpr unsigned grapheme_class_count = unsigned(grapheme_class::count_);
+
+        struct grapheme_rules_table final {
+            uint8_t rule[grapheme_class_count][grapheme_class_count];
+        };
+
+        constexpr grapheme_rules_table make_grapheme_rules() noexcept
+        {
+            grapheme_rules_table table{};
+            for (unsigned p = 0; p < grapheme_class_count; ++p)
+                for (unsigned n = 0; n < grapheme_class_count; ++n)
+                    table.rule[p][n] = grapheme_pair_rule(grapheme_class(p), grapheme_class(n));
+            return table;
+        }
+
+        inline constexpr grapheme_rules_table grapheme_rules = make_grapheme_rules();
+
+    } // detail
+
+    /*
+    feed it the classes of consecutive code points, it tells where the boundaries are
+    */
+    class grapheme_breaker final {
+    public:
+        explicit grapheme_breaker(grapheme_class first) noexcept { reset(first); }
+
+        void reset(grapheme_class first) noexcept
+        {
+            prev_ = first;
+            emoji_ = (first == grapheme_class::Extended_Pictographic);
+            emoji_zwj_ = false;
+            odd_ri_ = (first == grapheme_class::Regional_Indicator);
+        }
+
+        // true if there is a cluster boundary in front of next
+        bool breaks_before(grapheme_class next) noexcept
+        {
+            bool boundary = false;
+
+            switch (detail::grapheme_rules.rule[unsigned(prev_)][unsigned(next)]) {
+            case detail::grapheme_break: boundary = true; break;
+            case detail::grapheme_join_if_emoji_zwj: boundary = !emoji_zwj_; break;
+            case detail::grapheme_join_if_odd_ri: boundary = !odd_ri_; break;
+            default: break;
+            }
+
+            // ExtPict Extend* ZWJ
+            emoji_zwj_ = emoji_ && next == grapheme_class::ZWJ;
+            emoji_ = next == grapheme_class::Extended_Pictographic
+                || (emoji_ && next == grapheme_class::Extend);
+            odd_ri_ = next == grapheme_class::Regional_Indicator && !(prev_ == grapheme_class::Regional_Indicator && odd_ri_);
+
+            prev_ = next;
+            return boundary;
+        }
+
+    private:
+        grapheme_class prev_;
+        bool emoji_;
+        bool emoji_zwj_;
+        bool odd_ri_;
+    };
+
+    namespace detail {
+
+        // length in bytes of the cluster starting at src, src < end
+        inline size_t grapheme_length_utf8(const char* src, const char* end) noexcept
+        {
+            const unsigned char lead = (unsigned char)src[0];
+
+            if (lead < 0x80) {
+                if (src + 1 == end)
+                    return 1;
+                const unsigned char next = (unsigned char)src[1];
+                if (next < 0x80)
+                    return (lead == '\r' && next == '\n') ? 2 : 1;
+            }
+
+            char32_t cp{};
+            const char* walker = src + decode_utf8(src, end, cp);
+            grapheme_breaker breaker(lead < 0x80 ? grapheme_class_of_ascii(lead) : grapheme_class_of(cp));
+
+            while (walker < end) {
+                const unsigned char c = (unsigned char)*walker;
+                const unsigned step = decode_utf8(walker, end, cp);
+                if (breaker.breaks_before(c < 0x80 ? grapheme_class_of_ascii(c) : grapheme_class_of(cp)))
+                    break;
+                walker += step;
+            }
+            return size_t(walker - src);
+        }
+
+        // length in code points of the cluster starting at src, src < end
+        inline size_t grapheme_length_utf32(const char32_t* src, const char32_t* end) noexcept
+        {
+            if (src[0] < 0x80) {
+                if (src + 1 == end)
+                    return 1;
+                if (src[1] < 0x80)
+                    return (src[0] == '\r' && src[1] == '\n') ? 2 : 1;
+            }
+
+            auto class_of = [](char32_t cp) {
+                return cp < 0x80 ? grapheme_class_of_ascii((unsigned char)cp) : grapheme_class_of(cp);
+            };
+
+            const char32_t* walker = src + 1;
+            grapheme_breaker breaker(class_of(src[0]));
+
+            while (walker < end && !breaker.breaks_before(class_of(*walker)))
+                ++walker;
+
+            return size_t(walker - src);
+        }
+    } // detail
+
+    /*
+    clusters of the utf8 buffer, offsets and lengths are in bytes
+    */
+    class utf8_grapheme_iterator final {
+    public:
+        utf8_grapheme_iterator(const char* data, size_t size) noexcept
+            : data_(data), size_(size), pos_(0)
+        {
+        }
+
+        bool next(size_t& offset, size_t& length) noexcept
+        {
+            if (pos_ >= size_)
+                return false;
+            offset = pos_;
+            length = detail::grapheme_length_utf8(data_ + pos_, data_ + size_);
+            pos_ += length;
+            return true;
+        }
+
+        size_t position() const noexcept { return pos_; }
+
+    private:
+        const char* data_;
+        size_t size_;
+        size_t pos_;
+    };
+
+    /*
+    clusters of the utf32 buffer, offsets and lengths are in code points
+    */
+    class utf32_grapheme_iterator final {
+    public:
+        utf32_grapheme_iterator(const char32_t* data, size_t size) noexcept
+            : data_(data), size_(size), pos_(0)
+        {
+        }
+
+        bool next(size_t& offset, size_t& length) noexcept
+        {
+            if (pos_ >= size_)
+                return false;
+            offset = pos_;
+            length = detail::grapheme_length_utf32(data_ + pos_, data_ + size_);
+            pos_ += length;
+            return true;
+        }
+
+        size_t position() const noexcept { return pos_; }
+
+    private:
+        const char32_t* data_;
+        size_t size_;
+        size_t pos_;
+    };
+
+    inline size_t count_grapheme_clusters(const char* data, size_t size) noexcept
+    {
+        const char* walker = data;
+        const char* end = data + size;
+        size_t count = 0;
+
+        while (walker < end) {
+            // ASCII run, one cluster per byte but CR LF
+            while (walker + 1 < end && (unsigned char)walker[0] < 0x80 && (unsigned char)walker[1] < 0x80) {
+                walker += (walker[0] == '\r' && walker[1] == '\n') ? 2 : 1;
+                ++count;
+            }
+            if (walker < end) {
+                walker += detail::grapheme_length_utf8(walker, end);
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    inline size_t count_grapheme_clusters(const char32_t* data, size_t size) noexcept
+    {
+        const char32_t* walker = data;
+        const char32_t* end = data + size;
+        size_t count = 0;
+
+        while (walker < end) {
+            while (walker + 1 < end && walker[0] < 0x80 && walker[1] < 0x80) {
+                walker += (walker[0] == '\r' && walker[1] == '\n') ? 2 : 1;
+                ++count;
+            }
+            if (walker < end) {
+                walker += detail::grapheme_length_utf32(walker, end);
+                ++count;
+            }
+        }
+        return count;
+    }
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_GRAPHEME_INC
@@ -0,0 +1,568 @@
+#pragma once
+#ifndef DBJ_UTF_GRAPHEME_TABLES_INC
+#define DBJ_UTF_GRAPHEME_TABLES_INC
+/*
+    GENERATED by utf/tools/dbj_ucd_gen.py -- do not edit
+    Unicode 14.0.0
+
+    Grapheme_Cluster_Break property with Extended_Pictographic folded in
+    as one more class, 8624 bytes in total
+*/
+#include <stdint.h>
+
+namespace dbj::utf::detail {
+
+    inline constexpr unsigned grapheme_shift2 = 6;
+    inline constexpr unsigned grapheme_shift3 = 3;
+
+    inline constexpr uint8_t grapheme_stage1[2176] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 10,
+        15, 16, 17, 18, 19, 20, 21, 10, 22, 23, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 27, 28, 29,
+        30, 31, 32, 33, 27, 28, 29, 30, 31, 32, 33, 34, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 35, 10, 36,
+        37, 38, 10, 10, 10, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 50, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 51, 10, 52, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 53, 10,
+        10, 10, 10, 10, 10, 10, 10, 54, 55, 56, 10, 10, 10, 57, 10, 10,
+        58, 59, 10, 10, 60, 10, 10, 10, 61, 62, 63, 64, 65, 66, 67, 68,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        69, 70, 70, 70, 70, 70, 70, 70, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    };
+
+    inline constexpr uint8_t grapheme_stage2[4544] = {
+        0, 1, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+        0, 0, 0, 0, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        6, 7, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 8, 5, 5, 5, 5, 9, 10, 2, 2, 2, 2, 2, 2, 2,
+        11, 2, 5, 12, 2, 2, 2, 2, 2, 6, 5, 5, 2, 2, 13, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 15, 16, 17, 2, 2,
+        2, 18, 19, 2, 2, 2, 5, 5, 5, 20, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 14, 5, 13, 2, 2, 2, 2, 2, 2, 6, 21, 22,
+        2, 2, 14, 23, 24, 25, 2, 2, 2, 2, 2, 26, 2, 2, 2, 2,
+        2, 2, 27, 5, 2, 2, 2, 2, 2, 28, 5, 5, 29, 5, 5, 5,
+        30, 2, 2, 2, 2, 2, 2, 31, 32, 33, 8, 2, 34, 2, 2, 2,
+        35, 2, 2, 2, 2, 2, 2, 36, 37, 38, 39, 2, 34, 2, 2, 40,
+        41, 2, 2, 2, 2, 2, 2, 42, 43, 44, 19, 2, 2, 2, 45, 2,
+        41, 2, 2, 2, 2, 2, 2, 42, 46, 47, 2, 2, 34, 2, 2, 28,
+        35, 2, 2, 2, 2, 2, 2, 48, 37, 38, 49, 2, 34, 2, 2, 2,
+        50, 2, 2, 2, 2, 2, 2, 51, 52, 53, 39, 2, 2, 2, 2, 2,
+        54, 2, 2, 2, 2, 2, 2, 48, 55, 17, 56, 2, 34, 2, 2, 2,
+        35, 2, 2, 2, 2, 2, 2, 57, 58, 59, 56, 2, 34, 2, 2, 2,
+        60, 2, 2, 2, 2, 2, 2, 61, 62, 63, 39, 2, 34, 2, 2, 2,
+        35, 2, 2, 2, 2, 2, 2, 2, 2, 64, 65, 66, 2, 2, 67, 2,
+        2, 2, 2, 2, 2, 2, 68, 20, 39, 69, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 68, 70, 2, 71, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 7, 2, 2, 72, 73, 2, 2, 2, 2, 2, 2, 8, 74,
+        75, 49, 5, 8, 5, 5, 5, 70, 40, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 49, 76, 77, 2, 2, 78, 79, 13, 2, 80, 2,
+        81, 22, 2, 22, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 49, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 85, 2, 2, 2, 86, 2, 2, 2, 34, 2, 2, 2, 34, 2,
+        2, 2, 2, 2, 2, 2, 87, 88, 89, 32, 21, 22, 2, 2, 2, 2,
+        2, 90, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        56, 2, 2, 2, 2, 19, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 91, 92, 93, 94, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 39, 95, 2, 2, 2, 2, 2, 2, 96, 69, 97, 98, 99, 16,
+        2, 2, 2, 2, 2, 2, 5, 5, 5, 69, 2, 2, 2, 2, 2, 2,
+        100, 2, 2, 2, 2, 2, 101, 102, 103, 2, 2, 2, 2, 6, 21, 2,
+        104, 2, 2, 2, 105, 106, 2, 2, 2, 2, 2, 2, 51, 107, 60, 2,
+        2, 2, 2, 2, 108, 109, 110, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 111, 5, 76, 112, 113, 7,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5, 5, 5, 5, 5,
+        2, 114, 2, 2, 2, 115, 2, 116, 2, 117, 2, 2, 0, 0, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5, 13, 2,
+        2, 2, 2, 2, 118, 2, 2, 117, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 119, 120, 2, 121, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 122, 2, 123, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 123, 2, 2, 2, 2, 2, 2, 2, 124, 2, 2, 2, 125, 126, 127,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 118, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 122, 128, 2, 123, 2, 2, 2, 2, 2, 2, 129,
+        130, 131, 132, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        133, 2, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        133, 131, 134, 135, 117, 123, 136, 2, 137, 138, 139, 2, 140, 2, 2, 2,
+        2, 2, 141, 2, 117, 2, 123, 124, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 142, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        141, 2, 2, 136, 2, 2, 2, 2, 2, 2, 143, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 39, 7, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 39,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5,
+        2, 2, 2, 2, 2, 28, 123, 135, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 144, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 124, 117, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 39, 111, 71,
+        2, 2, 2, 14, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        145, 146, 2, 2, 147, 148, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        149, 2, 2, 2, 2, 2, 108, 150, 151, 2, 2, 2, 5, 5, 7, 39,
+        2, 2, 2, 2, 14, 71, 2, 2, 39, 5, 60, 2, 82, 82, 82, 152,
+        30, 2, 2, 2, 2, 2, 153, 154, 155, 2, 2, 2, 22, 2, 2, 2,
+        2, 2, 2, 2, 2, 156, 157, 2, 146, 158, 2, 2, 2, 2, 2, 148,
+        2, 2, 2, 2, 2, 2, 159, 160, 19, 2, 2, 2, 2, 161, 162, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 163, 164, 2, 2,
+        165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166,
+        166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167,
+        166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166,
+        166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165,
+        166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166,
+        167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166,
+        166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166,
+        165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166,
+        166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167,
+        166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166,
+        166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165,
+        166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166,
+        167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166,
+        166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166,
+        165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166,
+        166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167,
+        166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166,
+        166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165,
+        166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166,
+        167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166,
+        166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166,
+        165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166,
+        166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167,
+        166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166,
+        166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165,
+        166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166,
+        167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166,
+        166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166,
+        165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166,
+        166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167,
+        166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166,
+        166, 165, 166, 166, 168, 2, 83, 83, 169, 170, 84, 84, 84, 84, 84, 171,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 40, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        5, 5, 2, 2, 5, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 14, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 172,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 22,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 13, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 20,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        173, 101, 2, 2, 2, 2, 2, 174, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 56, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 101, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 175, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 14, 5, 13, 2, 2, 2, 2, 2,
+        176, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        177, 2, 2, 2, 2, 2, 2, 5, 69, 2, 2, 2, 2, 2, 178, 39,
+        104, 2, 2, 2, 2, 2, 179, 180, 50, 181, 2, 2, 2, 2, 2, 2,
+        20, 2, 2, 2, 39, 182, 70, 2, 183, 2, 2, 2, 2, 2, 146, 2,
+        104, 2, 2, 2, 2, 2, 184, 74, 185, 186, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 187, 188, 40, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 39, 99, 20, 2, 2,
+        60, 2, 2, 2, 2, 2, 2, 61, 189, 190, 39, 2, 191, 70, 70, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 192, 5, 193, 2, 2, 40, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 194, 195, 196, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 39, 197, 198, 13, 2, 2, 199, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 99, 200, 13, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 201, 202, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 49, 203, 21, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 187, 5, 204, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 205, 206, 207, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 208, 209, 210, 2, 2, 2,
+        8, 20, 2, 2, 2, 2, 6, 211, 39, 2, 156, 94, 2, 2, 2, 2,
+        212, 213, 74, 7, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 214, 69, 202, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 28, 5, 5, 215, 216, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 217, 218, 219, 2, 2, 2, 2, 2, 2, 2,
+        2, 220, 221, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 222, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 0, 223, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 70, 2,
+        2, 2, 2, 2, 2, 2, 69, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 39, 224, 150, 150, 150, 150, 150,
+        150, 39, 20, 2, 2, 2, 2, 2, 2, 2, 2, 2, 148, 2, 149, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 56, 172, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        5, 5, 5, 5, 5, 71, 5, 5, 69, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 225, 226, 227, 228,
+        229, 21, 2, 2, 2, 176, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 230, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        5, 5, 5, 5, 5, 5, 69, 6, 5, 5, 5, 5, 5, 70, 22, 2,
+        148, 2, 2, 6, 8, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        69, 5, 5, 231, 232, 20, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 69, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 40, 2, 2, 2, 2, 2, 2, 2, 101, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 69, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 101, 20, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        2, 141, 2, 2, 2, 124, 2, 2, 2, 2, 2, 2, 2, 119, 120, 233,
+        2, 128, 125, 127, 2, 141, 131, 131, 131, 131, 131, 131, 234, 235, 235, 235,
+        125, 131, 2, 118, 2, 124, 236, 132, 2, 125, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 237,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 133, 233, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 2, 2, 2, 2, 2, 2,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 119, 131,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 141, 131, 131, 131, 131, 131,
+        2, 119, 2, 2, 2, 2, 2, 2, 2, 131, 2, 236, 2, 2, 2, 2,
+        2, 131, 2, 2, 2, 233, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        2, 119, 131, 131, 131, 131, 131, 132, 130, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 133,
+        0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    inline constexpr uint8_t grapheme_stage3[1904] = {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 1, 3, 3,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+        0, 14, 0, 0, 0, 3, 14, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+        0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+        0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4,
+        0, 4, 4, 0, 4, 4, 0, 4, 7, 7, 7, 7, 7, 7, 0, 0,
+        4, 4, 4, 0, 3, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 7, 0, 4,
+        4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 4, 4, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 7, 0, 4, 0, 0, 0, 0, 0, 0,
+        4, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 4, 0, 0, 4, 4, 0, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0,
+        0, 4, 4, 4, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0,
+        0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4,
+        4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 4, 8, 4, 0, 8, 8,
+        8, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 4, 8, 8,
+        0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 8, 8, 0, 0, 0, 0,
+        0, 0, 0, 0, 4, 0, 4, 8, 8, 4, 4, 4, 4, 0, 0, 8,
+        8, 0, 0, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        0, 0, 0, 0, 0, 0, 4, 0, 0, 4, 4, 8, 0, 0, 0, 0,
+        0, 0, 0, 0, 4, 0, 8, 8, 8, 4, 4, 0, 0, 0, 0, 4,
+        4, 0, 0, 4, 4, 4, 0, 0, 4, 4, 0, 0, 0, 4, 0, 0,
+        8, 4, 4, 4, 4, 4, 0, 4, 4, 8, 0, 8, 8, 4, 0, 0,
+        0, 0, 0, 0, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4,
+        0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8,
+        4, 8, 8, 0, 0, 0, 8, 8, 8, 0, 8, 8, 8, 4, 0, 0,
+        4, 8, 8, 8, 4, 0, 0, 0, 4, 8, 8, 8, 8, 0, 4, 4,
+        0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 0, 8, 4,
+        8, 8, 4, 8, 8, 0, 4, 8, 8, 0, 8, 8, 4, 4, 0, 0,
+        4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 4, 8,
+        8, 4, 4, 4, 4, 0, 8, 8, 8, 0, 8, 8, 8, 4, 7, 0,
+        0, 0, 4, 0, 0, 0, 0, 4, 8, 8, 4, 4, 4, 0, 4, 0,
+        8, 8, 8, 8, 8, 8, 8, 4, 0, 0, 8, 8, 0, 0, 0, 0,
+        0, 4, 0, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+        4, 4, 4, 4, 4, 0, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0,
+        0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 8, 8,
+        4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 0, 4, 4,
+        4, 8, 4, 4, 4, 4, 4, 4, 0, 4, 4, 8, 8, 4, 4, 0,
+        0, 0, 0, 0, 0, 0, 8, 8, 4, 4, 0, 0, 0, 0, 4, 4,
+        0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 4, 0, 8, 4, 4, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10,
+        11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 4, 4, 4, 8, 0, 0,
+        0, 0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 4,
+        4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 8, 8, 8, 8, 4, 8,
+        0, 0, 0, 4, 4, 4, 3, 4, 4, 4, 4, 8, 8, 8, 8, 4,
+        4, 8, 8, 8, 0, 0, 0, 0, 8, 8, 4, 8, 8, 8, 8, 8,
+        8, 4, 4, 4, 0, 0, 0, 0, 4, 8, 8, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 8, 4, 8, 4, 0, 4, 0, 0, 4, 4, 4,
+        4, 4, 4, 4, 4, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+        4, 4, 4, 8, 4, 8, 8, 8, 8, 8, 4, 8, 8, 0, 0, 0,
+        4, 4, 8, 0, 0, 0, 0, 0, 0, 8, 4, 4, 4, 4, 8, 8,
+        4, 4, 8, 4, 4, 4, 0, 0, 4, 4, 8, 8, 8, 4, 8, 4,
+        0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4,
+        4, 4, 4, 4, 8, 8, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4,
+        4, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 4, 0, 0, 8,
+        0, 0, 0, 3, 4, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+        0, 0, 0, 0, 14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+        0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14,
+        14, 14, 0, 0, 0, 0, 0, 0, 0, 14, 14, 0, 0, 0, 0, 0,
+        0, 0, 14, 14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 14, 0, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 0, 0, 0, 0, 14, 14, 14, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 14, 14, 14, 14, 0,
+        14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+        14, 14, 14, 0, 14, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+        0, 0, 0, 14, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14,
+        0, 0, 0, 0, 14, 0, 14, 0, 0, 0, 0, 14, 14, 14, 0, 14,
+        0, 0, 0, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 14, 14, 14,
+        0, 0, 0, 0, 14, 14, 0, 0, 14, 0, 0, 0, 0, 14, 0, 0,
+        0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 4, 0,
+        0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 8, 8, 4, 4, 8,
+        0, 0, 0, 0, 4, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0, 0,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 0, 0,
+        9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 4, 8, 8, 4, 4,
+        4, 4, 8, 8, 4, 4, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0,
+        0, 4, 4, 4, 4, 4, 4, 8, 8, 4, 4, 8, 8, 4, 4, 0,
+        0, 0, 0, 0, 4, 8, 0, 0, 4, 0, 4, 4, 4, 0, 0, 4,
+        4, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 8, 4, 4, 8, 8,
+        0, 0, 0, 0, 0, 8, 4, 0, 0, 0, 0, 8, 8, 4, 8, 8,
+        4, 8, 8, 0, 8, 4, 0, 0, 12, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13,
+        13, 13, 13, 13, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 0,
+        0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0,
+        3, 3, 3, 3, 0, 0, 0, 0, 0, 4, 4, 4, 0, 4, 4, 0,
+        4, 4, 4, 0, 0, 0, 0, 4, 0, 0, 0, 4, 4, 0, 0, 0,
+        0, 0, 4, 4, 4, 4, 0, 0, 8, 4, 8, 0, 0, 0, 0, 0,
+        4, 0, 0, 4, 4, 0, 0, 0, 8, 8, 8, 4, 4, 4, 4, 8,
+        8, 4, 4, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0,
+        4, 4, 4, 4, 8, 4, 4, 4, 0, 0, 0, 0, 0, 8, 8, 0,
+        0, 0, 0, 8, 8, 8, 4, 4, 8, 0, 7, 7, 0, 0, 0, 0,
+        0, 4, 4, 4, 4, 0, 8, 4, 0, 0, 0, 0, 8, 8, 8, 4,
+        4, 4, 8, 8, 4, 8, 4, 4, 4, 8, 8, 8, 8, 0, 0, 8,
+        8, 0, 0, 8, 8, 8, 0, 0, 0, 0, 8, 8, 0, 0, 4, 4,
+        0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 4, 4, 4, 8, 4, 0,
+        4, 8, 8, 4, 4, 4, 4, 4, 4, 8, 4, 8, 8, 4, 8, 4,
+        4, 8, 4, 4, 0, 0, 0, 0, 8, 8, 4, 4, 4, 4, 0, 0,
+        8, 8, 8, 8, 4, 4, 8, 4, 0, 0, 0, 0, 4, 4, 0, 0,
+        4, 4, 4, 8, 8, 4, 8, 4, 0, 0, 0, 4, 8, 4, 8, 8,
+        4, 4, 4, 4, 4, 4, 8, 4, 0, 0, 4, 4, 4, 4, 8, 4,
+        8, 4, 4, 0, 0, 0, 0, 0, 4, 8, 8, 8, 8, 8, 0, 8,
+        8, 0, 0, 4, 4, 8, 4, 7, 8, 7, 8, 4, 0, 0, 0, 0,
+        0, 8, 8, 8, 4, 4, 4, 4, 0, 0, 4, 4, 8, 8, 8, 8,
+        4, 0, 0, 0, 8, 0, 0, 0, 4, 8, 7, 4, 4, 4, 4, 0,
+        0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 4, 4, 4, 4, 4, 4,
+        0, 0, 0, 0, 0, 0, 0, 8, 0, 8, 4, 4, 4, 4, 4, 4,
+        4, 8, 4, 4, 8, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 0,
+        0, 0, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+        0, 0, 8, 8, 8, 8, 8, 0, 4, 4, 0, 8, 8, 4, 8, 4,
+        0, 0, 0, 4, 4, 8, 8, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+        0, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 4, 8, 4,
+        4, 4, 0, 0, 0, 8, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3,
+        3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4,
+        0, 0, 4, 4, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 4,
+        4, 4, 0, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 0, 14, 14,
+        14, 14, 14, 14, 14, 14, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 4, 4, 4, 4, 4,
+    };
+
+} // dbj::utf::detail
+
+#endif // !DBJ_UTF_GRAPHEME_TABLES_INC
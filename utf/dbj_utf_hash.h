@@ -0,0 +1,378 @@
+#pragma once
+#ifndef DBJ_UTF_HASH_INC
+#define DBJ_UTF_HASH_INC
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "dbj_utf_simd.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Fast 64 bit non cryptographic hashing of the byte buffers.
+
+Algorithm is after wyhash by Wang Yi, public domain
+https://github.com/wangyi-fudan/wyhash
+its multiply-mix rounds and schedule, with the older secret constants.
+Values are NOT those of any published wyhash version, they are only
+stable between the releases of this header.
+
+NOT for hash flooding resistance, seed it if the keys come from the outside.
+
+hash_text() gives the same value for the same text in utf8, utf16 or utf32:
+it is hash_bytes() of the utf8 form, made on the fly, nothing is allocated.
+
+    hash_text("Zürich", 7) == hash_text(u"Zürich", 6) == hash_text(U"Zürich", 6)
+
+For valid text that holds always. Unpaired surrogates and values above
+U+10FFFF in utf16/utf32 are hashed as U+FFFD. utf8 is hashed as it is.
+
+utf16/utf32 runs of ASCII are narrowed 8 or 4 units at once, with SSE2.
+*/
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace dbj::utf {
+
+    namespace detail {
+
+        inline constexpr uint64_t wy_secret[4] = {
+            0xa0761d6478bd642full, 0xe7037ed1a0b428dbull,
+            0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull
+        };
+
+        // 64 x 64 -> 128 multiply, a gets the low and b the high half
+        inline void wy_mum(uint64_t& a, uint64_t& b) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            __uint128_t r = (__uint128_t)a * b;
+            a = (uint64_t)r;
+            b = (uint64_t)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            a = _umul128(a, b, &b);
+#else
+            const uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+            const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+            const uint64_t t = rl + (rm0 << 32);
+            uint64_t c = t < rl;
+            const uint64_t lo = t + (rm1 << 32);
+            c += lo < t;
+            const uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+            a = lo;
+            b = hi;
+#endif
+        }
+
+        inline uint64_t wy_mix(uint64_t a, uint64_t b) noexcept
+        {
+            wy_mum(a, b);
+            return a ^ b;
+        }
+
+        inline uint64_t wy_read8(const uint8_t* p) noexcept
+        {
+            uint64_t v;
+            memcpy(&v, p, 8);
+            return v;
+        }
+
+        inline uint64_t wy_read4(const uint8_t* p) noexcept
+        {
+            uint32_t v;
+            memcpy(&v, p, 4);
+            return v;
+        }
+
+        inline uint64_t wy_read3(const uint8_t* p, size_t k) noexcept
+        {
+            return (((uint64_t)p[0]) << 16) | (((uint64_t)p[k >> 1]) << 8) | p[k - 1];
+        }
+
+    } // detail
+
+    inline uint64_t hash_bytes(const void* key, size_t len, uint64_t seed = 0) noexcept
+    {
+        using namespace detail;
+
+        const uint8_t* p = (const uint8_t*)key;
+        const uint64_t* secret = wy_secret;
+        uint64_t a{}, b{};
+
+        seed ^= wy_mix(seed ^ secret[0], secret[1]);
+
+        if (len <= 16) {
+            if (len >= 4) {
+                a = (wy_read4(p) << 32) | wy_read4(p + ((len >> 3) << 2));
+                b = (wy_read4(p + len - 4) << 32) | wy_read4(p + len - 4 - ((len >> 3) << 2));
+            }
+            else if (len > 0) {
+                a = wy_read3(p, len);
+                b = 0;
+            }
+        }
+        else {
+            size_t i = len;
+            if (i > 48) {
+                uint64_t see1 = seed, see2 = seed;
+                do {
+                    seed = wy_mix(wy_read8(p) ^ secret[1], wy_read8(p + 8) ^ seed);
+                    see1 = wy_mix(wy_read8(p + 16) ^ secret[2], wy_read8(p + 24) ^ see1);
+                    see2 = wy_mix(wy_read8(p + 32) ^ secret[3], wy_read8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= see1 ^ see2;
+            }
+            while (i > 16) {
+                seed = wy_mix(wy_read8(p) ^ secret[1], wy_read8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = wy_read8(p + i - 16);
+            b = wy_read8(p + i - 8);
+        }
+
+        a ^= secret[1];
+        b ^= seed;
+        wy_mum(a, b);
+        return wy_mix(a ^ secret[0] ^ len, b ^ secret[1]);
+    }
+
+    namespace detail {
+
+        /*
+        hash_bytes() of the byte stream of known length, fed in pieces
+        same schedule as hash_bytes, for len > 16
+        */
+        class wy_stream final {
+        public:
+            enum : size_t { history = 16, capacity = history + 256 };
+
+            wy_stream(size_t len, uint64_t seed) noexcept : len_(len)
+            {
+                seed_ = seed ^ wy_mix(seed ^ wy_secret[0], wy_secret[1]);
+                see1_ = see2_ = seed_;
+                end48_ = len > 48 ? ((len - 1) / 48) * 48 : 0;
+                const size_t rest = len - end48_;
+                end16_ = end48_ + (rest > 16 ? ((rest - 1) / 16) * 16 : 0);
+            }
+
+            // room for n <= 16 bytes, commit() what was written
+            uint8_t* room(size_t n) noexcept
+            {
+                if (fill_ + n > capacity)
+                    drain();
+                return buf_ + fill_;
+            }
+
+            void commit(size_t n) noexcept { fill_ += n; }
+
+            uint64_t finish() noexcept
+            {
+                drain();
+                // last 16 bytes of the stream, history makes sure they are here
+                uint64_t a = wy_read8(buf_ + fill_ - 16) ^ wy_secret[1];
+                uint64_t b = wy_read8(buf_ + fill_ - 8) ^ seed_;
+                wy_mum(a, b);
+                return wy_mix(a ^ wy_secret[0] ^ len_, b ^ wy_secret[1]);
+            }
+
+        private:
+            void drain() noexcept
+            {
+                size_t at = hist_;
+                while (fill_ - at >= 48 && done_ < end48_) {
+                    const uint8_t* p = buf_ + at;
+                    seed_ = wy_mix(wy_read8(p) ^ wy_secret[1], wy_read8(p + 8) ^ seed_);
+                    see1_ = wy_mix(wy_read8(p + 16) ^ wy_secret[2], wy_read8(p + 24) ^ see1_);
+                    see2_ = wy_mix(wy_read8(p + 32) ^ wy_secret[3], wy_read8(p + 40) ^ see2_);
+                    at += 48;
+                    done_ += 48;
+                    if (done_ == end48_)
+                        seed_ ^= see1_ ^ see2_;
+                }
+                while (fill_ - at >= 16 && done_ >= end48_ && done_ < end16_) {
+                    const uint8_t* p = buf_ + at;
+                    seed_ = wy_mix(wy_read8(p) ^ wy_secret[1], wy_read8(p + 8) ^ seed_);
+                    at += 16;
+                    done_ += 16;
+                }
+                // keep some of the hashed bytes, final read overlaps them
+                const size_t from = at > history ? at - history : 0;
+                memmove(buf_, buf_ + from, fill_ - from);
+                fill_ -= from;
+                hist_ = at - from;
+            }
+
+            uint8_t buf_[capacity];
+            size_t fill_{};
+            size_t hist_{};  // hashed bytes at the front of buf_
+            size_t done_{};  // hashed bytes in total
+            size_t len_;
+            size_t end48_;
+            size_t end16_;
+            uint64_t seed_, see1_, see2_;
+        };
+
+        // utf8 bytes of the code point, U+FFFD for the illegal ones
+        inline unsigned utf8_size_of(uint32_t cp) noexcept
+        {
+            return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : cp <= 0x10FFFF ? 4 : 3;
+        }
+
+        inline unsigned utf8_encode(uint32_t cp, uint8_t* out) noexcept
+        {
+            if ((cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF)
+                cp = 0xFFFD;
+            if (cp < 0x80) {
+                out[0] = (uint8_t)cp;
+                return 1;
+            }
+            if (cp < 0x800) {
+                out[0] = (uint8_t)(0xC0 | (cp >> 6));
+                out[1] = (uint8_t)(0x80 | (cp & 0x3F));
+                return 2;
+            }
+            if (cp < 0x10000) {
+                out[0] = (uint8_t)(0xE0 | (cp >> 12));
+                out[1] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+                out[2] = (uint8_t)(0x80 | (cp & 0x3F));
+                return 3;
+            }
+            out[0] = (uint8_t)(0xF0 | (cp >> 18));
+            out[1] = (uint8_t)(0x80 | ((cp >> 12) & 0x3F));
+            out[2] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+            out[3] = (uint8_t)(0x80 | (cp & 0x3F));
+            return 4;
+        }
+
+        // code point starting at src[u], u is moved past it
+        inline uint32_t utf16_next(const char16_t* src, size_t units, size_t& u) noexcept
+        {
+            uint32_t cp = src[u++];
+            if (cp >= 0xD800 && cp <= 0xDBFF && u < units && src[u] >= 0xDC00 && src[u] <= 0xDFFF)
+                cp = ((cp - 0xD800) << 10) + (src[u++] - 0xDC00) + 0x10000;
+            return cp;
+        }
+
+        /*
+        feeds the utf8 form of src to out, out is wy_stream or a plain buffer writer
+        */
+        template <typename Out>
+        inline void utf8_of(const char16_t* src, size_t units, Out& out) noexcept
+        {
+            size_t u = 0;
+            while (u < units) {
+#ifdef DBJ_UTF_SSE2
+                if (units - u >= 8) {
+                    const __m128i chunk = _mm_loadu_si128((const __m128i*)(src + u));
+                    const __m128i high = _mm_and_si128(chunk, _mm_set1_epi16((short)0xFF80));
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) == 0xFFFF) {
+                        _mm_storel_epi64((__m128i*)out.room(8), _mm_packus_epi16(chunk, chunk));
+                        out.commit(8);
+                        u += 8;
+                        continue;
+                    }
+                }
+#endif
+                const uint32_t cp = utf16_next(src, units, u);
+                out.commit(utf8_encode(cp, out.room(4)));
+            }
+        }
+
+        template <typename Out>
+        inline void utf8_of(const char32_t* src, size_t units, Out& out) noexcept
+        {
+            size_t u = 0;
+            while (u < units) {
+#ifdef DBJ_UTF_SSE2
+                if (units - u >= 4) {
+                    const __m128i chunk = _mm_loadu_si128((const __m128i*)(src + u));
+                    const __m128i high = _mm_and_si128(chunk, _mm_set1_epi32((int)0xFFFFFF80));
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) == 0xFFFF) {
+                        const __m128i words = _mm_packs_epi32(chunk, chunk);
+                        const int bytes = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+                        memcpy(out.room(4), &bytes, 4);
+                        out.commit(4);
+                        u += 4;
+                        continue;
+                    }
+                }
+#endif
+                out.commit(utf8_encode((uint32_t)src[u++], out.room(4)));
+            }
+        }
+
+        inline size_t utf8_length_of(const char16_t* src, size_t units) noexcept
+        {
+            size_t length = 0;
+            for (size_t u = 0; u < units;)
+                length += utf8_size_of(utf16_next(src, units, u));
+            return length;
+        }
+
+        inline size_t utf8_length_of(const char32_t* src, size_t units) noexcept
+        {
+            size_t length = 0;
+            for (size_t u = 0; u < units; ++u)
+                length += utf8_size_of((uint32_t)src[u]);
+            return length;
+        }
+
+        // writer over the stack buffer, for the short texts
+        struct utf8_writer final {
+            uint8_t* data;
+            size_t size;
+            uint8_t* room(size_t) noexcept { return data + size; }
+            void commit(size_t n) noexcept { size += n; }
+        };
+
+        template <typename C>
+        inline uint64_t hash_text(const C* src, size_t units, uint64_t seed) noexcept
+        {
+            // short texts, into one buffer
+            if (units <= 64) {
+                uint8_t buffer[64 * 4];
+                utf8_writer out{ buffer, 0 };
+                utf8_of(src, units, out);
+                return hash_bytes(buffer, out.size, seed);
+            }
+
+            const size_t len = utf8_length_of(src, units);
+            wy_stream out(len, seed);
+            utf8_of(src, units, out);
+            return out.finish();
+        }
+    } // detail
+
+    /*
+    same value for the same text, in any of the three encodings
+    */
+    inline uint64_t hash_text(const char* utf8, size_t bytes, uint64_t seed = 0) noexcept
+    {
+        return hash_bytes(utf8, bytes, seed);
+    }
+
+#ifdef __cpp_char8_t
+    // C++20 u8 literals
+    inline uint64_t hash_text(const char8_t* utf8, size_t bytes, uint64_t seed = 0) noexcept
+    {
+        return hash_bytes(utf8, bytes, seed);
+    }
+#endif
+
+    inline uint64_t hash_text(const char16_t* utf16, size_t units, uint64_t seed = 0) noexcept
+    {
+        return detail::hash_text(utf16, units, seed);
+    }
+
+    inline uint64_t hash_text(const char32_t* utf32, size_t units, uint64_t seed = 0) noexcept
+    {
+        return detail::hash_text(utf32, units, seed);
+    }
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_HASH_INC
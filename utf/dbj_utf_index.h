@@ -0,0 +1,132 @@
+#pragma once
+#ifndef DBJ_UTF_INDEX_INC
+#define DBJ_UTF_INDEX_INC
+
+#include "dbj_utf_cpp.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Sparse code point index over the utf8 buffer, for access by character
+position without the utf32 copy.
+
+    dbj::utf::utf8_index index(document, document_size);
+
+    char32_t c = index.at(1000000);
+    size_t offset{}, bytes{};
+    index.slice(500, 20, offset, bytes); // document + offset, 20 code points
+
+Byte offset of every stride-th code point is recorded, 64 by default, that
+is one size_t per 64 code points. at() and slice() start from the nearest
+entry and scan at most stride code points, 16 bytes at once with SSE2.
+
+Index does not own nor copy the buffer, it is invalid once the buffer changes.
+Code points are counted as utf8 lead bytes; illegal sequences decode as U+FFFD.
+*/
+
+namespace dbj::utf {
+
+    class utf8_index final {
+        utf8_index(const utf8_index&) = delete;
+        utf8_index& operator=(const utf8_index&) = delete;
+
+    public:
+        enum : size_t { default_stride = 64 };
+
+        utf8_index(const char* data, size_t size, size_t stride = default_stride,
+            const utf_allocator* allocator = heap_allocator())
+            : data_(data), size_(size), stride_(stride ? stride : size_t(default_stride)), allocator_(allocator)
+        {
+            length_ = simd::count_code_points(data_, size_);
+            entries_ = length_ / stride_ + 1;
+            offsets_ = static_cast<size_t*>(allocator_->allocate_or_throw(entries_ * sizeof(size_t)));
+
+            size_t offset = 0;
+            offsets_[0] = 0;
+            for (size_t e = 1; e < entries_; ++e) {
+                offset += simd::skip_code_points(data_ + offset, size_ - offset, stride_);
+                offsets_[e] = offset;
+            }
+        }
+
+        utf8_index(const utf8_string& text, size_t stride = default_stride,
+            const utf_allocator* allocator = heap_allocator())
+            : utf8_index(text.get(), text.bytes(), stride, allocator)
+        {
+        }
+
+        utf8_index(utf8_index&& that) noexcept
+            : data_(that.data_), size_(that.size_), length_(that.length_), stride_(that.stride_),
+            entries_(that.entries_), offsets_(that.offsets_), allocator_(that.allocator_)
+        {
+            that.offsets_ = nullptr;
+            that.entries_ = 0;
+        }
+
+        ~utf8_index() { allocator_->deallocate(offsets_, entries_ * sizeof(size_t)); }
+
+        const char* data() const noexcept { return data_; }
+        size_t bytes() const noexcept { return size_; }
+        // code points
+        size_t length() const noexcept { return length_; }
+        size_t stride() const noexcept { return stride_; }
+
+        // byte offset of the code point n, bytes() if n >= length()
+        size_t offset_of(size_t n) const noexcept
+        {
+            if (n >= length_)
+                return size_;
+            const size_t base = offsets_[n / stride_];
+            return base + simd::skip_code_points(data_ + base, size_ - base, n % stride_);
+        }
+
+        // code point n, 0 if out of range
+        char32_t at(size_t n) const noexcept
+        {
+            if (n >= length_)
+                return 0;
+            char32_t cp = 0;
+            const size_t offset = offset_of(n);
+            decode_utf8(data_ + offset, data_ + size_, cp);
+            return cp;
+        }
+
+        /*
+        byte range of count code points starting at first, clipped to the end
+        false if first is out of range
+        */
+        bool slice(size_t first, size_t count, size_t& byte_offset, size_t& byte_length) const noexcept
+        {
+            if (first > length_)
+                return false;
+            byte_offset = offset_of(first);
+            const size_t last = count < length_ - first ? first + count : length_;
+            // from the nearer of the two starting points
+            const size_t end = last - first <= stride_
+                ? byte_offset + simd::skip_code_points(data_ + byte_offset, size_ - byte_offset, last - first)
+                : offset_of(last);
+            byte_length = end - byte_offset;
+            return true;
+        }
+
+        // count code points starting at first, as utf8_string
+        utf8_string substring(size_t first, size_t count, const utf_allocator* allocator = heap_allocator()) const
+        {
+            size_t offset = 0, length = 0;
+            if (!slice(first, count, offset, length))
+                return utf8_string("", 0, allocator);
+            return utf8_string(data_ + offset, length, allocator);
+        }
+
+    private:
+        const char* data_;
+        size_t size_;
+        size_t length_{};
+        size_t stride_;
+        size_t entries_{};
+        size_t* offsets_{};
+        const utf_allocator* allocator_;
+    };
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_INDEX_INC
@@ -0,0 +1,272 @@
+#pragma once
+#ifndef DBJ_UTF_INTERN_INC
+#define DBJ_UTF_INTERN_INC
+
+#include <stdlib.h>
+#include <mutex>
+#include "dbj_utf_utils.h"
+#include "dbj_utf_hash.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Pool of interned, immutable utf8 strings.
+
+    dbj::utf::intern_pool pool;
+
+    dbj::utf::interned a = pool.intern(tag, tag_size);
+    dbj::utf::interned b = pool.intern(other_tag, other_tag_size);
+
+    if (a == b) ... // one pointer compare
+    a.hash();       // precomputed
+    a.c_str();      // zero terminated utf8
+
+Equal strings are stored once. Handle is one pointer, stored string has
+its hash, size in bytes and length in code points next to the bytes.
+
+Strings are stored in the arena owned by the pool and are never released
+before the pool is. Handles must not outlive the pool.
+
+Pool is split in 16 shards, on the high bits of the hash, each with its
+own lock, open addressing table and arena.
+Input is taken as is, it is not validated, length counts the utf8 lead bytes.
+*/
+
+namespace dbj::utf {
+
+    namespace detail {
+
+        // header | bytes | terminator, in the arena, 8 aligned
+        struct interned_entry final {
+            uint64_t hash;
+            size_t size;   // bytes, no terminator
+            size_t length; // code points
+
+            const char* data() const noexcept { return reinterpret_cast<const char*>(this + 1); }
+        };
+
+        /*
+        bump allocator over the linked list of malloc-ed chunks
+        */
+        class intern_arena final {
+            intern_arena(const intern_arena&) = delete;
+            intern_arena& operator=(const intern_arena&) = delete;
+
+        public:
+            enum : size_t { chunk_size = 64 * 1024 };
+
+            intern_arena() noexcept = default;
+
+            ~intern_arena()
+            {
+                while (chunks_) {
+                    chunk* next = chunks_->next;
+                    free(chunks_);
+                    chunks_ = next;
+                }
+            }
+
+            // nullptr if no memory
+            void* allocate(size_t bytes) noexcept
+            {
+                bytes = (bytes + 7) & ~size_t(7);
+
+                if (!chunks_ || chunks_->capacity - chunks_->used < bytes) {
+                    const size_t capacity = bytes > chunk_size ? bytes : chunk_size;
+                    chunk* fresh = static_cast<chunk*>(malloc(sizeof(chunk) + capacity));
+                    if (!fresh)
+                        return nullptr;
+                    fresh->used = 0;
+                    fresh->capacity = capacity;
+                    // oversized chunk goes behind the current one, it is full anyway
+                    if (chunks_ && bytes > chunk_size) {
+                        fresh->next = chunks_->next;
+                        chunks_->next = fresh;
+                    }
+                    else {
+                        fresh->next = chunks_;
+                        chunks_ = fresh;
+                    }
+                    reserved_ += capacity;
+                    fresh->used = bytes;
+                    return fresh + 1;
+                }
+
+                void* result = reinterpret_cast<char*>(chunks_ + 1) + chunks_->used;
+                chunks_->used += bytes;
+                return result;
+            }
+
+            size_t reserved() const noexcept { return reserved_; }
+
+        private:
+            struct alignas(8) chunk final {
+                chunk* next;
+                size_t used;
+                size_t capacity;
+            };
+
+            chunk* chunks_{};
+            size_t reserved_{};
+        };
+
+        inline size_t utf8_code_points(const char* src, size_t bytes) noexcept
+        {
+            size_t count = 0;
+            for (size_t j = 0; j < bytes; ++j)
+                count += ((unsigned char)src[j] & 0xC0) != 0x80;
+            return count;
+        }
+    } // detail
+
+    /*
+    handle to the interned string, one pointer, cheap to copy
+    */
+    class interned final {
+    public:
+        interned() noexcept = default;
+
+        explicit interned(const detail::interned_entry* entry) noexcept : entry_(entry) {}
+
+        explicit operator bool() const noexcept { return entry_ != nullptr; }
+
+        // zero terminated utf8, "" for the empty handle
+        const char* c_str() const noexcept { return entry_ ? entry_->data() : ""; }
+        // bytes, no terminator
+        size_t size() const noexcept { return entry_ ? entry_->size : 0; }
+        // code points
+        size_t length() const noexcept { return entry_ ? entry_->length : 0; }
+        uint64_t hash() const noexcept { return entry_ ? entry_->hash : 0; }
+
+        // from the same pool
+        friend bool operator==(interned a, interned b) noexcept { return a.entry_ == b.entry_; }
+        friend bool operator!=(interned a, interned b) noexcept { return a.entry_ != b.entry_; }
+
+    private:
+        const detail::interned_entry* entry_{};
+    };
+
+    // for the std unordered containers
+    struct interned_hasher final {
+        size_t operator()(interned s) const noexcept { return size_t(s.hash()); }
+    };
+
+    class intern_pool final {
+        intern_pool(const intern_pool&) = delete;
+        intern_pool& operator=(const intern_pool&) = delete;
+
+    public:
+        enum : unsigned { shards = 16 };
+
+        intern_pool() noexcept = default;
+
+        ~intern_pool()
+        {
+            for (shard& s : shards_)
+                free(s.slots);
+        }
+
+        /*
+        returns the empty handle only if there is no memory
+        */
+        interned intern(const char* src, size_t bytes) noexcept
+        {
+            const uint64_t hash = hash_bytes(src, bytes);
+            shard& s = shards_[hash >> 60];
+
+            std::lock_guard<std::mutex> guard(s.lock);
+
+            size_t index = size_t(hash) & s.mask;
+            if (s.slots) {
+                for (const detail::interned_entry* e; (e = s.slots[index]) != nullptr; index = (index + 1) & s.mask) {
+                    if (e->hash == hash && e->size == bytes && 0 == memcmp(e->data(), src, bytes))
+                        return interned(e);
+                }
+            }
+
+            // grow at 3/4 load
+            if (!s.slots || (s.count + 1) * 4 > (s.mask + 1) * 3) {
+                if (!s.grow())
+                    return interned{};
+                index = size_t(hash) & s.mask;
+                while (s.slots[index])
+                    index = (index + 1) & s.mask;
+            }
+
+            void* memory = s.arena.allocate(sizeof(detail::interned_entry) + bytes + 1);
+            if (!memory)
+                return interned{};
+
+            detail::interned_entry* entry = static_cast<detail::interned_entry*>(memory);
+            entry->hash = hash;
+            entry->size = bytes;
+            entry->length = detail::utf8_code_points(src, bytes);
+            char* data = const_cast<char*>(entry->data());
+            memcpy(data, src, bytes);
+            data[bytes] = 0;
+
+            s.slots[index] = entry;
+            ++s.count;
+            return interned(entry);
+        }
+
+        interned intern(const char* src) noexcept { return intern(src, strlen(src)); }
+
+        // number of distinct strings
+        size_t count() noexcept
+        {
+            size_t total = 0;
+            for (shard& s : shards_) {
+                std::lock_guard<std::mutex> guard(s.lock);
+                total += s.count;
+            }
+            return total;
+        }
+
+        // arena bytes reserved, tables not included
+        size_t reserved() noexcept
+        {
+            size_t total = 0;
+            for (shard& s : shards_) {
+                std::lock_guard<std::mutex> guard(s.lock);
+                total += s.arena.reserved();
+            }
+            return total;
+        }
+
+    private:
+        struct shard final {
+            std::mutex lock;
+            const detail::interned_entry** slots{};
+            size_t mask{};
+            size_t count{};
+            detail::intern_arena arena;
+
+            bool grow() noexcept
+            {
+                const size_t capacity = slots ? (mask + 1) * 2 : 64;
+                auto fresh = static_cast<const detail::interned_entry**>(calloc(capacity, sizeof(void*)));
+                if (!fresh)
+                    return false;
+
+                for (size_t j = 0; slots && j <= mask; ++j) {
+                    if (!slots[j])
+                        continue;
+                    size_t index = size_t(slots[j]->hash) & (capacity - 1);
+                    while (fresh[index])
+                        index = (index + 1) & (capacity - 1);
+                    fresh[index] = slots[j];
+                }
+
+                free(slots);
+                slots = fresh;
+                mask = capacity - 1;
+                return true;
+            }
+        };
+
+        shard shards_[shards];
+    };
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_INTERN_INC
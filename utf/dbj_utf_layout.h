@@ -0,0 +1,351 @@
+#pragma once
+#ifndef DBJ_UTF_LAYOUT_INC
+#define DBJ_UTF_LAYOUT_INC
+
+#include "dbj_utf_utils.h"
+#include "dbj_utf_simd.h"
+#include "dbj_wcwidth.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Laying out utf8 or utf32 text in the fixed number of columns, in one
+pass, with no allocation and no conversion.
+
+    dbj::utf::utf8_line_breaker lines(text, text_size, 80);
+    for (dbj::utf::text_line line; lines.next(line);)
+        print(text + line.begin, line.end - line.begin);
+
+    char cell[64];
+    dbj::utf::truncate_columns(name, name_size, 12, cell, sizeof(cell));
+    // "Very long n…", exactly 12 columns
+
+Widths are dbj_wcwidth_ex() for the profile given. Control chars are 0
+columns, but '\n' and "\r\n" end the line.
+
+Lines break after the spaces and before or after the wide (CJK) chars;
+a word longer than the line is cut where the line ends. Spaces at the
+line break belong to no line, as the line end right after them does not.
+Zero width chars stay with the char before.
+Line has at least one char, even if it is wider than the line.
+
+Printable ASCII is measured 16 bytes at a time, only the rest is decoded
+and looked up. Each unit is visited at most twice, thus linear time.
+*/
+
+namespace dbj::utf {
+
+    // units [begin, end) of the line, without the break
+    struct text_line final {
+        size_t begin{};
+        size_t end{};
+        int columns{};
+    };
+
+    namespace detail {
+
+        // printable ASCII at the front, at most limit units
+        inline size_t ascii_run(const char* src, size_t limit) noexcept
+        {
+            return simd::printable_ascii_prefix(src, limit);
+        }
+
+        inline size_t ascii_run(const char32_t* src, size_t limit) noexcept
+        {
+            size_t j = 0;
+            while (j < limit && src[j] >= 0x20 && src[j] < 0x7F)
+                ++j;
+            return j;
+        }
+
+        // one code point, returns the units consumed
+        inline size_t decode_unit(const char* src, const char* end, char32_t& cp) noexcept
+        {
+            return decode_utf8(src, end, cp);
+        }
+
+        inline size_t decode_unit(const char32_t* src, const char32_t*, char32_t& cp) noexcept
+        {
+            cp = *src;
+            return 1;
+        }
+
+        inline int layout_width(char32_t cp, int profile) noexcept
+        {
+            const int width = dbj_wcwidth_ex(cp, profile);
+            return width < 0 ? 0 : width;
+        }
+    } // detail
+
+    template <typename Unit>
+    class basic_line_breaker final {
+    public:
+        basic_line_breaker(const Unit* text, size_t size, int columns, int profile = DBJ_WCWIDTH_PROFILE_DEFAULT) noexcept
+            : text_(text), size_(size), columns_(columns < 1 ? 1 : columns), profile_(profile)
+        {
+        }
+
+        // false when there are no more lines
+        bool next(text_line& line) noexcept
+        {
+            if (pos_ >= size_)
+                return false;
+
+            const size_t begin = pos_;
+            size_t walker = begin;
+            int columns = 0;
+
+            // the last place the line can break: end of the line, start of the next
+            size_t break_end = npos, break_next = 0;
+            int break_columns = 0;
+            bool after_wide = false;
+
+            while (walker < size_) {
+                // none after the char wider than the line
+                const size_t room = columns < columns_ ? size_t(columns_ - columns) : 0;
+                // one more than fits, to know if it does not
+                const size_t left = size_ - walker;
+                const size_t run = detail::ascii_run(text_ + walker, left < room + 1 ? left : room + 1);
+
+                if (run) {
+                    if (after_wide) {
+                        break_end = break_next = walker;
+                        break_columns = columns;
+                        after_wide = false;
+                    }
+
+                    if (run <= room) {
+                        // the last space of the run
+                        size_t space = walker + run;
+                        while (space > walker && text_[space - 1] != ' ')
+                            --space;
+                        if (space > walker) {
+                            break_end = trim(walker, space - 1);
+                            break_next = space;
+                            break_columns = columns + int(break_end - walker);
+                        }
+                        columns += int(run);
+                        walker += run;
+                        continue;
+                    }
+
+                    const size_t cut = walker + room;
+                    if (text_[cut] == ' ' && trim(walker, cut) > begin) {
+                        const size_t end = trim(walker, cut);
+                        size_t next = cut;
+                        while (next < size_ && text_[next] == ' ')
+                            ++next;
+                        return emit(line, begin, end, columns + int(end - walker), past_newline(next));
+                    }
+
+                    size_t space = cut;
+                    while (space > walker && text_[space - 1] != ' ')
+                        --space;
+                    if (space > walker && trim(walker, space - 1) > begin) {
+                        const size_t end = trim(walker, space - 1);
+                        return emit(line, begin, end, columns + int(end - walker), space);
+                    }
+                    if (break_end != npos && break_end > begin)
+                        return emit(line, begin, break_end, break_columns, break_next);
+                    // the word is longer than the line
+                    return emit(line, begin, cut, columns + int(room), cut);
+                }
+
+                char32_t cp = 0;
+                const size_t step = detail::decode_unit(text_ + walker, text_ + size_, cp);
+
+                if (cp == '\n' || (cp == '\r' && walker + 1 < size_ && text_[walker + 1] == '\n')) {
+                    const size_t end = trim(begin, walker);
+                    return emit(line, begin, end, columns - int(walker - end), walker + (cp == '\r' ? 2 : 1));
+                }
+
+                const int width = detail::layout_width(cp, profile_);
+                if (width == 0) {
+                    walker += step;
+                    continue;
+                }
+
+                if (after_wide || width == 2) {
+                    // before the wide char, or after it
+                    break_end = trim(begin, walker);
+                    break_next = walker;
+                    break_columns = columns - int(walker - break_end);
+                    after_wide = false;
+                }
+
+                if (columns + width > columns_ && walker > begin) {
+                    if (break_end != npos && break_end > begin)
+                        return emit(line, begin, break_end, break_columns, break_next);
+                    return emit(line, begin, walker, columns, walker);
+                }
+
+                columns += width;
+                walker += step;
+                after_wide = width == 2;
+            }
+
+            const size_t end = trim(begin, size_);
+            return emit(line, begin, end, columns - int(size_ - end), size_);
+        }
+
+    private:
+        // past the '\n' or "\r\n" at pos, if there is one
+        size_t past_newline(size_t pos) const noexcept
+        {
+            if (pos < size_ && text_[pos] == '\n')
+                return pos + 1;
+            if (pos + 1 < size_ && text_[pos] == '\r' && text_[pos + 1] == '\n')
+                return pos + 2;
+            return pos;
+        }
+
+        // end moved back over the spaces, not before from
+        size_t trim(size_t from, size_t end) const noexcept
+        {
+            while (end > from && text_[end - 1] == ' ')
+                --end;
+            return end;
+        }
+
+        bool emit(text_line& line, size_t begin, size_t end, int columns, size_t next) noexcept
+        {
+            line.begin = begin;
+            line.end = end;
+            line.columns = columns;
+            pos_ = next;
+            return true;
+        }
+
+        const Unit* text_;
+        size_t size_;
+        int columns_;
+        int profile_;
+        size_t pos_{};
+    };
+
+    using utf8_line_breaker = basic_line_breaker<char>;
+    using utf32_line_breaker = basic_line_breaker<char32_t>;
+
+    struct column_fit final {
+        // units of the text that fit
+        size_t size{};
+        int columns{};
+        // false if the whole text fits
+        bool truncated{};
+    };
+
+    /*
+    if the text does not fit in columns, the longest prefix that fits in
+    columns - reserve, that is with the room for the ellipsis
+    stops as soon as it is known the text does not fit
+    */
+    template <typename Unit>
+    inline column_fit fit_columns(const Unit* text, size_t size, int columns, int reserve = 0,
+        int profile = DBJ_WCWIDTH_PROFILE_DEFAULT) noexcept
+    {
+        const int limit = columns > reserve ? columns - reserve : 0;
+        column_fit fit;
+        int used = 0;
+        size_t walker = 0;
+
+        while (walker < size) {
+            const size_t room = used < columns ? size_t(columns - used) : 0;
+            const size_t left = size - walker;
+            const size_t run = detail::ascii_run(text + walker, left < room + 1 ? left : room + 1);
+
+            if (run) {
+                if (used < limit) {
+                    const size_t fits = run < size_t(limit - used) ? run : size_t(limit - used);
+                    fit.size = walker + fits;
+                    fit.columns = used + int(fits);
+                }
+                if (run > room) {
+                    fit.truncated = true;
+                    return fit;
+                }
+                used += int(run);
+                walker += run;
+                continue;
+            }
+
+            char32_t cp = 0;
+            const size_t step = detail::decode_unit(text + walker, text + size, cp);
+            const int width = detail::layout_width(cp, profile);
+
+            if (width == 0) {
+                // stays with the char before
+                if (fit.size == walker)
+                    fit.size = walker + step;
+                walker += step;
+                continue;
+            }
+            if (used + width > columns) {
+                fit.truncated = true;
+                return fit;
+            }
+            used += width;
+            walker += step;
+            if (used <= limit) {
+                fit.size = walker;
+                fit.columns = used;
+            }
+        }
+
+        fit.size = size;
+        fit.columns = used;
+        return fit;
+    }
+
+    /*
+    text in exactly columns columns, if it is wider: cut, ellipsis and
+    a space in place of the half of the wide char that did not fit
+    narrower text is copied as it is
+
+    as snprintf: dst is zero terminated, what does not fit is dropped,
+    returns the units of the whole result
+    ellipsis is dropped if it is wider than columns
+    */
+    template <typename Unit>
+    inline size_t truncate_columns(const Unit* text, size_t size, int columns, Unit* dst, size_t capacity,
+        const Unit* ellipsis, size_t ellipsis_size, int profile = DBJ_WCWIDTH_PROFILE_DEFAULT) noexcept
+    {
+        int ellipsis_columns = fit_columns(ellipsis, ellipsis_size, INT32_MAX, 0, profile).columns;
+        if (ellipsis_columns > columns)
+            ellipsis_size = 0, ellipsis_columns = 0;
+
+        const column_fit fit = fit_columns(text, size, columns, ellipsis_columns, profile);
+
+        size_t written = 0;
+        auto put = [&](const Unit* src, size_t units) {
+            for (size_t j = 0; j < units; ++j, ++written)
+                if (written + 1 < capacity)
+                    dst[written] = src[j];
+        };
+
+        put(text, fit.size);
+        if (fit.truncated) {
+            put(ellipsis, ellipsis_size);
+            const Unit space[1]{ Unit(' ') };
+            for (int pad = columns - fit.columns - ellipsis_columns; pad > 0; --pad)
+                put(space, 1);
+        }
+        if (capacity)
+            dst[written < capacity ? written : capacity - 1] = 0;
+        return written;
+    }
+
+    // with U+2026 as the ellipsis
+    inline size_t truncate_columns(const char* text, size_t size, int columns, char* dst, size_t capacity,
+        int profile = DBJ_WCWIDTH_PROFILE_DEFAULT) noexcept
+    {
+        return truncate_columns(text, size, columns, dst, capacity, "\xE2\x80\xA6", 3, profile);
+    }
+
+    inline size_t truncate_columns(const char32_t* text, size_t size, int columns, char32_t* dst, size_t capacity,
+        int profile = DBJ_WCWIDTH_PROFILE_DEFAULT) noexcept
+    {
+        return truncate_columns(text, size, columns, dst, capacity, U"…", 1, profile);
+    }
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_LAYOUT_INC
@@ -0,0 +1,257 @@
+#pragma once
+#ifndef DBJ_UTF_MEMORY_INC
+#define DBJ_UTF_MEMORY_INC
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <new>
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Where do the dbj utf strings get their memory from.
+
+utf_allocator is a tiny handle: two function pointers and a context.
+Strings keep the pointer to it, it must outlive them.
+
+- heap_allocator() -- DBJ_UTF_MALLOC / DBJ_UTF_FREE, the default
+- utf_arena        -- bump allocation, everything released by one reset()
+- utf_pool         -- free lists of power of 2 blocks, for strings
+                      created and destroyed all the time
+
+    dbj::utf::utf_arena request_arena;
+    {
+        dbj::utf::utf32_string name(json_name, json_name_size, request_arena.allocator());
+        ...
+    }
+    request_arena.reset(); // all strings of the request, at once
+
+Arena and pool are not thread safe, use one per thread or per request.
+
+Allocators return nullptr when out of memory. The strings and the other
+containers allocate through allocate_or_throw() and throw std::bad_alloc
+then, as new[] did.
+
+DBJ_UTF_MALLOC and DBJ_UTF_FREE are the nanolib DBJ_MALLOC and DBJ_FREE
+if those are defined before this header is included (dbj_heap_alloc.h),
+otherwise malloc and free. Or define them yourself.
+*/
+
+#ifndef DBJ_UTF_MALLOC
+#ifdef DBJ_MALLOC
+#define DBJ_UTF_MALLOC(size_) DBJ_MALLOC(size_)
+#define DBJ_UTF_FREE(ptr_) DBJ_FREE(ptr_)
+#else
+#define DBJ_UTF_MALLOC(size_) malloc(size_)
+#define DBJ_UTF_FREE(ptr_) free(ptr_)
+#endif
+#endif // DBJ_UTF_MALLOC
+
+namespace dbj::utf {
+
+    namespace detail {
+        // the block, std::bad_alloc for nullptr
+        inline void* checked(void* block)
+        {
+            if (!block)
+                throw std::bad_alloc();
+            return block;
+        }
+    }
+
+    struct utf_allocator final {
+        void* (*allocate_fp)(void* context, size_t bytes);
+        // bytes are the same as given to allocate
+        void (*deallocate_fp)(void* context, void* block, size_t bytes);
+        void* context;
+
+        void* allocate(size_t bytes) const noexcept { return allocate_fp(context, bytes); }
+        // never nullptr, std::bad_alloc instead
+        void* allocate_or_throw(size_t bytes) const { return detail::checked(allocate_fp(context, bytes)); }
+        void deallocate(void* block, size_t bytes) const noexcept { if (block) deallocate_fp(context, block, bytes); }
+    };
+
+    namespace detail {
+        inline void* heap_allocate(void*, size_t bytes) { return DBJ_UTF_MALLOC(bytes); }
+        inline void heap_deallocate(void*, void* block, size_t) { DBJ_UTF_FREE(block); }
+    }
+
+    inline const utf_allocator* heap_allocator() noexcept
+    {
+        static const utf_allocator heap{ detail::heap_allocate, detail::heap_deallocate, nullptr };
+        return &heap;
+    }
+
+    /*
+    deallocate does nothing, reset() releases everything
+    */
+    class utf_arena final {
+        utf_arena(const utf_arena&) = delete;
+        utf_arena& operator=(const utf_arena&) = delete;
+
+    public:
+        enum : size_t { chunk_size = 64 * 1024 };
+
+        utf_arena() noexcept = default;
+
+        ~utf_arena() { release(); }
+
+        const utf_allocator* allocator() const noexcept { return &handle_; }
+
+        // nullptr if no memory
+        void* allocate(size_t bytes) noexcept
+        {
+            bytes = (bytes + 15) & ~size_t(15);
+
+            if (!chunks_ || chunks_->capacity - chunks_->used < bytes) {
+                const size_t capacity = bytes > chunk_size ? bytes : chunk_size;
+                chunk* fresh = static_cast<chunk*>(DBJ_UTF_MALLOC(sizeof(chunk) + capacity));
+                if (!fresh)
+                    return nullptr;
+                fresh->next = chunks_;
+                fresh->used = 0;
+                fresh->capacity = capacity;
+                chunks_ = fresh;
+            }
+
+            void* result = reinterpret_cast<char*>(chunks_ + 1) + chunks_->used;
+            chunks_->used += bytes;
+            return result;
+        }
+
+        /*
+        every block allocated so far is released, the arena is reusable
+        the last chunk is kept, if it is not oversized
+        */
+        void reset() noexcept
+        {
+            chunk* keep = chunks_ && chunks_->capacity == chunk_size ? chunks_ : nullptr;
+            if (keep)
+                chunks_ = chunks_->next;
+            release();
+            if (keep) {
+                keep->next = nullptr;
+                keep->used = 0;
+                chunks_ = keep;
+            }
+        }
+
+    private:
+        struct alignas(16) chunk final {
+            chunk* next;
+            size_t used;
+            size_t capacity;
+        };
+
+        void release() noexcept
+        {
+            while (chunks_) {
+                chunk* next = chunks_->next;
+                DBJ_UTF_FREE(chunks_);
+                chunks_ = next;
+            }
+        }
+
+        static void* allocate_fn(void* context, size_t bytes) { return static_cast<utf_arena*>(context)->allocate(bytes); }
+        static void deallocate_fn(void*, void*, size_t) {}
+
+        chunk* chunks_{};
+        const utf_allocator handle_{ allocate_fn, deallocate_fn, this };
+    };
+
+    /*
+    blocks of 16 .. 2048 bytes are recycled through the free lists,
+    and carved from 64KB slabs; bigger blocks go to DBJ_UTF_MALLOC
+    slabs are released when the pool is
+    */
+    class utf_pool final {
+        utf_pool(const utf_pool&) = delete;
+        utf_pool& operator=(const utf_pool&) = delete;
+
+    public:
+        enum : size_t { min_block = 16, max_block = 2048, classes = 8, slab_size = 64 * 1024 };
+
+        utf_pool() noexcept = default;
+
+        ~utf_pool()
+        {
+            while (slabs_) {
+                slab* next = slabs_->next;
+                DBJ_UTF_FREE(slabs_);
+                slabs_ = next;
+            }
+        }
+
+        const utf_allocator* allocator() const noexcept { return &handle_; }
+
+        void* allocate(size_t bytes) noexcept
+        {
+            if (bytes > max_block)
+                return DBJ_UTF_MALLOC(bytes);
+
+            const unsigned index = class_of(bytes);
+            if (free_[index]) {
+                free_block* block = free_[index];
+                free_[index] = block->next;
+                return block;
+            }
+
+            const size_t size = size_t(min_block) << index;
+            if (!slabs_ || slab_size - slabs_->used < size) {
+                slab* fresh = static_cast<slab*>(DBJ_UTF_MALLOC(sizeof(slab) + slab_size));
+                if (!fresh)
+                    return nullptr;
+                fresh->next = slabs_;
+                fresh->used = 0;
+                slabs_ = fresh;
+            }
+            void* result = reinterpret_cast<char*>(slabs_ + 1) + slabs_->used;
+            slabs_->used += size;
+            return result;
+        }
+
+        void deallocate(void* block, size_t bytes) noexcept
+        {
+            if (!block)
+                return;
+            if (bytes > max_block) {
+                DBJ_UTF_FREE(block);
+                return;
+            }
+            const unsigned index = class_of(bytes);
+            free_block* freed = static_cast<free_block*>(block);
+            freed->next = free_[index];
+            free_[index] = freed;
+        }
+
+    private:
+        struct free_block final {
+            free_block* next;
+        };
+
+        struct alignas(16) slab final {
+            slab* next;
+            size_t used;
+        };
+
+        // smallest power of 2 class that fits
+        static unsigned class_of(size_t bytes) noexcept
+        {
+            unsigned index = 0;
+            while ((size_t(min_block) << index) < bytes)
+                ++index;
+            return index;
+        }
+
+        static void* allocate_fn(void* context, size_t bytes) { return static_cast<utf_pool*>(context)->allocate(bytes); }
+        static void deallocate_fn(void* context, void* block, size_t bytes) { static_cast<utf_pool*>(context)->deallocate(block, bytes); }
+
+        slab* slabs_{};
+        free_block* free_[classes]{};
+        const utf_allocator handle_{ allocate_fn, deallocate_fn, this };
+    };
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_MEMORY_INC
@@ -0,0 +1,97 @@
+#pragma once
+#ifndef DBJ_UTF_METRICS_INC
+#define DBJ_UTF_METRICS_INC
+
+#include "dbj_utf_utils.h"
+#include "dbj_utf_simd.h"
+#include "dbj_wcwidth.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Everything needed to lay out one line of utf8, in one pass
+
+Instead of
+
+    validate + copy_string_8_to_32 (allocate) + dbj_wcswidth
+
+do
+
+    utf8_metrics m = measure_utf8(line, line_size);
+    if (m.valid && m.width > -1) { ... }
+
+Printable ASCII runs are consumed 16 bytes at a time. Only the non ASCII
+code points are decoded and given to dbj_wcwidth(), thus the width is
+exactly what dbj_wcswidth() would return on the utf32 copy.
+
+As dbj_wcswidth() and dbj_wcswidth_utf8() do, the text ends at the first
+NUL or after size bytes, whichever comes first; bytes is where it ended.
+*/
+
+namespace dbj::utf {
+
+    struct utf8_metrics final {
+        // false if there was illegal or truncated utf8 sequence
+        bool valid{ true };
+        // offset of the first illegal sequence, equals bytes if valid
+        size_t error_offset{};
+        // byte length scanned, up to the first NUL
+        size_t bytes{};
+        // illegal sequences are counted as one replacement char per byte
+        size_t code_points{};
+        // as dbj_wcswidth, -1 if there is any non printable char
+        int width{};
+    };
+
+    inline utf8_metrics measure_utf8(const char* src, size_t size) noexcept
+    {
+        utf8_metrics metrics;
+        metrics.bytes = size;
+        metrics.error_offset = size;
+
+        const char* const end = src + size;
+        const char* walker = src;
+        int width = 0;
+        bool printable = true;
+
+        while (walker < end) {
+            const size_t run = simd::printable_ascii_prefix(walker, size_t(end - walker));
+            walker += run;
+            metrics.code_points += run;
+            width += int(run);
+
+            if (walker >= end)
+                break;
+            if (!*walker) {
+                metrics.bytes = size_t(walker - src);
+                break;
+            }
+
+            char32_t cp{};
+            const unsigned step = decode_utf8(walker, end, cp);
+
+            if (step == 1 && (unsigned char)*walker >= 0x80) {
+                if (metrics.valid) {
+                    metrics.valid = false;
+                    metrics.error_offset = size_t(walker - src);
+                }
+            }
+
+            const int w = dbj_wcwidth(cp);
+            if (w < 0)
+                printable = false;
+            else
+                width += w;
+
+            walker += step;
+            ++metrics.code_points;
+        }
+
+        if (metrics.valid)
+            metrics.error_offset = metrics.bytes;
+        metrics.width = printable ? width : -1;
+        return metrics;
+    }
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_METRICS_INC
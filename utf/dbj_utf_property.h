@@ -0,0 +1,136 @@
+#pragma once
+#ifndef DBJ_UTF_PROPERTY_INC
+#define DBJ_UTF_PROPERTY_INC
+
+#include <stddef.h>
+#include "dbj_utf_property_tables.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Unicode character properties: general category, script, alphabetic,
+numeric and white space.
+
+Tables are generated offline from the UCD files by utf/tools/dbj_ucd_gen.py
+into a three stage trie. Lookup is three dependent loads, no branching
+and no searching. Whole thing is ~35KB, and the part touched by the
+usual (Latin, Cyrillic, CJK ...) text is a few cache lines only.
+
+    auto p = dbj::utf::properties(U'Ж');
+    if (p.is_alphabetic() && p.script() == dbj::utf::script::Cyrillic) { ... }
+
+NOTE: keep the record layout in sync with the generator
+*/
+
+namespace dbj::utf {
+
+    class property_record final {
+    public:
+        enum : uint16_t {
+            category_mask = 0x1F,
+            script_shift = 5,
+            script_mask = 0xFF,
+            alphabetic_bit = 1 << 13,
+            white_space_bit = 1 << 14
+        };
+
+        constexpr property_record() noexcept : bits_(uint16_t(general_category::Cn)) {}
+        constexpr explicit property_record(uint16_t bits_arg) noexcept : bits_(bits_arg) {}
+
+        constexpr general_category category() const noexcept {
+            return general_category(bits_ & category_mask);
+        }
+
+        constexpr dbj::utf::script script() const noexcept {
+            return dbj::utf::script((bits_ >> script_shift) & script_mask);
+        }
+
+        constexpr bool is_alphabetic() const noexcept { return bits_ & alphabetic_bit; }
+        constexpr bool is_white_space() const noexcept { return bits_ & white_space_bit; }
+
+        // categories are in the UCD order thus groups are ranges
+        constexpr bool is_letter() const noexcept {
+            return category() <= general_category::Lo;
+        }
+        constexpr bool is_mark() const noexcept {
+            return category() >= general_category::Mn && category() <= general_category::Me;
+        }
+        // Nd, Nl or No
+        constexpr bool is_numeric() const noexcept {
+            return category() >= general_category::Nd && category() <= general_category::No;
+        }
+        constexpr bool is_digit() const noexcept {
+            return category() == general_category::Nd;
+        }
+        constexpr bool is_punctuation() const noexcept {
+            return category() >= general_category::Pc && category() <= general_category::Po;
+        }
+        constexpr bool is_symbol() const noexcept {
+            return category() >= general_category::Sm && category() <= general_category::So;
+        }
+        constexpr bool is_separator() const noexcept {
+            return category() >= general_category::Zs && category() <= general_category::Zp;
+        }
+        constexpr bool is_control() const noexcept {
+            return category() == general_category::Cc;
+        }
+
+        constexpr uint16_t bits() const noexcept { return bits_; }
+
+    private:
+        uint16_t bits_;
+    };
+
+    /*
+    O(1) lookup, code points above U+10FFFF are reported as unassigned
+    */
+    inline property_record properties(char32_t cp) noexcept
+    {
+        using namespace detail;
+
+        if (cp > 0x10FFFF)
+            return property_record{};
+
+        const unsigned i2 = (unsigned(property_stage1[cp >> (property_shift2 + property_shift3)]) << property_shift2)
+            | ((cp >> property_shift3) & ((1u << property_shift2) - 1));
+        const unsigned i3 = (unsigned(property_stage2[i2]) << property_shift3)
+            | (cp & ((1u << property_shift3) - 1));
+
+        return property_record{ property_stage3[i3] };
+    }
+
+    inline general_category category_of(char32_t cp) noexcept { return properties(cp).category(); }
+    inline dbj::utf::script script_of(char32_t cp) noexcept { return properties(cp).script(); }
+
+    inline bool is_alphabetic(char32_t cp) noexcept { return properties(cp).is_alphabetic(); }
+    inline bool is_numeric(char32_t cp) noexcept { return properties(cp).is_numeric(); }
+    inline bool is_white_space(char32_t cp) noexcept { return properties(cp).is_white_space(); }
+
+    inline const char* script_name(dbj::utf::script sc) noexcept {
+        return unsigned(sc) < script_count ? detail::script_names[unsigned(sc)] : "Unknown";
+    }
+
+    /*
+    batch classification of the utf32 span
+    out must have room for count records
+    */
+    inline void classify(const char32_t* src, size_t count, property_record* out) noexcept
+    {
+        for (size_t j = 0; j < count; ++j)
+            out[j] = properties(src[j]);
+    }
+
+    inline void classify(const char32_t* src, size_t count, general_category* out) noexcept
+    {
+        for (size_t j = 0; j < count; ++j)
+            out[j] = properties(src[j]).category();
+    }
+
+    inline void classify(const char32_t* src, size_t count, dbj::utf::script* out) noexcept
+    {
+        for (size_t j = 0; j < count; ++j)
+            out[j] = properties(src[j]).script();
+    }
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_PROPERTY_INC
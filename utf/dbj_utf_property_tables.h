@@ -0,0 +1,1356 @@
+#pragma once
+#ifndef DBJ_UTF_PROPERTY_TABLES_INC
+#define DBJ_UTF_PROPERTY_TABLES_INC
+/*
+    GENERATED by utf/tools/dbj_ucd_gen.py -- do not edit
+    Unicode 14.0.0
+
+    general category, script, alphabetic and white space
+    packed in one 16 bit record per code point, 35824 bytes in total
+*/
+#include <stdint.h>
+
+namespace dbj::utf {
+
+    enum class general_category : uint8_t {
+        Lu, Ll, Lt, Lm, Lo, Mn, Mc, Me, Nd, Nl,
+        No, Pc, Pd, Ps, Pe, Pi, Pf, Po, Sm, Sc,
+        Sk, So, Zs, Zl, Zp, Cc, Cf, Cs, Co, Cn,
+    };
+
+    enum class script : uint8_t {
+        Unknown, Common, Inherited, Adlam, Ahom, Anatolian_Hieroglyphs,
+        Arabic, Armenian, Avestan, Balinese, Bamum, Bassa_Vah,
+        Batak, Bengali, Bhaiksuki, Bopomofo, Brahmi, Braille,
+        Buginese, Buhid, Canadian_Aboriginal, Carian, Caucasian_Albanian, Chakma,
+        Cham, Cherokee, Chorasmian, Coptic, Cuneiform, Cypriot,
+        Cypro_Minoan, Cyrillic, Deseret, Devanagari, Dives_Akuru, Dogra,
+        Duployan, Egyptian_Hieroglyphs, Elbasan, Elymaic, Ethiopic, Georgian,
+        Glagolitic, Gothic, Grantha, Greek, Gujarati, Gunjala_Gondi,
+        Gurmukhi, Han, Hangul, Hanifi_Rohingya, Hanunoo, Hatran,
+        Hebrew, Hiragana, Imperial_Aramaic, Inscriptional_Pahlavi, Inscriptional_Parthian, Javanese,
+        Kaithi, Kannada, Katakana, Kayah_Li, Kharoshthi, Khitan_Small_Script,
+        Khmer, Khojki, Khudawadi, Lao, Latin, Lepcha,
+        Limbu, Linear_A, Linear_B, Lisu, Lycian, Lydian,
+        Mahajani, Makasar, Malayalam, Mandaic, Manichaean, Marchen,
+        Masaram_Gondi, Medefaidrin, Meetei_Mayek, Mende_Kikakui, Meroitic_Cursive, Meroitic_Hieroglyphs,
+        Miao, Modi, Mongolian, Mro, Multani, Myanmar,
+        Nabataean, Nandinagari, New_Tai_Lue, Newa, Nko, Nushu,
+        Nyiakeng_Puachue_Hmong, Ogham, Ol_Chiki, Old_Hungarian, Old_Italic, Old_North_Arabian,
+        Old_Permic, Old_Persian, Old_Sogdian, Old_South_Arabian, Old_Turkic, Old_Uyghur,
+        Oriya, Osage, Osmanya, Pahawh_Hmong, Palmyrene, Pau_Cin_Hau,
+        Phags_Pa, Phoenician, Psalter_Pahlavi, Rejang, Runic, Samaritan,
+        Saurashtra, Sharada, Shavian, Siddham, SignWriting, Sinhala,
+        Sogdian, Sora_Sompeng, Soyombo, Sundanese, Syloti_Nagri, Syriac,
+        Tagalog, Tagbanwa, Tai_Le, Tai_Tham, Tai_Viet, Takri,
+        Tamil, Tangsa, Tangut, Telugu, Thaana, Thai,
+        Tibetan, Tifinagh, Tirhuta, Toto, Ugaritic, Vai,
+        Vithkuqi, Wancho, Warang_Citi, Yezidi, Yi, Zanabazar_Square,
+    };
+
+    inline constexpr unsigned script_count = 162;
+
+    namespace detail {
+
+        inline constexpr unsigned property_shift2 = 5;
+        inline constexpr unsigned property_shift3 = 3;
+
+        inline constexpr uint8_t property_stage1[4352] = {
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+            16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 34, 42, 43, 44, 45, 46,
+            47, 48, 49, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 52, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            53, 54, 54, 54, 55, 56, 57, 58, 59, 60, 61, 62, 17, 17, 17, 17,
+            17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+            17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+            17, 17, 17, 17, 17, 17, 17, 63, 64, 64, 64, 64, 64, 64, 64, 64,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 51, 66, 67, 68, 69, 70, 71,
+            72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+            88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+            104, 104, 104, 105, 106, 107, 99, 99, 99, 99, 99, 99, 99, 99, 99, 108,
+            109, 109, 109, 109, 110, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 111, 111, 112, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 113, 113, 114, 115, 99, 99, 116, 117,
+            118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+            118, 118, 118, 118, 118, 118, 118, 119, 118, 118, 118, 120, 121, 122, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 123,
+            124, 125, 126, 99, 99, 99, 99, 99, 99, 99, 99, 99, 127, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 128,
+            129, 130, 131, 132, 133, 134, 135, 136, 137, 137, 138, 99, 99, 99, 99, 139,
+            140, 141, 142, 99, 99, 99, 99, 143, 144, 145, 99, 99, 146, 147, 148, 99,
+            149, 150, 151, 152, 153, 153, 154, 155, 156, 153, 157, 158, 99, 99, 99, 99,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 159, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 160, 161, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 162, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 163, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 51, 51, 164, 99, 99, 99, 99, 99,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+            51, 51, 51, 165, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            166, 167, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 168,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+            65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 168,
+        };
+
+        inline constexpr uint16_t property_stage2[5408] = {
+            0, 1, 0, 0, 2, 3, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11,
+            12, 0, 0, 0, 13, 14, 15, 16, 7, 7, 17, 18, 10, 10, 19, 10,
+            20, 20, 20, 20, 20, 20, 20, 21, 21, 22, 20, 20, 20, 20, 20, 23,
+            24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 21, 34, 20, 20, 35, 20,
+            20, 20, 20, 20, 20, 20, 36, 37, 38, 20, 10, 10, 10, 10, 10, 10,
+            10, 10, 39, 10, 10, 10, 40, 41, 42, 43, 44, 45, 46, 47, 45, 45,
+            48, 48, 48, 48, 48, 48, 48, 48, 49, 48, 48, 48, 48, 48, 50, 51,
+            52, 53, 54, 55, 56, 57, 58, 58, 58, 59, 60, 61, 62, 63, 64, 65,
+            66, 66, 66, 66, 66, 66, 67, 67, 67, 67, 67, 67, 68, 68, 68, 68,
+            69, 70, 68, 68, 68, 68, 68, 68, 71, 72, 68, 68, 68, 68, 68, 68,
+            68, 68, 68, 68, 68, 68, 73, 74, 74, 74, 75, 76, 77, 77, 77, 77,
+            77, 78, 79, 80, 80, 80, 81, 82, 83, 84, 85, 85, 85, 86, 87, 84,
+            88, 89, 90, 91, 92, 92, 92, 92, 93, 94, 95, 96, 97, 98, 99, 92,
+            92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 100, 101, 102, 103, 97, 104,
+            105, 106, 107, 108, 108, 108, 109, 109, 110, 111, 92, 92, 92, 92, 92, 92,
+            112, 112, 112, 112, 113, 114, 115, 84, 116, 117, 118, 118, 118, 119, 120, 121,
+            122, 122, 123, 124, 125, 126, 127, 128, 129, 129, 129, 130, 108, 131, 92, 92,
+            92, 132, 133, 134, 92, 92, 92, 92, 92, 135, 136, 90, 137, 138, 90, 90,
+            139, 140, 140, 140, 140, 140, 140, 141, 142, 143, 144, 140, 145, 146, 147, 140,
+            148, 149, 150, 151, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162,
+            163, 164, 165, 166, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 84,
+            177, 178, 179, 180, 180, 181, 182, 183, 184, 185, 186, 84, 187, 188, 189, 190,
+            191, 192, 193, 194, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 84,
+            205, 206, 207, 208, 209, 206, 210, 211, 212, 213, 214, 84, 215, 216, 217, 218,
+            219, 220, 221, 222, 222, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231,
+            232, 233, 234, 235, 235, 234, 236, 237, 238, 239, 240, 241, 242, 243, 244, 84,
+            245, 246, 247, 248, 248, 248, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+            258, 259, 260, 261, 259, 259, 262, 263, 260, 264, 265, 266, 267, 268, 269, 84,
+            270, 271, 271, 271, 271, 271, 272, 273, 274, 275, 276, 277, 84, 84, 84, 84,
+            278, 279, 280, 280, 281, 280, 282, 283, 284, 285, 286, 287, 84, 84, 84, 84,
+            288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 296, 296, 296, 298, 299, 300,
+            301, 302, 303, 299, 303, 303, 303, 304, 305, 306, 307, 308, 84, 84, 84, 84,
+            309, 309, 309, 309, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 309,
+            320, 321, 313, 322, 323, 323, 323, 323, 324, 325, 326, 326, 326, 326, 326, 327,
+            328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328,
+            328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328,
+            329, 329, 329, 329, 329, 329, 329, 329, 329, 330, 331, 330, 329, 329, 329, 329,
+            329, 330, 329, 329, 329, 329, 330, 331, 330, 329, 331, 329, 329, 329, 329, 329,
+            329, 329, 330, 329, 329, 329, 329, 329, 329, 329, 329, 332, 333, 334, 335, 336,
+            329, 329, 337, 338, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 340, 341,
+            342, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+            343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+            343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+            343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+            343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 344, 343, 343,
+            345, 346, 346, 347, 348, 348, 348, 348, 348, 348, 348, 348, 348, 349, 350, 351,
+            352, 352, 353, 354, 355, 355, 356, 84, 357, 357, 358, 84, 359, 360, 361, 84,
+            362, 362, 362, 362, 362, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
+            373, 374, 375, 376, 377, 377, 377, 377, 378, 377, 377, 377, 377, 377, 377, 379,
+            380, 377, 377, 377, 377, 381, 343, 343, 343, 343, 343, 343, 343, 343, 382, 84,
+            383, 383, 383, 384, 385, 386, 387, 388, 389, 390, 391, 391, 391, 392, 393, 84,
+            394, 394, 394, 394, 394, 395, 394, 394, 394, 396, 397, 398, 399, 399, 399, 399,
+            400, 400, 401, 402, 403, 403, 403, 403, 403, 403, 404, 405, 406, 407, 408, 409,
+            410, 411, 410, 411, 412, 413, 48, 414, 415, 416, 84, 84, 84, 84, 84, 84,
+            417, 418, 418, 418, 418, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+            429, 430, 430, 430, 431, 432, 433, 434, 435, 435, 435, 435, 436, 437, 438, 439,
+            440, 440, 440, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 449, 449, 450,
+            67, 451, 323, 323, 323, 323, 323, 452, 453, 84, 454, 48, 455, 456, 457, 458,
+            10, 10, 10, 10, 459, 460, 40, 40, 40, 40, 40, 461, 462, 463, 10, 464,
+            10, 10, 10, 465, 40, 40, 40, 466, 48, 48, 48, 48, 467, 468, 469, 48,
+            20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+            20, 20, 470, 471, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+            58, 55, 472, 473, 58, 55, 58, 55, 472, 473, 58, 474, 58, 55, 58, 472,
+            58, 475, 58, 475, 58, 475, 476, 477, 478, 479, 480, 481, 58, 482, 483, 484,
+            485, 486, 487, 488, 489, 490, 489, 491, 492, 489, 493, 494, 495, 496, 497, 498,
+            499, 500, 40, 501, 502, 502, 502, 502, 503, 84, 48, 504, 505, 48, 506, 84,
+            507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 499, 499, 517, 517, 517, 517,
+            518, 519, 520, 521, 522, 523, 524, 524, 524, 525, 526, 524, 524, 524, 527, 528,
+            528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528,
+            528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528,
+            524, 529, 524, 524, 530, 531, 524, 524, 524, 524, 524, 524, 524, 524, 524, 532,
+            524, 524, 524, 533, 528, 528, 534, 524, 524, 524, 524, 527, 530, 524, 524, 524,
+            524, 524, 524, 524, 535, 84, 84, 84, 524, 536, 84, 84, 499, 499, 499, 499,
+            499, 499, 499, 537, 524, 524, 538, 539, 539, 539, 539, 539, 539, 540, 499, 499,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+            524, 524, 524, 524, 524, 524, 541, 524, 542, 524, 524, 524, 524, 524, 524, 528,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 541, 524, 524,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 543, 544, 499,
+            499, 499, 537, 524, 524, 524, 524, 524, 545, 528, 528, 528, 546, 543, 528, 528,
+            547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+            547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+            528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528,
+            548, 549, 549, 550, 528, 528, 528, 528, 528, 528, 528, 551, 528, 528, 528, 552,
+            524, 524, 524, 524, 524, 524, 528, 528, 553, 520, 524, 524, 524, 524, 554, 524,
+            524, 524, 555, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+            556, 556, 556, 556, 556, 556, 557, 557, 557, 557, 557, 557, 558, 559, 560, 561,
+            63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 562, 563, 564, 565,
+            326, 326, 326, 326, 566, 567, 568, 568, 568, 568, 568, 568, 568, 569, 570, 571,
+            329, 329, 331, 84, 331, 331, 331, 331, 331, 331, 331, 331, 572, 572, 572, 572,
+            573, 574, 575, 576, 577, 578, 489, 579, 580, 489, 581, 582, 84, 84, 84, 84,
+            583, 583, 583, 584, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 585, 84,
+            583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+            583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 586, 84, 84, 84, 524, 587,
+            588, 543, 589, 590, 591, 592, 593, 594, 595, 596, 596, 596, 596, 596, 596, 596,
+            596, 596, 597, 598, 599, 600, 600, 600, 600, 600, 600, 600, 600, 600, 600, 601,
+            602, 603, 603, 603, 603, 603, 604, 328, 328, 328, 328, 328, 328, 328, 328, 328,
+            328, 605, 606, 524, 603, 603, 603, 603, 524, 524, 524, 524, 587, 84, 600, 600,
+            607, 607, 607, 608, 499, 609, 524, 524, 524, 499, 610, 499, 607, 607, 607, 611,
+            499, 609, 524, 524, 524, 524, 610, 499, 524, 524, 612, 612, 612, 612, 612, 613,
+            612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 524, 524, 524, 524, 524,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+            614, 614, 614, 614, 614, 614, 614, 614, 524, 524, 524, 524, 524, 524, 524, 524,
+            615, 615, 616, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+            615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+            615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+            615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+            615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+            615, 617, 618, 618, 618, 618, 618, 618, 619, 84, 620, 620, 620, 620, 620, 621,
+            622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622,
+            622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622,
+            622, 623, 622, 622, 624, 625, 84, 84, 68, 68, 68, 68, 68, 626, 627, 628,
+            68, 68, 68, 629, 630, 630, 630, 630, 630, 630, 630, 630, 631, 632, 633, 84,
+            45, 45, 634, 43, 635, 20, 22, 20, 20, 20, 20, 20, 20, 20, 636, 637,
+            20, 638, 639, 20, 20, 640, 641, 20, 642, 643, 644, 645, 84, 84, 646, 647,
+            648, 649, 650, 650, 651, 652, 653, 654, 655, 655, 655, 655, 655, 655, 656, 84,
+            657, 658, 658, 658, 658, 658, 659, 660, 661, 662, 663, 664, 665, 665, 666, 667,
+            668, 669, 670, 670, 671, 672, 673, 673, 674, 675, 676, 677, 328, 328, 328, 678,
+            679, 680, 680, 680, 680, 680, 681, 682, 683, 684, 685, 686, 687, 309, 313, 688,
+            689, 689, 689, 689, 689, 690, 691, 84, 692, 693, 694, 695, 309, 309, 696, 697,
+            698, 698, 698, 698, 698, 698, 699, 700, 701, 84, 84, 702, 703, 704, 705, 84,
+            706, 706, 706, 84, 331, 331, 10, 10, 10, 10, 10, 707, 708, 709, 710, 710,
+            710, 710, 710, 710, 710, 710, 710, 710, 703, 703, 703, 703, 711, 712, 713, 714,
+            328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328,
+            328, 328, 328, 328, 715, 84, 328, 328, 605, 716, 328, 328, 328, 328, 328, 715,
+            717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717,
+            717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717,
+            718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718,
+            718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 719, 614, 614,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 720, 84, 84, 84, 84,
+            721, 84, 722, 723, 85, 724, 725, 726, 727, 85, 92, 92, 92, 92, 92, 92,
+            92, 92, 92, 92, 92, 92, 728, 729, 730, 84, 731, 92, 92, 92, 92, 92,
+            92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+            92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+            92, 92, 92, 92, 92, 92, 92, 732, 733, 733, 92, 92, 92, 92, 92, 92,
+            92, 92, 734, 92, 92, 92, 92, 92, 92, 735, 84, 84, 84, 84, 92, 736,
+            48, 48, 737, 738, 48, 739, 740, 549, 741, 742, 743, 744, 745, 746, 747, 92,
+            92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 748,
+            749, 3, 4, 5, 6, 7, 7, 8, 9, 10, 10, 750, 751, 600, 752, 600,
+            600, 600, 600, 753, 328, 328, 328, 605, 754, 754, 754, 755, 756, 757, 84, 758,
+            759, 760, 759, 759, 761, 759, 759, 762, 759, 763, 759, 763, 84, 84, 84, 84,
+            759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 764,
+            765, 499, 499, 499, 499, 499, 766, 524, 767, 767, 767, 767, 767, 767, 768, 769,
+            770, 771, 524, 772, 773, 84, 84, 84, 84, 84, 524, 524, 524, 524, 524, 774,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            775, 775, 775, 776, 777, 777, 777, 777, 777, 777, 778, 84, 779, 499, 499, 780,
+            781, 781, 781, 781, 782, 783, 784, 784, 785, 786, 787, 787, 787, 787, 788, 789,
+            790, 790, 790, 791, 792, 792, 792, 792, 793, 792, 794, 84, 84, 84, 84, 84,
+            795, 795, 795, 795, 795, 796, 796, 796, 796, 796, 797, 797, 797, 797, 797, 797,
+            798, 798, 798, 799, 800, 801, 802, 802, 802, 802, 803, 804, 804, 804, 804, 805,
+            806, 806, 806, 806, 806, 84, 807, 807, 807, 807, 807, 807, 808, 809, 810, 811,
+            810, 811, 812, 813, 814, 813, 814, 815, 84, 84, 84, 84, 84, 84, 84, 84,
+            816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816,
+            816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816,
+            816, 816, 816, 816, 816, 816, 817, 84, 816, 816, 818, 84, 816, 84, 84, 84,
+            819, 40, 40, 40, 40, 40, 820, 821, 84, 84, 84, 84, 84, 84, 84, 84,
+            822, 823, 824, 824, 824, 824, 825, 826, 827, 827, 828, 829, 830, 830, 831, 832,
+            833, 833, 833, 834, 835, 836, 84, 84, 84, 84, 84, 84, 837, 837, 838, 839,
+            840, 840, 841, 842, 843, 843, 843, 844, 84, 84, 84, 84, 84, 84, 84, 84,
+            845, 845, 845, 845, 846, 846, 846, 847, 848, 848, 849, 848, 848, 848, 848, 848,
+            850, 851, 852, 853, 854, 854, 855, 856, 857, 858, 859, 860, 861, 861, 861, 862,
+            863, 863, 863, 864, 84, 84, 84, 84, 865, 866, 865, 865, 867, 868, 869, 84,
+            870, 870, 870, 870, 870, 870, 871, 872, 873, 873, 874, 875, 876, 876, 877, 878,
+            879, 879, 880, 881, 84, 882, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            883, 883, 883, 883, 883, 883, 883, 883, 883, 884, 84, 84, 84, 84, 84, 84,
+            885, 885, 885, 885, 885, 885, 886, 84, 887, 887, 887, 887, 887, 887, 888, 889,
+            890, 890, 890, 890, 891, 84, 892, 893, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 894, 894, 894, 895,
+            896, 896, 896, 896, 896, 897, 898, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            899, 899, 899, 900, 901, 84, 902, 902, 903, 904, 905, 906, 84, 84, 907, 907,
+            908, 909, 84, 84, 84, 84, 910, 910, 911, 912, 84, 84, 913, 913, 914, 84,
+            915, 916, 916, 916, 916, 916, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925,
+            926, 927, 927, 927, 927, 927, 928, 929, 930, 931, 932, 932, 932, 933, 934, 935,
+            936, 937, 937, 937, 938, 939, 940, 941, 942, 84, 943, 943, 943, 943, 944, 84,
+            945, 946, 946, 946, 946, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 84,
+            956, 956, 957, 956, 956, 958, 959, 960, 84, 84, 84, 84, 84, 84, 84, 84,
+            961, 962, 963, 964, 963, 965, 966, 966, 966, 966, 966, 967, 968, 969, 970, 971,
+            972, 973, 974, 975, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 984, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            985, 985, 985, 985, 985, 985, 986, 987, 988, 989, 990, 991, 992, 84, 84, 84,
+            993, 993, 993, 993, 993, 993, 994, 995, 996, 84, 997, 998, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            999, 999, 999, 999, 999, 1000, 1001, 1002, 1003, 1004, 1004, 1005, 84, 84, 84, 84,
+            1006, 1006, 1006, 1006, 1006, 1006, 1007, 1008, 1009, 84, 1010, 1011, 1012, 1013, 84, 84,
+            1014, 1014, 1014, 1014, 1014, 1015, 1016, 1017, 1018, 1019, 84, 84, 84, 84, 84, 84,
+            1020, 1020, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            1027, 1027, 1027, 1027, 1027, 1028, 1029, 1030, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 1031, 1031, 1031, 1031, 1032, 1032, 1032, 1032, 1033, 1034, 1035, 1036,
+            1037, 1038, 1039, 1040, 1040, 1040, 1041, 1042, 1043, 84, 1044, 1045, 84, 84, 84, 84,
+            84, 84, 84, 84, 1046, 1047, 1046, 1046, 1046, 1046, 1048, 1049, 1050, 84, 84, 84,
+            1051, 1052, 1053, 1053, 1053, 1053, 1054, 1055, 1056, 84, 1057, 1058, 1059, 1059, 1059, 1059,
+            1059, 1060, 1061, 1062, 1063, 84, 343, 343, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1065,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            1066, 1067, 1066, 1066, 1066, 1068, 1069, 1070, 1071, 84, 1072, 1073, 1074, 1075, 1076, 1077,
+            1077, 1077, 1078, 1079, 1079, 1080, 1081, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            1082, 1083, 1084, 1084, 1084, 1084, 1085, 1086, 1087, 84, 1088, 1089, 1090, 1091, 1092, 1092,
+            1092, 1093, 1094, 1095, 1096, 1097, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 1098, 1098, 1099, 1100,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 1101, 84, 1102, 1102, 1103, 1104, 1105, 1106, 1107, 1108,
+            1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+            1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+            1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+            1109, 1109, 1109, 1110, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1112, 1113, 84,
+            1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+            1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1114, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1116, 84,
+            1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
+            1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
+            1117, 1117, 1117, 1117, 1117, 1118, 1119, 1120, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121,
+            1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121,
+            1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1122, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+            630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+            630, 630, 630, 630, 630, 630, 630, 1123, 1124, 1124, 1124, 1125, 1126, 1127, 1128, 1128,
+            1128, 1128, 1128, 1128, 1128, 1128, 1128, 1129, 1130, 1131, 1132, 1132, 1132, 1133, 1134, 84,
+            1135, 1135, 1135, 1135, 1135, 1135, 1136, 1137, 1138, 84, 1139, 1140, 1141, 1135, 1135, 1142,
+            1135, 1135, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 1143, 1143, 1143, 1143, 1144, 1144, 1144, 1144,
+            1145, 1145, 1146, 1147, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1149, 1150, 1151, 1151, 1151, 1151, 1151,
+            1151, 1152, 1153, 1154, 84, 84, 84, 84, 84, 84, 84, 84, 1155, 84, 1156, 84,
+            1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157,
+            1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157,
+            1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157,
+            1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 84,
+            1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158,
+            1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158,
+            1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158,
+            1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1159, 84, 84, 84, 84, 84,
+            1157, 1160, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 1161, 1162,
+            1163, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596,
+            596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596,
+            596, 596, 596, 596, 1164, 84, 84, 84, 84, 84, 1165, 84, 1166, 84, 1167, 1167,
+            1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,
+            1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,
+            1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1168,
+            1169, 1169, 1169, 1169, 1169, 1169, 1169, 1169, 1169, 1169, 1169, 1169, 1169, 1170, 1169, 1171,
+            1169, 1172, 1169, 1173, 1174, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            48, 48, 48, 48, 48, 1175, 48, 48, 1176, 84, 524, 524, 524, 524, 524, 524,
+            524, 524, 524, 524, 524, 524, 524, 524, 587, 84, 84, 84, 84, 84, 84, 84,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 1177, 84,
+            524, 524, 524, 524, 535, 1178, 524, 524, 524, 524, 524, 524, 1179, 1180, 1181, 1182,
+            1183, 1184, 524, 524, 524, 1185, 524, 524, 524, 524, 524, 524, 524, 536, 84, 84,
+            770, 770, 770, 770, 770, 770, 770, 770, 1186, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 499, 499, 780, 84,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 535, 84, 499, 499, 499, 1187,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            1188, 1188, 1188, 1189, 1190, 1190, 1191, 1188, 1188, 1192, 1193, 1190, 1190, 1188, 1188, 1188,
+            1189, 1190, 1190, 1194, 1195, 1196, 1192, 1197, 1198, 1190, 1188, 1188, 1188, 1189, 1190, 1190,
+            1199, 1200, 1201, 1202, 1190, 1190, 1190, 1203, 1204, 1205, 1206, 1190, 1190, 1191, 1188, 1188,
+            1192, 1190, 1190, 1190, 1188, 1188, 1188, 1189, 1190, 1190, 1191, 1188, 1188, 1192, 1190, 1190,
+            1190, 1188, 1188, 1188, 1189, 1190, 1190, 1191, 1188, 1188, 1192, 1190, 1190, 1190, 1188, 1188,
+            1188, 1189, 1190, 1190, 1207, 1188, 1188, 1188, 1208, 1190, 1190, 1209, 1210, 1188, 1188, 1211,
+            1190, 1190, 1212, 1191, 1188, 1188, 1213, 1190, 1190, 1214, 1215, 1188, 1188, 1216, 1190, 1190,
+            1190, 1217, 1188, 1188, 1188, 1208, 1190, 1190, 1209, 1218, 4, 4, 4, 4, 4, 4,
+            1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
+            1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
+            1220, 1220, 1220, 1220, 1220, 1220, 1221, 1222, 1220, 1220, 1220, 1220, 1220, 1223, 1224, 1219,
+            1225, 1226, 84, 1227, 1228, 1220, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            10, 1229, 10, 721, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            1230, 1231, 1231, 1232, 1233, 1234, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            1235, 1235, 1235, 1235, 1235, 1236, 1237, 1238, 1239, 1240, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 1241, 1241, 1241, 1242, 84, 84, 1243, 1243, 1243, 1243, 1243, 1244, 1245, 1246,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 331, 1247, 329, 331,
+            1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
+            1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1249, 1250, 1251, 84, 84, 84, 84, 84,
+            1252, 1252, 1252, 1252, 1253, 1254, 1254, 1254, 1255, 1256, 1257, 1258, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 1259, 499,
+            499, 499, 499, 499, 499, 1260, 1261, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            1259, 499, 499, 499, 499, 1262, 499, 1263, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            1264, 92, 92, 92, 1265, 1266, 1267, 1268, 1269, 1270, 1265, 1271, 1265, 1267, 1267, 1272,
+            92, 1273, 92, 1274, 1275, 1273, 92, 1274, 84, 84, 84, 84, 84, 84, 1276, 84,
+            524, 524, 524, 524, 524, 587, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+            524, 524, 587, 84, 524, 535, 1178, 524, 1178, 524, 1178, 524, 524, 524, 1177, 84,
+            499, 1277, 524, 524, 524, 524, 539, 539, 539, 1278, 539, 539, 539, 1278, 539, 539,
+            539, 1278, 524, 524, 524, 1177, 84, 84, 84, 84, 84, 84, 1279, 524, 524, 524,
+            1280, 84, 524, 524, 524, 524, 524, 587, 524, 1281, 1282, 84, 1177, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 1283,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 1284, 524, 772, 524, 772,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 587, 84,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 1281, 524, 587, 1281, 84,
+            524, 587, 524, 524, 524, 524, 524, 524, 524, 84, 524, 1282, 524, 524, 524, 524,
+            524, 84, 524, 524, 524, 1177, 1282, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 587, 84, 524, 1177, 772, 772,
+            535, 84, 524, 524, 524, 772, 524, 536, 1177, 84, 524, 1282, 524, 84, 535, 84,
+            524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+            524, 524, 1285, 524, 524, 524, 524, 524, 524, 536, 84, 84, 84, 84, 4, 1286,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 84, 84, 84, 84,
+            614, 614, 614, 614, 614, 614, 614, 1287, 614, 614, 614, 614, 614, 614, 614, 614,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+            614, 614, 614, 719, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+            614, 614, 614, 614, 720, 84, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 1287, 84, 84, 84,
+            614, 614, 614, 719, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            614, 614, 614, 614, 614, 614, 614, 614, 614, 1288, 84, 84, 84, 84, 84, 84,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            1289, 84, 84, 84, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496,
+            84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+            48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+            48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 84, 84,
+            718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718,
+            718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 1290,
+        };
+
+        inline constexpr uint16_t property_stage3[10328] = {
+            57, 57, 57, 57, 57, 57, 57, 57, 57, 16441, 16441, 16441, 16441, 16441, 57, 57,
+            16438, 49, 49, 49, 51, 49, 49, 49, 45, 46, 49, 50, 49, 44, 49, 49,
+            40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 49, 49, 50, 50, 50, 49,
+            49, 10432, 10432, 10432, 10432, 10432, 10432, 10432, 10432, 10432, 10432, 10432, 10432, 10432, 10432, 10432,
+            10432, 10432, 10432, 45, 49, 46, 52, 43, 52, 10433, 10433, 10433, 10433, 10433, 10433, 10433,
+            10433, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 45, 50, 46, 50, 57,
+            57, 57, 57, 57, 57, 16441, 57, 57, 16438, 49, 51, 51, 51, 51, 53, 49,
+            52, 53, 10436, 47, 50, 58, 53, 52, 53, 50, 42, 42, 52, 8225, 49, 49,
+            52, 42, 10436, 48, 42, 42, 42, 49, 10432, 10432, 10432, 10432, 10432, 10432, 10432, 50,
+            10432, 10432, 10432, 10432, 10432, 10432, 10432, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 50,
+            10432, 10433, 10432, 10433, 10432, 10433, 10432, 10433, 10433, 10432, 10433, 10432, 10433, 10432, 10433, 10432,
+            10433, 10433, 10432, 10433, 10432, 10433, 10432, 10433, 10432, 10432, 10433, 10432, 10433, 10432, 10433, 10433,
+            10433, 10432, 10432, 10433, 10432, 10433, 10432, 10432, 10433, 10432, 10432, 10432, 10433, 10433, 10432, 10432,
+            10432, 10432, 10433, 10432, 10432, 10433, 10432, 10432, 10432, 10433, 10433, 10433, 10432, 10432, 10433, 10432,
+            10432, 10433, 10432, 10433, 10432, 10433, 10432, 10432, 10433, 10432, 10433, 10433, 10432, 10433, 10432, 10432,
+            10433, 10432, 10432, 10432, 10433, 10432, 10433, 10432, 10432, 10433, 10433, 10436, 10432, 10433, 10433, 10433,
+            10436, 10436, 10436, 10436, 10432, 10434, 10433, 10432, 10434, 10433, 10432, 10434, 10433, 10432, 10433, 10432,
+            10433, 10432, 10433, 10432, 10433, 10433, 10432, 10433, 10433, 10432, 10434, 10433, 10432, 10433, 10432, 10432,
+            10432, 10433, 10432, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10432, 10432, 10433, 10432, 10432, 10433,
+            10433, 10432, 10433, 10432, 10432, 10432, 10432, 10433, 10433, 10433, 10433, 10433, 10436, 10433, 10433, 10433,
+            10435, 10435, 10435, 10435, 10435, 10435, 10435, 10435, 10435, 8227, 8227, 8227, 8227, 8227, 8227, 8227,
+            8227, 8227, 52, 52, 52, 52, 8227, 8227, 8227, 8227, 8227, 8227, 8227, 8227, 8227, 8227,
+            8227, 8227, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+            10435, 10435, 10435, 10435, 10435, 52, 52, 52, 52, 52, 500, 500, 8227, 52, 8227, 52,
+            69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 8261, 69, 69,
+            9632, 9633, 9632, 9633, 8227, 1460, 9632, 9633, 29, 29, 9635, 9633, 9633, 9633, 49, 9632,
+            29, 29, 29, 29, 1460, 52, 9632, 49, 9632, 9632, 9632, 29, 9632, 29, 9632, 9632,
+            9633, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632,
+            9632, 9632, 29, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9633, 9633, 9633, 9633,
+            9633, 9633, 9633, 9633, 9633, 9633, 9633, 9633, 9633, 9633, 9633, 9633, 9633, 9633, 9633, 9632,
+            9633, 9633, 9632, 9632, 9632, 9633, 9633, 9633, 9632, 9633, 9632, 9633, 9632, 9633, 9632, 9633,
+            9632, 9633, 9056, 9057, 9056, 9057, 9056, 9057, 9056, 9057, 9056, 9057, 9056, 9057, 9056, 9057,
+            9633, 9633, 9633, 9633, 9632, 9633, 1458, 9632, 9633, 9632, 9632, 9633, 9633, 9632, 9632, 9632,
+            9184, 9184, 9184, 9184, 9184, 9184, 9184, 9184, 9185, 9185, 9185, 9185, 9185, 9185, 9185, 9185,
+            9184, 9185, 9184, 9185, 9184, 9185, 9184, 9185, 9184, 9185, 1013, 997, 997, 69, 69, 997,
+            999, 999, 9184, 9185, 9184, 9185, 9184, 9185, 9184, 9184, 9185, 9184, 9185, 9184, 9185, 9184,
+            9185, 9184, 9185, 9184, 9185, 9184, 9185, 9185, 29, 8416, 8416, 8416, 8416, 8416, 8416, 8416,
+            8416, 8416, 8416, 8416, 8416, 8416, 8416, 8416, 8416, 8416, 8416, 8416, 8416, 8416, 8416, 29,
+            29, 8419, 241, 241, 241, 241, 241, 241, 8417, 8417, 8417, 8417, 8417, 8417, 8417, 8417,
+            8417, 241, 236, 29, 29, 245, 245, 243, 29, 1733, 1733, 1733, 1733, 1733, 1733, 1733,
+            1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 9925, 9925, 9925, 9925, 9925, 9925, 9925, 9925,
+            9925, 9925, 9925, 9925, 9925, 9925, 1740, 9925, 1745, 9925, 9925, 1745, 9925, 9925, 1745, 9925,
+            29, 29, 29, 29, 29, 29, 29, 29, 9924, 9924, 9924, 9924, 9924, 9924, 9924, 9924,
+            9924, 9924, 9924, 29, 29, 29, 29, 9924, 9924, 9924, 9924, 1745, 1745, 29, 29, 29,
+            218, 218, 218, 218, 218, 58, 210, 210, 210, 209, 209, 211, 49, 209, 213, 213,
+            8389, 8389, 8389, 8389, 8389, 8389, 8389, 8389, 8389, 8389, 8389, 49, 218, 209, 209, 49,
+            8388, 8388, 8388, 8388, 8388, 8388, 8388, 8388, 8227, 8388, 8388, 8388, 8388, 8388, 8388, 8388,
+            8388, 8388, 8388, 8261, 8261, 8261, 8261, 8261, 8261, 8261, 8261, 8261, 8261, 8261, 8389, 8389,
+            197, 8389, 8389, 8389, 8389, 8389, 8389, 8389, 200, 200, 200, 200, 200, 200, 200, 200,
+            200, 200, 209, 209, 209, 209, 8388, 8388, 8261, 8388, 8388, 8388, 8388, 8388, 8388, 8388,
+            8388, 8388, 8388, 8388, 209, 8388, 8389, 8389, 8389, 8389, 8389, 8389, 8389, 58, 213, 197,
+            197, 8389, 8389, 8389, 8389, 8387, 8387, 8389, 8389, 213, 197, 197, 197, 8389, 8388, 8388,
+            200, 200, 8388, 8388, 8388, 213, 213, 8388, 4401, 4401, 4401, 4401, 4401, 4401, 4401, 4401,
+            4401, 4401, 4401, 4401, 4401, 4401, 29, 4410, 12580, 12581, 12580, 12580, 12580, 12580, 12580, 12580,
+            12580, 12580, 12580, 12580, 12580, 12580, 12580, 12580, 12581, 12581, 12581, 12581, 12581, 12581, 12581, 12581,
+            4389, 4389, 4389, 4389, 4389, 4389, 4389, 4389, 4389, 4389, 4389, 29, 29, 12580, 12580, 12580,
+            12932, 12932, 12932, 12932, 12932, 12932, 12932, 12932, 12932, 12932, 12932, 12932, 12932, 12932, 12933, 12933,
+            12933, 12933, 12933, 12933, 12933, 12933, 12933, 12933, 12933, 12932, 29, 29, 29, 29, 29, 29,
+            3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 11396, 11396, 11396, 11396, 11396, 11396,
+            11396, 11396, 11396, 11396, 11396, 11396, 11396, 11396, 11396, 11396, 11396, 3205, 3205, 3205, 3205, 3205,
+            3205, 3205, 3205, 3205, 11395, 11395, 3221, 3217, 3217, 3217, 11395, 29, 29, 3205, 3219, 3219,
+            12196, 12196, 12196, 12196, 12196, 12196, 12196, 12196, 12196, 12196, 12196, 12196, 12196, 12196, 12197, 12197,
+            4005, 4005, 12195, 12197, 12197, 12197, 12197, 12197, 12197, 12197, 12197, 12197, 12195, 12197, 12197, 12197,
+            12195, 12197, 12197, 12197, 12197, 4005, 29, 29, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017,
+            4017, 4017, 4017, 4017, 4017, 4017, 4017, 29, 10788, 10788, 10788, 10788, 10788, 10788, 10788, 10788,
+            10788, 2597, 2597, 2597, 29, 29, 2609, 29, 12580, 12580, 12580, 29, 29, 29, 29, 29,
+            212, 8388, 8388, 8388, 8388, 8388, 8388, 29, 218, 218, 29, 29, 29, 29, 29, 29,
+            197, 197, 197, 197, 197, 197, 197, 197, 8388, 8387, 197, 197, 197, 197, 197, 197,
+            197, 197, 197, 197, 8389, 8389, 8389, 8389, 197, 197, 58, 8389, 8389, 8389, 8389, 8389,
+            8389, 8389, 197, 197, 197, 197, 197, 197, 9253, 9253, 9253, 9254, 9252, 9252, 9252, 9252,
+            9252, 9252, 9252, 9252, 9252, 9252, 9252, 9252, 9252, 9252, 9253, 9254, 1061, 9252, 9254, 9254,
+            9254, 9253, 9253, 9253, 9253, 9253, 9253, 9253, 9253, 9254, 9254, 9254, 9254, 1061, 9254, 9254,
+            9252, 69, 69, 69, 69, 9253, 9253, 9253, 9252, 9252, 9253, 9253, 49, 49, 1064, 1064,
+            1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1073, 9251, 9252, 9252, 9252, 9252, 9252, 9252,
+            8612, 8613, 8614, 8614, 29, 8612, 8612, 8612, 8612, 8612, 8612, 8612, 8612, 29, 29, 8612,
+            8612, 29, 29, 8612, 8612, 8612, 8612, 8612, 8612, 8612, 8612, 8612, 8612, 8612, 8612, 8612,
+            8612, 29, 8612, 8612, 8612, 8612, 8612, 8612, 8612, 29, 8612, 29, 29, 29, 8612, 8612,
+            8612, 8612, 29, 29, 421, 8612, 8614, 8614, 8614, 8613, 8613, 8613, 8613, 29, 29, 8614,
+            8614, 29, 29, 8614, 8614, 421, 8612, 29, 29, 29, 29, 29, 29, 29, 29, 8614,
+            29, 29, 29, 29, 8612, 8612, 29, 8612, 8612, 8612, 8613, 8613, 29, 29, 424, 424,
+            424, 424, 424, 424, 424, 424, 424, 424, 8612, 8612, 435, 435, 426, 426, 426, 426,
+            426, 426, 437, 435, 8612, 433, 421, 29, 29, 9733, 9733, 9734, 29, 9732, 9732, 9732,
+            9732, 9732, 9732, 29, 29, 29, 29, 9732, 9732, 29, 29, 9732, 9732, 9732, 9732, 9732,
+            9732, 9732, 9732, 9732, 9732, 9732, 9732, 9732, 9732, 29, 9732, 9732, 9732, 9732, 9732, 9732,
+            9732, 29, 9732, 9732, 29, 9732, 9732, 29, 9732, 9732, 29, 29, 1541, 29, 9734, 9734,
+            9734, 9733, 9733, 29, 29, 29, 29, 9733, 9733, 29, 29, 9733, 9733, 1541, 29, 29,
+            29, 9733, 29, 29, 29, 29, 29, 29, 29, 9732, 9732, 9732, 9732, 29, 9732, 29,
+            29, 29, 29, 29, 29, 29, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 1544,
+            9733, 9733, 9732, 9732, 9732, 9733, 1553, 29, 29, 9669, 9669, 9670, 29, 9668, 9668, 9668,
+            9668, 9668, 9668, 9668, 9668, 9668, 29, 9668, 9668, 9668, 29, 9668, 9668, 9668, 9668, 9668,
+            9668, 9668, 9668, 9668, 9668, 9668, 9668, 9668, 9668, 29, 9668, 9668, 9668, 9668, 9668, 9668,
+            9668, 29, 9668, 9668, 29, 9668, 9668, 9668, 9668, 9668, 29, 29, 1477, 9668, 9670, 9670,
+            9670, 9669, 9669, 9669, 9669, 9669, 29, 9669, 9669, 9670, 29, 9670, 9670, 1477, 29, 29,
+            9668, 29, 29, 29, 29, 29, 29, 29, 9668, 9668, 9669, 9669, 29, 29, 1480, 1480,
+            1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1489, 1491, 29, 29, 29, 29, 29, 29,
+            29, 9668, 9669, 9669, 9669, 1477, 1477, 1477, 29, 11845, 11846, 11846, 29, 11844, 11844, 11844,
+            11844, 11844, 11844, 11844, 11844, 29, 29, 11844, 11844, 29, 29, 11844, 11844, 11844, 11844, 11844,
+            11844, 11844, 11844, 11844, 11844, 11844, 11844, 11844, 11844, 29, 11844, 11844, 11844, 11844, 11844, 11844,
+            11844, 29, 11844, 11844, 29, 11844, 11844, 11844, 11844, 11844, 29, 29, 3653, 11844, 11846, 11845,
+            11846, 11845, 11845, 11845, 11845, 29, 29, 11846, 11846, 29, 29, 11846, 11846, 3653, 29, 29,
+            29, 29, 29, 29, 29, 3653, 11845, 11846, 29, 29, 29, 29, 11844, 11844, 29, 11844,
+            11844, 11844, 11845, 11845, 29, 29, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656,
+            3669, 11844, 3658, 3658, 3658, 3658, 3658, 3658, 29, 29, 12805, 12804, 29, 12804, 12804, 12804,
+            12804, 12804, 12804, 29, 29, 29, 12804, 12804, 12804, 29, 12804, 12804, 12804, 12804, 29, 29,
+            29, 12804, 12804, 29, 12804, 29, 12804, 12804, 29, 29, 29, 12804, 12804, 29, 29, 29,
+            12804, 12804, 12804, 12804, 12804, 12804, 12804, 12804, 12804, 12804, 29, 29, 29, 29, 12806, 12806,
+            12805, 12806, 12806, 29, 29, 29, 12806, 12806, 12806, 29, 12806, 12806, 12806, 4613, 29, 29,
+            12804, 29, 29, 29, 29, 29, 29, 12806, 29, 29, 29, 29, 29, 29, 4616, 4616,
+            4616, 4616, 4616, 4616, 4616, 4616, 4616, 4616, 4618, 4618, 4618, 4629, 4629, 4629, 4629, 4629,
+            4629, 4627, 4629, 29, 29, 29, 29, 29, 12901, 12902, 12902, 12902, 4709, 12900, 12900, 12900,
+            12900, 12900, 12900, 12900, 12900, 29, 12900, 12900, 12900, 29, 12900, 12900, 12900, 12900, 12900, 12900,
+            12900, 12900, 12900, 12900, 12900, 12900, 12900, 12900, 12900, 12900, 29, 29, 4709, 12900, 12901, 12901,
+            12901, 12902, 12902, 12902, 12902, 29, 12901, 12901, 12901, 29, 12901, 12901, 12901, 4709, 29, 29,
+            29, 29, 29, 29, 29, 12901, 12901, 29, 12900, 12900, 12900, 29, 29, 12900, 29, 29,
+            12900, 12900, 12901, 12901, 29, 29, 4712, 4712, 4712, 4712, 4712, 4712, 4712, 4712, 4712, 4712,
+            29, 29, 29, 29, 29, 29, 29, 4721, 4714, 4714, 4714, 4714, 4714, 4714, 4714, 4725,
+            10148, 10149, 10150, 10150, 1969, 10148, 10148, 10148, 10148, 10148, 10148, 10148, 10148, 29, 10148, 10148,
+            10148, 29, 10148, 10148, 10148, 10148, 10148, 10148, 10148, 10148, 10148, 10148, 10148, 10148, 10148, 10148,
+            10148, 10148, 10148, 10148, 29, 10148, 10148, 10148, 10148, 10148, 29, 29, 1957, 10148, 10150, 10149,
+            10150, 10150, 10150, 10150, 10150, 29, 10149, 10150, 10150, 29, 10150, 10150, 10149, 1957, 29, 29,
+            29, 29, 29, 29, 29, 10150, 10150, 29, 29, 29, 29, 29, 29, 10148, 10148, 29,
+            10148, 10148, 10149, 10149, 29, 29, 1960, 1960, 1960, 1960, 1960, 1960, 1960, 1960, 1960, 1960,
+            29, 10148, 10148, 29, 29, 29, 29, 29, 10757, 10757, 10758, 10758, 10756, 10756, 10756, 10756,
+            10756, 10756, 10756, 10756, 10756, 29, 10756, 10756, 10756, 29, 10756, 10756, 10756, 10756, 10756, 10756,
+            10756, 10756, 10756, 10756, 10756, 10756, 10756, 10756, 10756, 10756, 10756, 2565, 2565, 10756, 10758, 10758,
+            10758, 10757, 10757, 10757, 10757, 29, 10758, 10758, 10758, 29, 10758, 10758, 10758, 2565, 10756, 2581,
+            29, 29, 29, 29, 10756, 10756, 10756, 10758, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 10756,
+            10756, 10756, 10757, 10757, 29, 29, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
+            2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2581, 10756, 10756, 10756, 10756, 10756, 10756,
+            29, 12389, 12390, 12390, 29, 12388, 12388, 12388, 12388, 12388, 12388, 12388, 12388, 12388, 12388, 12388,
+            12388, 12388, 12388, 12388, 12388, 12388, 12388, 29, 29, 29, 12388, 12388, 12388, 12388, 12388, 12388,
+            12388, 12388, 29, 12388, 12388, 12388, 12388, 12388, 12388, 12388, 12388, 12388, 29, 12388, 29, 29,
+            29, 29, 4197, 29, 29, 29, 29, 12390, 12390, 12390, 12389, 12389, 12389, 29, 12389, 29,
+            12390, 12390, 12390, 12390, 12390, 12390, 12390, 12390, 29, 29, 29, 29, 29, 29, 4200, 4200,
+            4200, 4200, 4200, 4200, 4200, 4200, 4200, 4200, 29, 29, 12390, 12390, 4209, 29, 29, 29,
+            29, 12964, 12964, 12964, 12964, 12964, 12964, 12964, 12964, 12964, 12964, 12964, 12964, 12964, 12964, 12964,
+            12964, 12965, 12964, 12964, 12965, 12965, 12965, 12965, 12965, 12965, 12965, 29, 29, 29, 29, 51,
+            12964, 12964, 12964, 12964, 12964, 12964, 12963, 4773, 4773, 4773, 4773, 4773, 4773, 12965, 4773, 4785,
+            4776, 4776, 4776, 4776, 4776, 4776, 4776, 4776, 4776, 4776, 4785, 4785, 29, 29, 29, 29,
+            29, 10404, 10404, 29, 10404, 29, 10404, 10404, 10404, 10404, 10404, 29, 10404, 10404, 10404, 10404,
+            10404, 10404, 10404, 10404, 10404, 10404, 10404, 10404, 10404, 10404, 10404, 10404, 29, 10404, 29, 10404,
+            10404, 10405, 10404, 10404, 10405, 10405, 10405, 10405, 10405, 10405, 2213, 10405, 10405, 10404, 29, 29,
+            10404, 10404, 10404, 10404, 10404, 29, 10403, 29, 2213, 2213, 2213, 2213, 2213, 10405, 29, 29,
+            2216, 2216, 2216, 2216, 2216, 2216, 2216, 2216, 2216, 2216, 29, 29, 10404, 10404, 10404, 10404,
+            12996, 4821, 4821, 4821, 4817, 4817, 4817, 4817, 4817, 4817, 4817, 4817, 4817, 4817, 4817, 4817,
+            4817, 4817, 4817, 4821, 4817, 4821, 4821, 4821, 4805, 4805, 4821, 4821, 4821, 4821, 4821, 4821,
+            4808, 4808, 4808, 4808, 4808, 4808, 4808, 4808, 4808, 4808, 4810, 4810, 4810, 4810, 4810, 4810,
+            4810, 4810, 4810, 4810, 4821, 4805, 4821, 4805, 4821, 4805, 4813, 4814, 4813, 4814, 4806, 4806,
+            12996, 12996, 12996, 12996, 12996, 12996, 12996, 12996, 29, 12996, 12996, 12996, 12996, 12996, 12996, 12996,
+            12996, 12996, 12996, 12996, 12996, 29, 29, 29, 29, 12997, 12997, 12997, 12997, 12997, 12997, 12997,
+            12997, 12997, 12997, 12997, 12997, 12997, 12997, 12998, 12997, 12997, 4805, 4805, 4805, 4817, 4805, 4805,
+            12996, 12996, 12996, 12996, 12996, 12997, 12997, 12997, 12997, 12997, 12997, 12997, 12997, 12997, 12997, 12997,
+            12997, 12997, 12997, 12997, 12997, 29, 4821, 4821, 4821, 4821, 4821, 4821, 4821, 4821, 4805, 4821,
+            4821, 4821, 4821, 4821, 4821, 29, 4821, 4821, 4817, 4817, 4817, 4817, 4817, 53, 53, 53,
+            53, 4817, 4817, 29, 29, 29, 29, 29, 11236, 11236, 11236, 11236, 11236, 11236, 11236, 11236,
+            11236, 11236, 11236, 11238, 11238, 11237, 11237, 11237, 11237, 11238, 11237, 11237, 11237, 11237, 11237, 3045,
+            11238, 3045, 3045, 11238, 11238, 11237, 11237, 11236, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048,
+            3048, 3048, 3057, 3057, 3057, 3057, 3057, 3057, 11236, 11236, 11236, 11236, 11236, 11236, 11238, 11238,
+            11237, 11237, 11236, 11236, 11236, 11236, 11237, 11237, 11237, 11236, 11238, 11238, 11238, 11236, 11236, 11238,
+            11238, 11238, 11238, 11238, 11238, 11238, 11236, 11236, 11236, 11237, 11237, 11237, 11237, 11236, 11236, 11236,
+            11236, 11236, 11237, 11238, 11238, 11237, 11237, 11238, 11238, 11238, 11238, 11238, 11238, 11237, 11236, 11238,
+            3048, 3048, 11238, 11238, 11238, 11237, 3061, 3061, 9504, 9504, 9504, 9504, 9504, 9504, 9504, 9504,
+            9504, 9504, 9504, 9504, 9504, 9504, 29, 9504, 29, 29, 29, 29, 29, 9504, 29, 29,
+            9505, 9505, 9505, 9505, 9505, 9505, 9505, 9505, 9505, 9505, 9505, 49, 9507, 9505, 9505, 9505,
+            9796, 9796, 9796, 9796, 9796, 9796, 9796, 9796, 9476, 9476, 9476, 9476, 9476, 9476, 9476, 9476,
+            9476, 29, 9476, 9476, 9476, 9476, 29, 29, 9476, 9476, 9476, 9476, 9476, 9476, 9476, 29,
+            9476, 9476, 9476, 29, 29, 1285, 1285, 1285, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
+            1297, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+            1290, 1290, 1290, 1290, 1290, 29, 29, 29, 1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301,
+            1301, 1301, 29, 29, 29, 29, 29, 29, 8992, 8992, 8992, 8992, 8992, 8992, 8992, 8992,
+            8992, 8992, 8992, 8992, 8992, 8992, 29, 29, 8993, 8993, 8993, 8993, 8993, 8993, 29, 29,
+            652, 8836, 8836, 8836, 8836, 8836, 8836, 8836, 8836, 8836, 8836, 8836, 8836, 8836, 8836, 8836,
+            8836, 8836, 8836, 8836, 8836, 661, 657, 8836, 19702, 11492, 11492, 11492, 11492, 11492, 11492, 11492,
+            11492, 11492, 11492, 11492, 11492, 11492, 11492, 11492, 11492, 11492, 11492, 3309, 3310, 29, 29, 29,
+            12164, 12164, 12164, 12164, 12164, 12164, 12164, 12164, 12164, 12164, 12164, 49, 49, 49, 12169, 12169,
+            12169, 12164, 12164, 12164, 12164, 12164, 12164, 12164, 12164, 29, 29, 29, 29, 29, 29, 29,
+            12612, 12612, 12612, 12612, 12612, 12612, 12612, 12612, 12612, 12612, 12613, 12613, 4421, 4422, 29, 29,
+            29, 29, 29, 29, 29, 29, 29, 12612, 9860, 9860, 9860, 9860, 9860, 9860, 9860, 9860,
+            9860, 9860, 9861, 9861, 1670, 49, 49, 29, 8804, 8804, 8804, 8804, 8804, 8804, 8804, 8804,
+            8804, 8804, 8805, 8805, 29, 29, 29, 29, 12644, 12644, 12644, 12644, 12644, 12644, 12644, 12644,
+            12644, 12644, 12644, 12644, 12644, 29, 12644, 12644, 12644, 29, 12645, 12645, 29, 29, 29, 29,
+            10308, 10308, 10308, 10308, 10308, 10308, 10308, 10308, 10308, 10308, 10308, 10308, 2117, 2117, 10310, 10309,
+            10309, 10309, 10309, 10309, 10309, 10309, 10310, 10310, 10310, 10310, 10310, 10310, 10310, 10310, 10309, 10310,
+            10310, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2129, 2129, 2129, 10307,
+            2129, 2129, 2129, 2131, 10308, 2117, 29, 29, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2120,
+            2120, 2120, 29, 29, 29, 29, 29, 29, 2122, 2122, 2122, 2122, 2122, 2122, 2122, 2122,
+            2122, 2122, 29, 29, 29, 29, 29, 29, 2961, 2961, 49, 49, 2961, 49, 2956, 2961,
+            2961, 2961, 2961, 2949, 2949, 2949, 2970, 2949, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952,
+            2952, 2952, 29, 29, 29, 29, 29, 29, 11140, 11140, 11140, 11140, 11140, 11140, 11140, 11140,
+            11140, 11140, 11140, 11139, 11140, 11140, 11140, 11140, 11140, 29, 29, 29, 29, 29, 29, 29,
+            11140, 11140, 11140, 11140, 11140, 11141, 11141, 11140, 11140, 11141, 11140, 29, 29, 29, 29, 29,
+            8836, 8836, 8836, 8836, 8836, 8836, 29, 29, 10500, 10500, 10500, 10500, 10500, 10500, 10500, 10500,
+            10500, 10500, 10500, 10500, 10500, 10500, 10500, 29, 10501, 10501, 10501, 10502, 10502, 10502, 10502, 10501,
+            10501, 10502, 10502, 10502, 29, 29, 29, 29, 10502, 10502, 10501, 10502, 10502, 10502, 10502, 10502,
+            10502, 2309, 2309, 2309, 29, 29, 29, 29, 2325, 29, 29, 29, 2321, 2321, 2312, 2312,
+            2312, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 12676, 12676, 12676, 12676, 12676, 12676, 12676, 12676,
+            12676, 12676, 12676, 12676, 12676, 12676, 29, 29, 12676, 12676, 12676, 12676, 12676, 29, 29, 29,
+            11332, 11332, 11332, 11332, 11332, 11332, 11332, 11332, 11332, 11332, 11332, 11332, 29, 29, 29, 29,
+            11332, 11332, 29, 29, 29, 29, 29, 29, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144,
+            3144, 3144, 3146, 29, 29, 29, 3157, 3157, 2133, 2133, 2133, 2133, 2133, 2133, 2133, 2133,
+            8772, 8772, 8772, 8772, 8772, 8772, 8772, 8772, 8772, 8772, 8772, 8772, 8772, 8772, 8772, 8773,
+            8773, 8774, 8774, 8773, 29, 29, 593, 593, 12708, 12708, 12708, 12708, 12708, 12708, 12708, 12708,
+            12708, 12708, 12708, 12708, 12708, 12710, 12709, 12710, 12709, 12709, 12709, 12709, 12709, 12709, 12709, 29,
+            4517, 12710, 12709, 12710, 12710, 12709, 12709, 12709, 12709, 12709, 12709, 12709, 12709, 12710, 12710, 12710,
+            12710, 12710, 12710, 12709, 12709, 4517, 4517, 4517, 4517, 4517, 4517, 4517, 4517, 29, 29, 4517,
+            4520, 4520, 4520, 4520, 4520, 4520, 4520, 4520, 4520, 4520, 29, 29, 29, 29, 29, 29,
+            4529, 4529, 4529, 4529, 4529, 4529, 4529, 12707, 4529, 4529, 4529, 4529, 4529, 4529, 29, 29,
+            69, 69, 69, 69, 69, 69, 71, 8261, 8261, 69, 69, 69, 69, 69, 69, 69,
+            69, 69, 69, 69, 8261, 8261, 8261, 29, 8485, 8485, 8485, 8485, 8486, 8484, 8484, 8484,
+            8484, 8484, 8484, 8484, 8484, 8484, 8484, 8484, 8484, 8484, 8484, 8484, 293, 8486, 8485, 8485,
+            8485, 8485, 8485, 8486, 8485, 8486, 8486, 8486, 8486, 8486, 8485, 8486, 294, 8484, 8484, 8484,
+            8484, 8484, 8484, 8484, 8484, 29, 29, 29, 296, 296, 296, 296, 296, 296, 296, 296,
+            296, 296, 305, 305, 305, 305, 305, 305, 305, 309, 309, 309, 309, 309, 309, 309,
+            309, 309, 309, 293, 293, 293, 293, 293, 293, 293, 293, 293, 309, 309, 309, 309,
+            309, 309, 309, 309, 309, 305, 305, 29, 12517, 12517, 12518, 12516, 12516, 12516, 12516, 12516,
+            12516, 12516, 12516, 12516, 12516, 12516, 12516, 12516, 12516, 12518, 12517, 12517, 12517, 12517, 12518, 12518,
+            12517, 12517, 4326, 4325, 12517, 12517, 12516, 12516, 4328, 4328, 4328, 4328, 4328, 4328, 4328, 4328,
+            4328, 4328, 12516, 12516, 12516, 12516, 12516, 12516, 8580, 8580, 8580, 8580, 8580, 8580, 8580, 8580,
+            8580, 8580, 8580, 8580, 8580, 8580, 389, 8582, 8581, 8581, 8582, 8582, 8582, 8581, 8582, 8581,
+            8581, 8581, 390, 390, 29, 29, 29, 29, 29, 29, 29, 29, 401, 401, 401, 401,
+            10468, 10468, 10468, 10468, 10468, 10468, 10468, 10468, 10468, 10468, 10468, 10468, 10470, 10470, 10470, 10470,
+            10470, 10470, 10470, 10470, 10469, 10469, 10469, 10469, 10469, 10469, 10469, 10469, 10470, 10470, 10469, 2277,
+            29, 29, 29, 2289, 2289, 2289, 2289, 2289, 2280, 2280, 2280, 2280, 2280, 2280, 2280, 2280,
+            2280, 2280, 29, 29, 29, 10468, 10468, 10468, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336,
+            3336, 3336, 11524, 11524, 11524, 11524, 11524, 11524, 11524, 11524, 11524, 11524, 11524, 11524, 11524, 11524,
+            11523, 11523, 11523, 11523, 11523, 11523, 3345, 3345, 9185, 29, 29, 29, 29, 29, 29, 29,
+            9504, 9504, 9504, 29, 29, 9504, 9504, 9504, 4337, 4337, 4337, 4337, 4337, 4337, 4337, 4337,
+            69, 69, 69, 49, 69, 69, 69, 69, 69, 38, 69, 69, 69, 69, 69, 69,
+            69, 8228, 8228, 8228, 8228, 69, 8228, 8228, 8228, 8228, 8228, 8228, 69, 8228, 8228, 38,
+            69, 69, 8228, 29, 29, 29, 29, 29, 10433, 10433, 10433, 10433, 10433, 10433, 9633, 9633,
+            9633, 9633, 9633, 9185, 10435, 10435, 10435, 10435, 10435, 10435, 10435, 10435, 10435, 9635, 9635, 9635,
+            9635, 9635, 10435, 10435, 10435, 10435, 9635, 9635, 9635, 9635, 9635, 10433, 10433, 10433, 10433, 10433,
+            9187, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10435, 10435, 10435, 10435, 10435,
+            10435, 10435, 10435, 10435, 10435, 10435, 10435, 9635, 69, 69, 69, 69, 69, 69, 69, 8261,
+            8261, 8261, 8261, 8261, 8261, 8261, 8261, 8261, 8261, 8261, 8261, 8261, 8261, 69, 69, 69,
+            10432, 10433, 10432, 10433, 10432, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10432, 10433,
+            9633, 9633, 9633, 9633, 9633, 9633, 29, 29, 9632, 9632, 9632, 9632, 9632, 9632, 29, 29,
+            29, 9632, 29, 9632, 29, 9632, 29, 9632, 9634, 9634, 9634, 9634, 9634, 9634, 9634, 9634,
+            9633, 9633, 9633, 9633, 9633, 29, 9633, 9633, 9632, 9632, 9632, 9632, 9634, 1460, 9633, 1460,
+            1460, 1460, 9633, 9633, 9633, 29, 9633, 9633, 9632, 9632, 9632, 9632, 9634, 1460, 1460, 1460,
+            9633, 9633, 9633, 9633, 29, 29, 9633, 9633, 9632, 9632, 9632, 9632, 29, 1460, 1460, 1460,
+            9632, 9632, 9632, 9632, 9632, 1460, 1460, 1460, 29, 29, 9633, 9633, 9633, 29, 9633, 9633,
+            9632, 9632, 9632, 9632, 9634, 1460, 1460, 29, 16438, 16438, 16438, 16438, 16438, 16438, 16438, 16438,
+            16438, 16438, 16438, 58, 90, 90, 58, 58, 44, 44, 44, 44, 44, 44, 49, 49,
+            47, 48, 45, 47, 47, 48, 45, 47, 49, 49, 49, 49, 49, 49, 49, 49,
+            16439, 16440, 58, 58, 58, 58, 58, 16438, 49, 47, 48, 49, 49, 49, 49, 43,
+            43, 49, 49, 49, 50, 45, 46, 49, 49, 49, 50, 49, 43, 49, 49, 49,
+            49, 49, 49, 49, 49, 49, 49, 16438, 58, 58, 58, 58, 58, 29, 58, 58,
+            58, 58, 58, 58, 58, 58, 58, 58, 42, 10435, 29, 29, 42, 42, 42, 42,
+            42, 42, 50, 50, 50, 45, 46, 10435, 42, 42, 42, 42, 42, 42, 42, 42,
+            42, 42, 50, 50, 50, 45, 46, 29, 10435, 10435, 10435, 10435, 10435, 29, 29, 29,
+            51, 51, 51, 51, 51, 51, 51, 51, 51, 29, 29, 29, 29, 29, 29, 29,
+            69, 69, 69, 69, 69, 71, 71, 71, 71, 69, 71, 71, 71, 69, 69, 69,
+            69, 29, 29, 29, 29, 29, 29, 29, 53, 53, 8224, 53, 53, 53, 53, 8224,
+            53, 53, 8225, 8224, 8224, 8224, 8225, 8225, 8224, 8224, 8224, 8225, 53, 8224, 53, 53,
+            50, 8224, 8224, 8224, 8224, 8224, 53, 53, 53, 53, 53, 53, 8224, 53, 9632, 53,
+            8224, 53, 10432, 10432, 8224, 8224, 53, 8225, 8224, 8224, 10432, 8224, 8225, 8228, 8228, 8228,
+            8228, 8225, 53, 53, 8225, 8225, 8224, 8224, 50, 50, 50, 50, 50, 8224, 8225, 8225,
+            8225, 8225, 53, 50, 53, 53, 10433, 53, 10441, 10441, 10441, 10441, 10441, 10441, 10441, 10441,
+            10441, 10441, 10441, 10432, 10433, 10441, 10441, 10441, 10441, 42, 53, 53, 29, 29, 29, 29,
+            50, 50, 50, 50, 50, 53, 53, 53, 53, 53, 50, 50, 53, 53, 53, 53,
+            50, 53, 53, 50, 53, 53, 50, 53, 53, 53, 53, 53, 53, 53, 50, 53,
+            53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 50, 50,
+            53, 53, 50, 53, 50, 53, 53, 53, 53, 53, 53, 53, 50, 50, 50, 50,
+            50, 50, 50, 50, 50, 50, 50, 50, 45, 46, 45, 46, 53, 53, 53, 53,
+            50, 50, 53, 53, 53, 53, 53, 53, 53, 45, 46, 53, 53, 53, 53, 53,
+            53, 53, 53, 53, 50, 53, 53, 53, 53, 53, 53, 50, 50, 50, 50, 50,
+            50, 50, 50, 50, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 29,
+            53, 53, 53, 29, 29, 29, 29, 29, 42, 42, 42, 42, 53, 53, 53, 53,
+            53, 53, 53, 53, 53, 53, 8245, 8245, 8245, 8245, 8245, 8245, 8245, 8245, 8245, 8245,
+            8245, 8245, 42, 42, 42, 42, 42, 42, 53, 53, 53, 53, 53, 53, 53, 50,
+            53, 50, 53, 53, 53, 53, 53, 53, 45, 46, 45, 46, 45, 46, 45, 46,
+            45, 46, 45, 46, 45, 46, 42, 42, 50, 50, 50, 50, 50, 45, 46, 50,
+            50, 50, 50, 50, 50, 50, 45, 46, 565, 565, 565, 565, 565, 565, 565, 565,
+            50, 50, 50, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45,
+            46, 50, 50, 50, 50, 50, 50, 50, 45, 46, 45, 46, 50, 50, 50, 50,
+            50, 50, 50, 50, 45, 46, 50, 50, 50, 50, 50, 50, 50, 53, 53, 50,
+            53, 53, 53, 53, 29, 29, 53, 53, 53, 53, 53, 53, 53, 53, 29, 53,
+            9536, 9536, 9536, 9536, 9536, 9536, 9536, 9536, 9537, 9537, 9537, 9537, 9537, 9537, 9537, 9537,
+            10432, 10433, 10432, 10432, 10432, 10433, 10433, 10432, 10433, 10432, 10433, 10432, 10433, 10432, 10432, 10432,
+            10432, 10433, 10432, 10433, 10433, 10432, 10433, 10433, 10433, 10433, 10433, 10433, 10435, 10435, 10432, 10432,
+            9056, 9057, 9056, 9057, 9057, 885, 885, 885, 885, 885, 885, 9056, 9057, 9056, 9057, 869,
+            869, 869, 9056, 9057, 29, 29, 29, 29, 29, 881, 881, 881, 881, 874, 881, 881,
+            9505, 9505, 9505, 9505, 9505, 9505, 29, 9505, 29, 29, 29, 29, 29, 9505, 29, 29,
+            13028, 13028, 13028, 13028, 13028, 13028, 13028, 13028, 29, 29, 29, 29, 29, 29, 29, 13027,
+            4849, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 4837,
+            9189, 9189, 9189, 9189, 9189, 9189, 9189, 9189, 49, 49, 47, 48, 47, 48, 49, 49,
+            49, 47, 48, 49, 47, 48, 49, 49, 49, 49, 49, 49, 49, 49, 49, 44,
+            49, 49, 44, 49, 47, 48, 49, 49, 47, 48, 45, 46, 45, 46, 45, 46,
+            45, 46, 49, 49, 49, 49, 49, 8227, 49, 49, 44, 44, 49, 49, 49, 49,
+            44, 49, 45, 49, 49, 49, 49, 49, 53, 53, 49, 49, 49, 45, 46, 45,
+            46, 45, 46, 45, 46, 44, 29, 29, 1589, 1589, 1589, 1589, 1589, 1589, 1589, 1589,
+            1589, 1589, 29, 1589, 1589, 1589, 1589, 1589, 1589, 1589, 1589, 1589, 29, 29, 29, 29,
+            1589, 1589, 1589, 1589, 1589, 1589, 29, 29, 53, 53, 53, 53, 29, 29, 29, 29,
+            16438, 49, 49, 49, 53, 9763, 8228, 9769, 45, 46, 53, 53, 45, 46, 45, 46,
+            45, 46, 45, 46, 44, 45, 46, 46, 53, 9769, 9769, 9769, 9769, 9769, 9769, 9769,
+            9769, 9769, 69, 69, 69, 69, 1606, 1606, 44, 8227, 8227, 8227, 8227, 8227, 53, 53,
+            9769, 9769, 9769, 9763, 8228, 49, 53, 53, 29, 9956, 9956, 9956, 9956, 9956, 9956, 9956,
+            9956, 9956, 9956, 9956, 9956, 9956, 9956, 9956, 9956, 9956, 9956, 9956, 9956, 9956, 9956, 29,
+            29, 69, 69, 52, 52, 9955, 9955, 9956, 44, 10180, 10180, 10180, 10180, 10180, 10180, 10180,
+            10180, 10180, 10180, 10180, 10180, 10180, 10180, 10180, 10180, 10180, 10180, 49, 8227, 10179, 10179, 10180,
+            29, 29, 29, 29, 29, 8676, 8676, 8676, 8676, 8676, 8676, 8676, 8676, 8676, 8676, 8676,
+            29, 9796, 9796, 9796, 9796, 9796, 9796, 9796, 9796, 9796, 9796, 9796, 9796, 9796, 9796, 29,
+            53, 53, 42, 42, 42, 42, 53, 53, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+            1621, 1621, 1621, 1621, 1621, 1621, 1621, 29, 42, 42, 53, 53, 53, 53, 53, 53,
+            53, 42, 42, 42, 42, 42, 42, 42, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 53,
+            2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 53,
+            9764, 9764, 9764, 9764, 9764, 9764, 9764, 9764, 13316, 13316, 13316, 13316, 13316, 13316, 13316, 13316,
+            13316, 13316, 13316, 13316, 13316, 13315, 13316, 13316, 13316, 13316, 13316, 13316, 13316, 29, 29, 29,
+            5141, 5141, 5141, 5141, 5141, 5141, 5141, 5141, 5141, 5141, 5141, 5141, 5141, 5141, 5141, 29,
+            10596, 10596, 10596, 10596, 10596, 10596, 10596, 10596, 10595, 10595, 10595, 10595, 10595, 10595, 2417, 2417,
+            13156, 13156, 13156, 13156, 13156, 13156, 13156, 13156, 13156, 13156, 13156, 13156, 13155, 4977, 4977, 4977,
+            4968, 4968, 4968, 4968, 4968, 4968, 4968, 4968, 4968, 4968, 13156, 13156, 29, 29, 29, 29,
+            9184, 9185, 9184, 9185, 9184, 9185, 9188, 997, 999, 999, 999, 1009, 9189, 9189, 9189, 9189,
+            9189, 9189, 9189, 9189, 997, 997, 1009, 9187, 9184, 9185, 9184, 9185, 9187, 9187, 9189, 9189,
+            8516, 8516, 8516, 8516, 8516, 8516, 8516, 8516, 8516, 8516, 8516, 8516, 8516, 8516, 8521, 8521,
+            8521, 8521, 8521, 8521, 8521, 8521, 8521, 8521, 325, 325, 337, 337, 337, 337, 337, 337,
+            52, 52, 52, 52, 52, 52, 52, 8227, 52, 52, 10432, 10433, 10432, 10433, 10432, 10433,
+            10435, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 10432, 10433, 10432, 10433, 10432, 10432, 10433,
+            8227, 52, 52, 10432, 10433, 10432, 10433, 10436, 10432, 10433, 10432, 10433, 10433, 10433, 10432, 10433,
+            10432, 10433, 10432, 10432, 10432, 10432, 10432, 10433, 10432, 10432, 10432, 10432, 10432, 10433, 10432, 10433,
+            10432, 10433, 10432, 10433, 10432, 10432, 10432, 10432, 10433, 10432, 10433, 29, 29, 29, 29, 29,
+            10432, 10433, 29, 10433, 29, 10433, 10432, 10433, 10432, 10433, 29, 29, 29, 29, 29, 29,
+            29, 29, 10435, 10435, 10435, 10432, 10433, 10436, 10435, 10435, 10433, 10436, 10436, 10436, 10436, 10436,
+            12548, 12548, 12549, 12548, 12548, 12548, 4357, 12548, 12548, 12548, 12548, 12549, 12548, 12548, 12548, 12548,
+            12548, 12548, 12548, 12548, 12548, 12548, 12548, 12548, 12548, 12548, 12548, 12550, 12550, 12549, 12549, 12550,
+            4373, 4373, 4373, 4373, 4357, 29, 29, 29, 42, 42, 42, 42, 42, 42, 53, 53,
+            51, 53, 29, 29, 29, 29, 29, 29, 12036, 12036, 12036, 12036, 12036, 12036, 12036, 12036,
+            12036, 12036, 12036, 12036, 3857, 3857, 3857, 3857, 12230, 12230, 12228, 12228, 12228, 12228, 12228, 12228,
+            12228, 12228, 12228, 12228, 12228, 12228, 12228, 12228, 12228, 12228, 12228, 12228, 12230, 12230, 12230, 12230,
+            12230, 12230, 12230, 12230, 12230, 12230, 12230, 12230, 12230, 12230, 12230, 12230, 4037, 12229, 29, 29,
+            29, 29, 29, 29, 29, 29, 4049, 4049, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040,
+            4040, 4040, 29, 29, 29, 29, 29, 29, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061,
+            1061, 1061, 9252, 9252, 9252, 9252, 9252, 9252, 1073, 1073, 1073, 9252, 1073, 9252, 9252, 9253,
+            2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 10212, 10212, 10212, 10212, 10212, 10212,
+            10212, 10212, 10212, 10212, 10212, 10212, 10212, 10212, 10212, 10212, 10212, 10212, 10212, 10212, 10213, 10213,
+            10213, 10213, 10213, 2021, 2021, 2021, 49, 2033, 12132, 12132, 12132, 12132, 12132, 12132, 12132, 12132,
+            12132, 12132, 12132, 12132, 12132, 12132, 12132, 12133, 12133, 12133, 12133, 12133, 12133, 12133, 12133, 12133,
+            12133, 12133, 12134, 3942, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 3953,
+            9796, 9796, 9796, 9796, 9796, 29, 29, 29, 10085, 10085, 10085, 10086, 10084, 10084, 10084, 10084,
+            10084, 10084, 10084, 10084, 10084, 10084, 10084, 10084, 10084, 10084, 10084, 1893, 10086, 10086, 10085, 10085,
+            10085, 10085, 10086, 10086, 10085, 10085, 10086, 10086, 1894, 1905, 1905, 1905, 1905, 1905, 1905, 1905,
+            1905, 1905, 1905, 1905, 1905, 1905, 29, 8227, 1896, 1896, 1896, 1896, 1896, 1896, 1896, 1896,
+            1896, 1896, 29, 29, 29, 29, 1905, 1905, 11236, 11236, 11236, 11236, 11236, 11237, 11235, 11236,
+            3048, 3048, 11236, 11236, 11236, 11236, 11236, 29, 8964, 8964, 8964, 8964, 8964, 8964, 8964, 8964,
+            8964, 8965, 8965, 8965, 8965, 8965, 8965, 8966, 8966, 8965, 8965, 8966, 8966, 8965, 8965, 29,
+            8964, 8964, 8964, 8965, 8964, 8964, 8964, 8964, 8964, 8964, 8964, 8964, 8965, 8966, 29, 29,
+            776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 29, 29, 785, 785, 785, 785,
+            11235, 11236, 11236, 11236, 11236, 11236, 11236, 3061, 3061, 3061, 11236, 11238, 11237, 11238, 11236, 11236,
+            12740, 12740, 12740, 12740, 12740, 12740, 12740, 12740, 12741, 12740, 12741, 12741, 12741, 12740, 12740, 12741,
+            12741, 12740, 12740, 12740, 12740, 12740, 12741, 4549, 12740, 4549, 12740, 29, 29, 29, 29, 29,
+            29, 29, 29, 12740, 12740, 12739, 4561, 4561, 10948, 10948, 10948, 10948, 10948, 10948, 10948, 10948,
+            10948, 10948, 10948, 10950, 10949, 10949, 10950, 10950, 2769, 2769, 10948, 10947, 10947, 10950, 2757, 29,
+            29, 9476, 9476, 9476, 9476, 9476, 9476, 29, 10433, 10433, 10433, 52, 10435, 10435, 10435, 10435,
+            10433, 10433, 10433, 10433, 10433, 9633, 10433, 10433, 10433, 10435, 52, 52, 29, 29, 29, 29,
+            8993, 8993, 8993, 8993, 8993, 8993, 8993, 8993, 10948, 10948, 10948, 10950, 10950, 10949, 10950, 10950,
+            10949, 10950, 10950, 2769, 2758, 2757, 29, 29, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760,
+            2760, 2760, 29, 29, 29, 29, 29, 29, 9796, 9796, 9796, 9796, 29, 29, 29, 29,
+            29, 29, 29, 9796, 9796, 9796, 9796, 9796, 27, 27, 27, 27, 27, 27, 27, 27,
+            28, 28, 28, 28, 28, 28, 28, 28, 9764, 9764, 9764, 9764, 9764, 9764, 29, 29,
+            9764, 9764, 29, 29, 29, 29, 29, 29, 10433, 10433, 10433, 10433, 10433, 10433, 10433, 29,
+            29, 29, 29, 8417, 8417, 8417, 8417, 8417, 29, 29, 29, 29, 29, 9924, 9925, 9924,
+            9924, 1746, 9924, 9924, 9924, 9924, 9924, 9924, 9924, 9924, 9924, 9924, 9924, 9924, 9924, 29,
+            9924, 9924, 9924, 9924, 9924, 29, 9924, 29, 9924, 9924, 29, 9924, 9924, 29, 9924, 9924,
+            8388, 8388, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+            212, 212, 212, 29, 29, 29, 29, 29, 29, 29, 29, 8388, 8388, 8388, 8388, 8388,
+            8388, 8388, 8388, 8388, 8388, 8388, 46, 45, 213, 213, 213, 213, 213, 213, 213, 213,
+            29, 29, 8388, 8388, 8388, 8388, 8388, 8388, 29, 29, 29, 29, 29, 29, 29, 213,
+            8388, 8388, 8388, 8388, 211, 213, 213, 213, 49, 49, 49, 49, 49, 49, 49, 45,
+            46, 49, 29, 29, 29, 29, 29, 29, 69, 69, 69, 69, 69, 69, 997, 997,
+            49, 44, 44, 43, 43, 45, 46, 45, 46, 45, 46, 45, 46, 49, 49, 45,
+            46, 49, 49, 49, 49, 43, 43, 43, 49, 49, 49, 29, 49, 49, 49, 49,
+            44, 45, 46, 45, 46, 45, 46, 49, 49, 49, 50, 44, 50, 50, 50, 29,
+            49, 51, 49, 49, 29, 29, 29, 29, 8388, 8388, 8388, 8388, 8388, 29, 8388, 8388,
+            8388, 8388, 8388, 8388, 8388, 29, 29, 58, 29, 49, 49, 49, 51, 49, 49, 49,
+            10433, 10433, 10433, 45, 50, 46, 50, 45, 46, 49, 45, 46, 49, 49, 10180, 10180,
+            8227, 10180, 10180, 10180, 10180, 10180, 10180, 10180, 10180, 10180, 10180, 10180, 10180, 10180, 8227, 8227,
+            29, 29, 9796, 9796, 9796, 9796, 9796, 9796, 29, 29, 9796, 9796, 9796, 29, 29, 29,
+            51, 51, 50, 52, 53, 51, 51, 29, 53, 50, 50, 50, 50, 53, 53, 29,
+            29, 58, 58, 58, 53, 53, 29, 29, 10564, 10564, 10564, 10564, 10564, 10564, 10564, 10564,
+            10564, 10564, 10564, 10564, 29, 10564, 10564, 10564, 10564, 10564, 10564, 10564, 10564, 10564, 10564, 29,
+            10564, 10564, 10564, 29, 10564, 10564, 29, 10564, 10564, 10564, 10564, 10564, 10564, 10564, 29, 29,
+            10564, 10564, 10564, 29, 29, 29, 29, 29, 49, 49, 49, 29, 29, 29, 29, 42,
+            42, 42, 42, 42, 29, 29, 29, 53, 9641, 9641, 9641, 9641, 9641, 9641, 9641, 9641,
+            9641, 9641, 9641, 9641, 9641, 1450, 1450, 1450, 1450, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+            1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1450, 1450, 1461, 1461, 1461, 29,
+            53, 53, 53, 53, 53, 29, 29, 29, 1461, 29, 29, 29, 29, 29, 29, 29,
+            53, 53, 53, 53, 53, 69, 29, 29, 10628, 10628, 10628, 10628, 10628, 10628, 10628, 10628,
+            10628, 10628, 10628, 10628, 10628, 29, 29, 29, 8868, 8868, 8868, 8868, 8868, 8868, 8868, 8868,
+            8868, 29, 29, 29, 29, 29, 29, 29, 69, 42, 42, 42, 42, 42, 42, 42,
+            42, 42, 42, 42, 29, 29, 29, 29, 11588, 11588, 11588, 11588, 11588, 11588, 11588, 11588,
+            3402, 3402, 3402, 3402, 29, 29, 29, 29, 29, 29, 29, 29, 29, 11588, 11588, 11588,
+            9572, 9572, 9572, 9572, 9572, 9572, 9572, 9572, 9572, 9577, 9572, 9572, 9572, 9572, 9572, 9572,
+            9572, 9572, 9577, 29, 29, 29, 29, 29, 11652, 11652, 11652, 11652, 11652, 11652, 11652, 11652,
+            11652, 11652, 11652, 11652, 11652, 11652, 11653, 11653, 11653, 11653, 11653, 29, 29, 29, 29, 29,
+            13124, 13124, 13124, 13124, 13124, 13124, 13124, 13124, 13124, 13124, 13124, 13124, 13124, 13124, 29, 4945,
+            11684, 11684, 11684, 11684, 11684, 11684, 11684, 11684, 11684, 11684, 11684, 11684, 29, 29, 29, 29,
+            3505, 11689, 11689, 11689, 11689, 11689, 29, 29, 9216, 9216, 9216, 9216, 9216, 9216, 9216, 9216,
+            9217, 9217, 9217, 9217, 9217, 9217, 9217, 9217, 12292, 12292, 12292, 12292, 12292, 12292, 12292, 12292,
+            11908, 11908, 11908, 11908, 11908, 11908, 11908, 11908, 11908, 11908, 11908, 11908, 11908, 11908, 29, 29,
+            3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 29, 29, 29, 29, 29, 29,
+            11872, 11872, 11872, 11872, 11872, 11872, 11872, 11872, 11872, 11872, 11872, 11872, 29, 29, 29, 29,
+            11873, 11873, 11873, 11873, 11873, 11873, 11873, 11873, 11873, 11873, 11873, 11873, 29, 29, 29, 29,
+            9412, 9412, 9412, 9412, 9412, 9412, 9412, 9412, 8900, 8900, 8900, 8900, 8900, 8900, 8900, 8900,
+            8900, 8900, 8900, 8900, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 721,
+            13184, 13184, 13184, 13184, 13184, 13184, 13184, 13184, 13184, 13184, 13184, 29, 13184, 13184, 13184, 13184,
+            13184, 13184, 13184, 29, 13184, 13184, 29, 13185, 13185, 13185, 13185, 13185, 13185, 13185, 13185, 13185,
+            13185, 13185, 29, 13185, 13185, 13185, 13185, 13185, 13185, 13185, 29, 13185, 13185, 29, 29, 29,
+            10532, 10532, 10532, 10532, 10532, 10532, 10532, 10532, 10532, 10532, 10532, 10532, 10532, 10532, 10532, 29,
+            10532, 10532, 10532, 10532, 10532, 10532, 29, 29, 10435, 10435, 10435, 10435, 10435, 10435, 29, 10435,
+            10435, 29, 10435, 10435, 10435, 10435, 10435, 10435, 10435, 10435, 10435, 29, 29, 29, 29, 29,
+            9124, 9124, 9124, 9124, 9124, 9124, 29, 29, 9124, 29, 9124, 9124, 9124, 9124, 9124, 9124,
+            9124, 9124, 9124, 9124, 9124, 9124, 9124, 9124, 9124, 9124, 9124, 9124, 9124, 9124, 29, 9124,
+            9124, 29, 29, 29, 9124, 29, 29, 9124, 9988, 9988, 9988, 9988, 9988, 9988, 9988, 9988,
+            9988, 9988, 9988, 9988, 9988, 9988, 29, 1809, 1802, 1802, 1802, 1802, 1802, 1802, 1802, 1802,
+            11972, 11972, 11972, 11972, 11972, 11972, 11972, 11972, 11972, 11972, 11972, 11972, 11972, 11972, 11972, 3797,
+            3797, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 11268, 11268, 11268, 11268, 11268, 11268, 11268, 11268,
+            11268, 11268, 11268, 11268, 11268, 11268, 11268, 29, 29, 29, 29, 29, 29, 29, 29, 3082,
+            3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 9892, 9892, 9892, 9892, 9892, 9892, 9892, 9892,
+            9892, 9892, 9892, 29, 9892, 9892, 29, 29, 29, 29, 29, 1706, 1706, 1706, 1706, 1706,
+            12068, 12068, 12068, 12068, 12068, 12068, 12068, 12068, 12068, 12068, 12068, 12068, 12068, 12068, 3882, 3882,
+            3882, 3882, 3882, 3882, 29, 29, 29, 3889, 10660, 10660, 10660, 10660, 10660, 10660, 10660, 10660,
+            10660, 10660, 29, 29, 29, 29, 29, 2481, 11044, 11044, 11044, 11044, 11044, 11044, 11044, 11044,
+            11012, 11012, 11012, 11012, 11012, 11012, 11012, 11012, 29, 29, 29, 29, 2826, 2826, 11012, 11012,
+            2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 29, 29, 2826, 2826, 2826, 2826, 2826, 2826,
+            10244, 10245, 10245, 10245, 29, 10245, 10245, 29, 29, 29, 29, 29, 10245, 10245, 10245, 10245,
+            10244, 10244, 10244, 10244, 29, 10244, 10244, 10244, 29, 10244, 10244, 10244, 10244, 10244, 10244, 10244,
+            10244, 10244, 10244, 10244, 10244, 10244, 10244, 10244, 10244, 10244, 10244, 10244, 10244, 10244, 29, 29,
+            2053, 2053, 2053, 29, 29, 29, 29, 2053, 2058, 2058, 2058, 2058, 2058, 2058, 2058, 2058,
+            2058, 29, 29, 29, 29, 29, 29, 29, 2065, 2065, 2065, 2065, 2065, 2065, 2065, 2065,
+            2065, 29, 29, 29, 29, 29, 29, 29, 11748, 11748, 11748, 11748, 11748, 11748, 11748, 11748,
+            11748, 11748, 11748, 11748, 11748, 3562, 3562, 3569, 11620, 11620, 11620, 11620, 11620, 11620, 11620, 11620,
+            11620, 11620, 11620, 11620, 11620, 3434, 3434, 3434, 10820, 10820, 10820, 10820, 10820, 10820, 10820, 10820,
+            2645, 10820, 10820, 10820, 10820, 10820, 10820, 10820, 10820, 10820, 10820, 10820, 10820, 2629, 2629, 29,
+            29, 29, 29, 2634, 2634, 2634, 2634, 2634, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 29,
+            8452, 8452, 8452, 8452, 8452, 8452, 8452, 8452, 8452, 8452, 8452, 8452, 8452, 8452, 29, 29,
+            29, 273, 273, 273, 273, 273, 273, 273, 10052, 10052, 10052, 10052, 10052, 10052, 10052, 10052,
+            10052, 10052, 10052, 10052, 10052, 10052, 29, 29, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866,
+            10020, 10020, 10020, 10020, 10020, 10020, 10020, 10020, 10020, 10020, 10020, 29, 29, 29, 29, 29,
+            1834, 1834, 1834, 1834, 1834, 1834, 1834, 1834, 12100, 12100, 12100, 12100, 12100, 12100, 12100, 12100,
+            12100, 12100, 29, 29, 29, 29, 29, 29, 29, 3921, 3921, 3921, 3921, 29, 29, 29,
+            29, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 11780, 11780, 11780, 11780, 11780, 11780, 11780, 11780,
+            11780, 29, 29, 29, 29, 29, 29, 29, 11552, 11552, 11552, 11552, 11552, 11552, 11552, 11552,
+            11552, 11552, 11552, 29, 29, 29, 29, 29, 11553, 11553, 11553, 11553, 11553, 11553, 11553, 11553,
+            11553, 11553, 11553, 29, 29, 29, 29, 29, 29, 29, 3370, 3370, 3370, 3370, 3370, 3370,
+            9828, 9828, 9828, 9828, 9828, 9828, 9828, 9828, 9828, 9828, 9828, 9828, 9829, 9829, 9829, 9829,
+            1640, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 29, 29, 29, 29, 29, 29,
+            202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 29,
+            13284, 13284, 13284, 13284, 13284, 13284, 13284, 13284, 13284, 13284, 29, 13285, 13285, 5100, 29, 29,
+            13284, 13284, 29, 29, 29, 29, 29, 29, 11716, 11716, 11716, 11716, 11716, 11716, 11716, 11716,
+            11716, 11716, 11716, 11716, 11716, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 11716,
+            12420, 12420, 12420, 12420, 12420, 12420, 12420, 12420, 12420, 12420, 12420, 12420, 12420, 12420, 4229, 4229,
+            4229, 4229, 4229, 4229, 4229, 4229, 4229, 4229, 4229, 4234, 4234, 4234, 4234, 4241, 4241, 4241,
+            4241, 4241, 29, 29, 29, 29, 29, 29, 11812, 11812, 11812, 11812, 11812, 11812, 11812, 11812,
+            11812, 11812, 3621, 3621, 3621, 3621, 3633, 3633, 3633, 3633, 29, 29, 29, 29, 29, 29,
+            9028, 9028, 9028, 9028, 9028, 9028, 9028, 9028, 9028, 9028, 9028, 9028, 9028, 842, 842, 842,
+            842, 842, 842, 842, 29, 29, 29, 29, 9444, 9444, 9444, 9444, 9444, 9444, 9444, 9444,
+            9444, 9444, 9444, 9444, 9444, 9444, 9444, 29, 8710, 8709, 8710, 8708, 8708, 8708, 8708, 8708,
+            8708, 8708, 8708, 8708, 8708, 8708, 8708, 8708, 8709, 8709, 8709, 8709, 8709, 8709, 8709, 8709,
+            8709, 8709, 8709, 8709, 8709, 8709, 517, 529, 529, 529, 529, 529, 529, 529, 29, 29,
+            29, 29, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522,
+            522, 522, 522, 522, 522, 522, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520,
+            517, 8708, 8708, 8709, 8709, 8708, 29, 29, 29, 29, 29, 29, 29, 29, 29, 517,
+            1925, 1925, 10118, 10116, 10116, 10116, 10116, 10116, 10116, 10116, 10116, 10116, 10116, 10116, 10116, 10116,
+            10118, 10118, 10118, 10117, 10117, 10117, 10117, 10118, 10118, 1925, 1925, 1937, 1937, 1946, 1937, 1937,
+            1937, 1937, 10117, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 1946, 29, 29,
+            12452, 12452, 12452, 12452, 12452, 12452, 12452, 12452, 12452, 29, 29, 29, 29, 29, 29, 29,
+            4264, 4264, 4264, 4264, 4264, 4264, 4264, 4264, 4264, 4264, 29, 29, 29, 29, 29, 29,
+            8933, 8933, 8933, 8932, 8932, 8932, 8932, 8932, 8932, 8932, 8932, 8932, 8932, 8932, 8932, 8932,
+            8932, 8932, 8932, 8932, 8932, 8932, 8932, 8933, 8933, 8933, 8933, 8933, 8934, 8933, 8933, 8933,
+            8933, 8933, 8933, 741, 741, 29, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744,
+            753, 753, 753, 753, 8932, 8934, 8934, 8932, 10692, 10692, 10692, 10692, 10692, 10692, 10692, 10692,
+            10692, 10692, 10692, 2501, 2513, 2513, 10692, 29, 12261, 12261, 12262, 12260, 12260, 12260, 12260, 12260,
+            12260, 12260, 12260, 12260, 12260, 12260, 12260, 12260, 12260, 12260, 12260, 12262, 12262, 12262, 12261, 12261,
+            12261, 12261, 12261, 12261, 12261, 12261, 12261, 12262, 4070, 12260, 12260, 12260, 12260, 4081, 4081, 4081,
+            4081, 4069, 4069, 4069, 4069, 4081, 12262, 12261, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072,
+            4072, 4072, 12260, 4081, 12260, 4081, 4081, 4081, 29, 4202, 4202, 4202, 4202, 4202, 4202, 4202,
+            4202, 4202, 4202, 4202, 4202, 4202, 4202, 4202, 4202, 4202, 4202, 4202, 4202, 29, 29, 29,
+            10340, 10340, 10340, 10340, 10340, 10340, 10340, 10340, 10340, 10340, 29, 10340, 10340, 10340, 10340, 10340,
+            10340, 10340, 10340, 10340, 10342, 10342, 10342, 10341, 10341, 10341, 10342, 10342, 10341, 2150, 2149, 10341,
+            2161, 2161, 2161, 2161, 2161, 2161, 10341, 29, 11204, 11204, 11204, 11204, 11204, 11204, 11204, 29,
+            11204, 29, 11204, 11204, 11204, 11204, 29, 11204, 11204, 11204, 11204, 11204, 11204, 11204, 11204, 11204,
+            11204, 11204, 11204, 11204, 11204, 11204, 29, 11204, 11204, 3025, 29, 29, 29, 29, 29, 29,
+            10372, 10372, 10372, 10372, 10372, 10372, 10372, 10372, 10372, 10372, 10372, 10372, 10372, 10372, 10372, 10373,
+            10374, 10374, 10374, 10373, 10373, 10373, 10373, 10373, 10373, 2181, 2181, 29, 29, 29, 29, 29,
+            2184, 2184, 2184, 2184, 2184, 2184, 2184, 2184, 2184, 2184, 29, 29, 29, 29, 29, 29,
+            9605, 9605, 9606, 9606, 29, 9604, 9604, 9604, 9604, 9604, 9604, 9604, 9604, 29, 29, 9604,
+            9604, 29, 29, 9604, 9604, 9604, 9604, 9604, 9604, 9604, 9604, 9604, 9604, 9604, 9604, 9604,
+            9604, 29, 9604, 9604, 9604, 9604, 9604, 9604, 9604, 29, 9604, 9604, 29, 9604, 9604, 9604,
+            9604, 9604, 29, 69, 1413, 9604, 9606, 9606, 9605, 9606, 9606, 9606, 9606, 29, 29, 9606,
+            9606, 29, 29, 9606, 9606, 1414, 29, 29, 9604, 29, 29, 29, 29, 29, 29, 9606,
+            29, 29, 29, 29, 29, 9604, 9604, 9604, 9604, 9604, 9606, 9606, 29, 29, 1413, 1413,
+            1413, 1413, 1413, 1413, 1413, 29, 29, 29, 11364, 11364, 11364, 11364, 11364, 11364, 11364, 11364,
+            11364, 11364, 11364, 11364, 11364, 11366, 11366, 11366, 11365, 11365, 11365, 11365, 11365, 11365, 11365, 11365,
+            11366, 11366, 3173, 11365, 11365, 11366, 3173, 11364, 11364, 11364, 11364, 3185, 3185, 3185, 3185, 3185,
+            3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3185, 3185, 29, 3185, 3173, 11364,
+            11364, 11364, 29, 29, 29, 29, 29, 29, 13060, 13060, 13060, 13060, 13060, 13060, 13060, 13060,
+            13062, 13062, 13062, 13061, 13061, 13061, 13061, 13061, 13061, 13062, 13061, 13062, 13062, 13062, 13062, 13061,
+            13061, 13062, 4869, 4869, 13060, 13060, 4881, 13060, 4872, 4872, 4872, 4872, 4872, 4872, 4872, 4872,
+            4872, 4872, 29, 29, 29, 29, 29, 29, 12324, 12324, 12324, 12324, 12324, 12324, 12324, 12324,
+            12324, 12324, 12324, 12324, 12324, 12324, 12324, 12326, 12326, 12326, 12325, 12325, 12325, 12325, 29, 29,
+            12326, 12326, 12326, 12326, 12325, 12325, 12326, 4133, 4133, 4145, 4145, 4145, 4145, 4145, 4145, 4145,
+            4145, 4145, 4145, 4145, 4145, 4145, 4145, 4145, 12324, 12324, 12324, 12324, 12325, 12325, 29, 29,
+            11108, 11108, 11108, 11108, 11108, 11108, 11108, 11108, 11110, 11110, 11110, 11109, 11109, 11109, 11109, 11109,
+            11109, 11109, 11109, 11110, 11110, 11109, 11110, 2917, 11109, 2929, 2929, 2929, 11108, 29, 29, 29,
+            2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 29, 29, 29, 29, 29, 29,
+            2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 29, 29, 29,
+            12772, 12772, 12772, 12772, 12772, 12772, 12772, 12772, 12772, 12772, 12772, 12773, 12774, 12773, 12774, 12774,
+            12773, 12773, 12773, 12773, 12773, 12773, 4582, 4581, 12772, 4593, 29, 29, 29, 29, 29, 29,
+            4584, 4584, 4584, 4584, 4584, 4584, 4584, 4584, 4584, 4584, 29, 29, 29, 29, 29, 29,
+            8324, 8324, 8324, 8324, 8324, 8324, 8324, 8324, 8324, 8324, 8324, 29, 29, 8325, 8325, 8325,
+            8326, 8326, 8325, 8325, 8325, 8325, 8326, 8325, 8325, 8325, 8325, 133, 29, 29, 29, 29,
+            136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 138, 138, 145, 145, 145, 149,
+            8324, 8324, 8324, 8324, 8324, 8324, 8324, 29, 9316, 9316, 9316, 9316, 9316, 9316, 9316, 9316,
+            9316, 9316, 9316, 9316, 9318, 9318, 9318, 9317, 9317, 9317, 9317, 9317, 9317, 9317, 9317, 9317,
+            9318, 1125, 1125, 1137, 29, 29, 29, 29, 13248, 13248, 13248, 13248, 13248, 13248, 13248, 13248,
+            13249, 13249, 13249, 13249, 13249, 13249, 13249, 13249, 5064, 5064, 5064, 5064, 5064, 5064, 5064, 5064,
+            5064, 5064, 5066, 5066, 5066, 5066, 5066, 5066, 5066, 5066, 5066, 29, 29, 29, 29, 29,
+            29, 29, 29, 29, 29, 29, 29, 13252, 9284, 9284, 9284, 9284, 9284, 9284, 9284, 29,
+            29, 9284, 29, 29, 9284, 9284, 9284, 9284, 9284, 9284, 9284, 9284, 29, 9284, 9284, 29,
+            9284, 9284, 9284, 9284, 9284, 9284, 9284, 9284, 9286, 9286, 9286, 9286, 9286, 9286, 29, 9286,
+            9286, 29, 29, 9285, 9285, 1094, 1093, 9284, 9286, 9284, 9286, 1093, 1105, 1105, 1105, 29,
+            1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 29, 29, 29, 29, 29, 29,
+            11300, 11300, 11300, 11300, 11300, 11300, 11300, 11300, 29, 29, 11300, 11300, 11300, 11300, 11300, 11300,
+            11300, 11302, 11302, 11302, 11301, 11301, 11301, 11301, 29, 29, 11301, 11301, 11302, 11302, 11302, 11302,
+            3109, 11300, 3121, 11300, 11302, 29, 29, 29, 13348, 13349, 13349, 13349, 13349, 13349, 13349, 13349,
+            13349, 13349, 13349, 13348, 13348, 13348, 13348, 13348, 13348, 13348, 13348, 13348, 13348, 13348, 13348, 13348,
+            13348, 13348, 13348, 5157, 5157, 13349, 13349, 13349, 13349, 13350, 13348, 13349, 13349, 13349, 13349, 5169,
+            5169, 5169, 5169, 5169, 5169, 5169, 5169, 5157, 12484, 12485, 12485, 12485, 12485, 12485, 12485, 12486,
+            12486, 12485, 12485, 12485, 12484, 12484, 12484, 12484, 12484, 12484, 12484, 12484, 12484, 12484, 12484, 12484,
+            12484, 12484, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12486,
+            4293, 4293, 4305, 4305, 4305, 12484, 4305, 4305, 4305, 4305, 4305, 29, 29, 29, 29, 29,
+            12004, 12004, 12004, 12004, 12004, 12004, 12004, 12004, 12004, 29, 29, 29, 29, 29, 29, 29,
+            8644, 8644, 8644, 8644, 8644, 8644, 8644, 8644, 8644, 29, 8644, 8644, 8644, 8644, 8644, 8644,
+            8644, 8644, 8644, 8644, 8644, 8644, 8644, 8646, 8645, 8645, 8645, 8645, 8645, 8645, 8645, 29,
+            8645, 8645, 8645, 8645, 8645, 8645, 8646, 453, 8644, 465, 465, 465, 465, 465, 29, 29,
+            456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 458, 458, 458, 458, 458, 458,
+            458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 29, 29, 29,
+            2673, 2673, 10852, 10852, 10852, 10852, 10852, 10852, 10852, 10852, 10852, 10852, 10852, 10852, 10852, 10852,
+            29, 29, 10853, 10853, 10853, 10853, 10853, 10853, 10853, 10853, 10853, 10853, 10853, 10853, 10853, 10853,
+            29, 10854, 10853, 10853, 10853, 10853, 10853, 10853, 10853, 10854, 10853, 10853, 10854, 10853, 10853, 29,
+            10884, 10884, 10884, 10884, 10884, 10884, 10884, 29, 10884, 10884, 29, 10884, 10884, 10884, 10884, 10884,
+            10884, 10884, 10884, 10884, 10884, 10884, 10884, 10884, 10884, 10885, 10885, 10885, 10885, 10885, 10885, 29,
+            29, 29, 10885, 29, 10885, 10885, 29, 10885, 10885, 10885, 2693, 10885, 2693, 2693, 10884, 10885,
+            2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 29, 29, 29, 29, 29, 29,
+            9700, 9700, 9700, 9700, 9700, 9700, 29, 9700, 9700, 29, 9700, 9700, 9700, 9700, 9700, 9700,
+            9700, 9700, 9700, 9700, 9700, 9700, 9700, 9700, 9700, 9700, 9702, 9702, 9702, 9702, 9702, 29,
+            9701, 9701, 29, 9702, 9702, 9701, 9702, 1509, 9700, 29, 29, 29, 29, 29, 29, 29,
+            1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 29, 29, 29, 29, 29, 29,
+            10724, 10724, 10724, 10724, 10724, 10724, 10724, 10724, 10724, 10724, 10724, 10725, 10725, 10726, 10726, 2545,
+            2545, 29, 29, 29, 29, 29, 29, 29, 10596, 29, 29, 29, 29, 29, 29, 29,
+            4618, 4618, 4618, 4618, 4618, 4618, 4618, 4618, 4618, 4618, 4618, 4618, 4618, 4629, 4629, 4629,
+            4629, 4629, 4629, 4629, 4629, 4627, 4627, 4627, 4627, 4629, 4629, 4629, 4629, 4629, 4629, 4629,
+            4629, 4629, 4629, 4629, 4629, 4629, 4629, 4629, 4629, 4629, 29, 29, 29, 29, 29, 29,
+            29, 29, 29, 29, 29, 29, 29, 4625, 9092, 9092, 9092, 9092, 9092, 9092, 9092, 9092,
+            9092, 9092, 29, 29, 29, 29, 29, 29, 9097, 9097, 9097, 9097, 9097, 9097, 9097, 9097,
+            9097, 9097, 9097, 9097, 9097, 9097, 9097, 29, 913, 913, 913, 913, 913, 29, 29, 29,
+            9092, 9092, 9092, 9092, 29, 29, 29, 29, 9156, 9156, 9156, 9156, 9156, 9156, 9156, 9156,
+            9156, 977, 977, 29, 29, 29, 29, 29, 9380, 9380, 9380, 9380, 9380, 9380, 9380, 9380,
+            9380, 9380, 9380, 9380, 9380, 9380, 9380, 29, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210,
+            1210, 29, 29, 29, 29, 29, 29, 29, 8356, 8356, 8356, 8356, 8356, 8356, 8356, 8356,
+            8356, 8356, 8356, 8356, 8356, 8356, 8356, 29, 8516, 29, 29, 29, 29, 29, 29, 29,
+            11172, 11172, 11172, 11172, 11172, 11172, 11172, 11172, 11172, 11172, 11172, 11172, 11172, 11172, 11172, 29,
+            2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 29, 29, 29, 29, 2993, 2993,
+            12836, 12836, 12836, 12836, 12836, 12836, 12836, 12836, 12836, 12836, 12836, 12836, 12836, 12836, 12836, 29,
+            4648, 4648, 4648, 4648, 4648, 4648, 4648, 4648, 4648, 4648, 29, 29, 29, 29, 29, 29,
+            8548, 8548, 8548, 8548, 8548, 8548, 8548, 8548, 8548, 8548, 8548, 8548, 8548, 8548, 29, 29,
+            357, 357, 357, 357, 357, 369, 29, 29, 11940, 11940, 11940, 11940, 11940, 11940, 11940, 11940,
+            3749, 3749, 3749, 3749, 3749, 3749, 3749, 3761, 3761, 3761, 3761, 3761, 3765, 3765, 3765, 3765,
+            11939, 11939, 11939, 11939, 3761, 3765, 29, 29, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752,
+            3752, 3752, 29, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 29, 11940, 11940, 11940, 11940, 11940,
+            29, 29, 29, 29, 29, 11940, 11940, 11940, 10912, 10912, 10912, 10912, 10912, 10912, 10912, 10912,
+            10913, 10913, 10913, 10913, 10913, 10913, 10913, 10913, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730,
+            2730, 2730, 2730, 2730, 2730, 2730, 2730, 2737, 2737, 2737, 2737, 29, 29, 29, 29, 29,
+            11076, 11076, 11076, 11076, 11076, 11076, 11076, 11076, 11076, 11076, 11076, 29, 29, 29, 29, 11077,
+            11076, 11078, 11078, 11078, 11078, 11078, 11078, 11078, 11078, 11078, 11078, 11078, 11078, 11078, 11078, 11078,
+            29, 29, 29, 29, 29, 29, 29, 11077, 11077, 11077, 11077, 11075, 11075, 11075, 11075, 11075,
+            11075, 11075, 11075, 11075, 11075, 11075, 11075, 11075, 12867, 11427, 1585, 9763, 2085, 29, 29, 29,
+            9766, 9766, 29, 29, 29, 29, 29, 29, 12868, 12868, 12868, 12868, 12868, 12868, 12868, 12868,
+            10276, 10276, 10276, 10276, 10276, 10276, 10276, 10276, 10276, 10276, 10276, 10276, 10276, 10276, 29, 29,
+            12868, 29, 29, 29, 29, 29, 29, 29, 10179, 10179, 10179, 10179, 29, 10179, 10179, 10179,
+            10179, 10179, 10179, 10179, 29, 10179, 10179, 29, 10180, 9956, 9956, 9956, 9956, 9956, 9956, 9956,
+            10180, 10180, 10180, 29, 29, 29, 29, 29, 9956, 9956, 9956, 29, 29, 29, 29, 29,
+            29, 29, 29, 29, 10180, 10180, 10180, 10180, 11428, 11428, 11428, 11428, 11428, 11428, 11428, 11428,
+            11428, 11428, 11428, 11428, 29, 29, 29, 29, 9348, 9348, 9348, 9348, 9348, 9348, 9348, 9348,
+            9348, 9348, 9348, 29, 29, 29, 29, 29, 9348, 9348, 9348, 9348, 9348, 29, 29, 29,
+            9348, 29, 29, 29, 29, 29, 29, 29, 9348, 9348, 29, 29, 1173, 1157, 9349, 1169,
+            58, 58, 58, 58, 29, 29, 29, 29, 69, 69, 69, 69, 69, 69, 29, 29,
+            69, 69, 69, 69, 69, 69, 69, 29, 53, 53, 53, 53, 53, 53, 29, 29,
+            29, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 38, 38, 69,
+            69, 69, 53, 53, 53, 38, 38, 38, 38, 38, 38, 58, 58, 58, 58, 58,
+            58, 58, 58, 69, 69, 69, 69, 69, 69, 69, 69, 53, 53, 69, 69, 69,
+            69, 69, 69, 69, 53, 53, 53, 53, 53, 53, 69, 69, 69, 69, 53, 53,
+            1461, 1461, 1445, 1445, 1445, 1461, 29, 29, 42, 29, 29, 29, 29, 29, 29, 29,
+            8224, 8224, 8224, 8224, 8224, 8224, 8224, 8224, 8224, 8224, 8225, 8225, 8225, 8225, 8225, 8225,
+            8225, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8224, 8224, 8224, 8224,
+            8224, 8224, 8224, 8224, 8224, 8224, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 29, 8225, 8225,
+            8225, 8225, 8225, 8225, 8224, 29, 8224, 8224, 29, 29, 8224, 29, 29, 8224, 8224, 29,
+            29, 8224, 8224, 8224, 8224, 29, 8224, 8224, 8225, 8225, 29, 8225, 29, 8225, 8225, 8225,
+            8225, 8225, 8225, 8225, 29, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8224, 8224, 29, 8224,
+            8224, 8224, 8224, 29, 29, 8224, 8224, 8224, 8224, 8224, 8224, 8224, 8224, 29, 8224, 8224,
+            8224, 8224, 8224, 8224, 8224, 29, 8225, 8225, 8224, 8224, 29, 8224, 8224, 8224, 8224, 29,
+            8224, 8224, 8224, 8224, 8224, 29, 8224, 29, 29, 29, 8224, 8224, 8224, 8224, 8224, 8224,
+            8224, 29, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 29, 29,
+            8224, 50, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 8225, 50, 8225, 8225, 8225, 8225,
+            8225, 8225, 8224, 8224, 8224, 8224, 8224, 8224, 8224, 8224, 8224, 50, 8225, 8225, 8225, 8225,
+            8225, 8225, 8225, 8225, 8225, 50, 8225, 8225, 8224, 8224, 8224, 8224, 8224, 50, 8225, 8225,
+            8225, 8225, 8225, 8225, 8225, 8225, 8225, 50, 8225, 8225, 8225, 8225, 8225, 8225, 8224, 8224,
+            8224, 8224, 8224, 8224, 8224, 8224, 8224, 50, 8225, 50, 8225, 8225, 8225, 8225, 8225, 8225,
+            8225, 8225, 8224, 8225, 29, 29, 40, 40, 4181, 4181, 4181, 4181, 4181, 4181, 4181, 4181,
+            4165, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 4181,
+            4181, 4181, 4181, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 4181, 4181, 4181,
+            4181, 4181, 4181, 4181, 4181, 4165, 4181, 4181, 4181, 4181, 4181, 4181, 4165, 4181, 4181, 4177,
+            4177, 4177, 4177, 4177, 29, 29, 29, 29, 29, 29, 29, 4165, 4165, 4165, 4165, 4165,
+            29, 4165, 4165, 4165, 4165, 4165, 4165, 4165, 10433, 10433, 10436, 10433, 10433, 10433, 10433, 10433,
+            9541, 9541, 9541, 9541, 9541, 9541, 9541, 29, 9541, 9541, 9541, 9541, 9541, 9541, 9541, 9541,
+            9541, 29, 29, 9541, 9541, 9541, 9541, 9541, 9541, 9541, 29, 9541, 9541, 29, 9541, 9541,
+            9541, 9541, 9541, 29, 29, 29, 29, 29, 11460, 11460, 11460, 11460, 11460, 11460, 11460, 11460,
+            11460, 11460, 11460, 11460, 11460, 29, 29, 29, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 11459,
+            11459, 11459, 11459, 11459, 11459, 11459, 29, 29, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272,
+            3272, 3272, 29, 29, 29, 29, 11460, 3285, 13092, 13092, 13092, 13092, 13092, 13092, 13092, 13092,
+            13092, 13092, 13092, 13092, 13092, 13092, 4901, 29, 13220, 13220, 13220, 13220, 13220, 13220, 13220, 13220,
+            13220, 13220, 13220, 13220, 5029, 5029, 5029, 5029, 5032, 5032, 5032, 5032, 5032, 5032, 5032, 5032,
+            5032, 5032, 29, 29, 29, 29, 29, 5043, 9476, 9476, 9476, 9476, 29, 9476, 9476, 29,
+            10980, 10980, 10980, 10980, 10980, 10980, 10980, 10980, 10980, 10980, 10980, 10980, 10980, 29, 29, 2794,
+            2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2789, 2789, 2789, 2789, 2789, 2789, 2789, 29,
+            8288, 8288, 8288, 8288, 8288, 8288, 8288, 8288, 8288, 8288, 8289, 8289, 8289, 8289, 8289, 8289,
+            8289, 8289, 8289, 8289, 8289, 8289, 8289, 8289, 8289, 8289, 8289, 8289, 101, 101, 101, 8293,
+            101, 101, 101, 8291, 29, 29, 29, 29, 104, 104, 104, 104, 104, 104, 104, 104,
+            104, 104, 29, 29, 29, 29, 113, 113, 29, 42, 42, 42, 42, 42, 42, 42,
+            42, 42, 42, 42, 53, 42, 42, 42, 51, 42, 42, 42, 42, 29, 29, 29,
+            42, 42, 42, 42, 42, 42, 53, 42, 42, 42, 42, 42, 42, 42, 29, 29,
+            8388, 8388, 8388, 8388, 29, 8388, 8388, 8388, 29, 8388, 8388, 29, 8388, 29, 29, 8388,
+            29, 8388, 8388, 8388, 8388, 8388, 8388, 8388, 8388, 8388, 8388, 29, 8388, 8388, 8388, 8388,
+            29, 8388, 29, 8388, 29, 29, 29, 29, 29, 29, 8388, 29, 29, 29, 29, 8388,
+            29, 8388, 29, 8388, 29, 8388, 8388, 8388, 29, 8388, 29, 8388, 29, 8388, 29, 8388,
+            29, 8388, 8388, 8388, 8388, 29, 8388, 29, 8388, 8388, 29, 8388, 8388, 8388, 8388, 8388,
+            8388, 8388, 8388, 8388, 29, 29, 29, 29, 29, 8388, 8388, 8388, 29, 8388, 8388, 8388,
+            210, 210, 29, 29, 29, 29, 29, 29, 42, 42, 42, 42, 42, 53, 53, 53,
+            8245, 8245, 53, 53, 53, 53, 53, 53, 29, 29, 29, 29, 29, 29, 53, 53,
+            1781, 53, 53, 29, 29, 29, 29, 29, 53, 29, 29, 29, 29, 29, 29, 29,
+            53, 53, 29, 29, 29, 29, 29, 29, 53, 53, 53, 52, 52, 52, 52, 52,
+            29, 29, 29, 29, 29, 53, 53, 53, 53, 53, 53, 29, 53, 53, 53, 53,
+            40, 40, 29, 29, 29, 29, 29, 29, 9764, 29, 29, 29, 29, 29, 29, 29,
+            9764, 9764, 9764, 29, 29, 29, 29, 29, 29, 58, 29, 29, 29, 29, 29, 29,
+            28, 28, 28, 28, 28, 28, 29, 29,
+        };
+
+        inline constexpr const char* script_names[162] = {
+            "Unknown", "Common", "Inherited", "Adlam", "Ahom", "Anatolian_Hieroglyphs",
+            "Arabic", "Armenian", "Avestan", "Balinese", "Bamum", "Bassa_Vah",
+            "Batak", "Bengali", "Bhaiksuki", "Bopomofo", "Brahmi", "Braille",
+            "Buginese", "Buhid", "Canadian_Aboriginal", "Carian", "Caucasian_Albanian", "Chakma",
+            "Cham", "Cherokee", "Chorasmian", "Coptic", "Cuneiform", "Cypriot",
+            "Cypro_Minoan", "Cyrillic", "Deseret", "Devanagari", "Dives_Akuru", "Dogra",
+            "Duployan", "Egyptian_Hieroglyphs", "Elbasan", "Elymaic", "Ethiopic", "Georgian",
+            "Glagolitic", "Gothic", "Grantha", "Greek", "Gujarati", "Gunjala_Gondi",
+            "Gurmukhi", "Han", "Hangul", "Hanifi_Rohingya", "Hanunoo", "Hatran",
+            "Hebrew", "Hiragana", "Imperial_Aramaic", "Inscriptional_Pahlavi", "Inscriptional_Parthian", "Javanese",
+            "Kaithi", "Kannada", "Katakana", "Kayah_Li", "Kharoshthi", "Khitan_Small_Script",
+            "Khmer", "Khojki", "Khudawadi", "Lao", "Latin", "Lepcha",
+            "Limbu", "Linear_A", "Linear_B", "Lisu", "Lycian", "Lydian",
+            "Mahajani", "Makasar", "Malayalam", "Mandaic", "Manichaean", "Marchen",
+            "Masaram_Gondi", "Medefaidrin", "Meetei_Mayek", "Mende_Kikakui", "Meroitic_Cursive", "Meroitic_Hieroglyphs",
+            "Miao", "Modi", "Mongolian", "Mro", "Multani", "Myanmar",
+            "Nabataean", "Nandinagari", "New_Tai_Lue", "Newa", "Nko", "Nushu",
+            "Nyiakeng_Puachue_Hmong", "Ogham", "Ol_Chiki", "Old_Hungarian", "Old_Italic", "Old_North_Arabian",
+            "Old_Permic", "Old_Persian", "Old_Sogdian", "Old_South_Arabian", "Old_Turkic", "Old_Uyghur",
+            "Oriya", "Osage", "Osmanya", "Pahawh_Hmong", "Palmyrene", "Pau_Cin_Hau",
+            "Phags_Pa", "Phoenician", "Psalter_Pahlavi", "Rejang", "Runic", "Samaritan",
+            "Saurashtra", "Sharada", "Shavian", "Siddham", "SignWriting", "Sinhala",
+            "Sogdian", "Sora_Sompeng", "Soyombo", "Sundanese", "Syloti_Nagri", "Syriac",
+            "Tagalog", "Tagbanwa", "Tai_Le", "Tai_Tham", "Tai_Viet", "Takri",
+            "Tamil", "Tangsa", "Tangut", "Telugu", "Thaana", "Thai",
+            "Tibetan", "Tifinagh", "Tirhuta", "Toto", "Ugaritic", "Vai",
+            "Vithkuqi", "Wancho", "Warang_Citi", "Yezidi", "Yi", "Zanabazar_Square",
+        };
+
+    } // detail
+} // dbj::utf
+
+#endif // !DBJ_UTF_PROPERTY_TABLES_INC
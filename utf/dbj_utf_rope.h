@@ -0,0 +1,650 @@
+#pragma once
+#ifndef DBJ_UTF_ROPE_INC
+#define DBJ_UTF_ROPE_INC
+
+#include <stdint.h>
+#include <new>
+#include "dbj_utf_utils.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Rope over utf8 chunks, for large documents being edited.
+
+    dbj::utf::utf8_rope doc(file_data, file_size);
+
+    doc.insert(doc.line_start(42), "new line\n");
+    doc.erase(100, 5);                 // 5 code points at 100
+
+    size_t units{};
+    doc.export_range(0, doc.length(), buffer, buffer_units, encoding::utf16, units);
+
+Positions and counts are in code points, unless the name says otherwise.
+Lines are separated by '\n', line numbers and line_start() are 0 based.
+
+Tree is a treap (randomized balanced binary tree) of chunks up to 1KB.
+Every node caches bytes, code points and new lines of its subtree, thus
+insert, erase, split_off, append, at and the offset and line lookups are
+O(log n). Chunks never split a utf8 sequence, export transcodes them one
+by one with the dbj::utf converters.
+
+Each chunk is allocated to the size of its text. An edit, split_off or
+append of a rope makes new chunks only in place of the ones it touches,
+together with a neighbour less than half full; thus no two neighbours are
+both less than half full and memory stays close to the size of the text,
+however many edits there were.
+
+insert, erase, split_off and append allocate. New chunks are all made
+before the tree is changed, on bad_alloc the ropes are left as they were.
+
+Text is stored as given, it should be valid utf8 (see dbj_utf_validate.h
+and dbj_utf_metrics.h). Code points are counted as utf8 lead bytes.
+*/
+
+namespace dbj::utf {
+
+    class utf8_rope final {
+        utf8_rope(const utf8_rope&) = delete;
+        utf8_rope& operator=(const utf8_rope&) = delete;
+
+    public:
+        enum : size_t { chunk_capacity = 1024 };
+
+        utf8_rope() noexcept = default;
+
+        utf8_rope(const char* src, size_t bytes) { insert(0, src, bytes); }
+
+        explicit utf8_rope(const char* src) : utf8_rope(src, strlen(src)) {}
+
+        utf8_rope(utf8_rope&& that) noexcept : root_(that.root_), seed_(that.seed_) { that.root_ = nullptr; }
+
+        utf8_rope& operator=(utf8_rope&& that) noexcept {
+            if (this != &that) {
+                destroy(root_);
+                root_ = that.root_;
+                seed_ = that.seed_;
+                that.root_ = nullptr;
+            }
+            return *this;
+        }
+
+        ~utf8_rope() { destroy(root_); }
+
+        // totals, O(1)
+        size_t bytes() const noexcept { return root_ ? root_->total_bytes : 0; }
+        size_t length() const noexcept { return root_ ? root_->total_points : 0; }
+        size_t line_count() const noexcept { return (root_ ? root_->total_lines : 0) + 1; }
+
+        /*
+        insert the utf8 text before the code point at pos
+        pos past the end appends
+        */
+        void insert(size_t pos, const char* src, size_t src_bytes)
+        {
+            if (src_bytes)
+                replace(pos, 0, src, src_bytes);
+        }
+
+        void insert(size_t pos, const char* src) { insert(pos, src, strlen(src)); }
+
+        void append(const char* src, size_t src_bytes) { insert(length(), src, src_bytes); }
+
+        // count code points starting at pos
+        void erase(size_t pos, size_t count)
+        {
+            if (count)
+                replace(pos, count, nullptr, 0);
+        }
+
+        /*
+        everything from pos on is moved to the rope returned
+        */
+        utf8_rope split_off(size_t pos)
+        {
+            utf8_rope tail;
+            size_t first = 0;
+            const node* cut = chunk_at(pos, first);
+            if (!cut)
+                return tail;
+
+            node *left = nullptr, *right = nullptr;
+            if (pos == first) {
+                split(root_, pos, left, right);
+                root_ = left;
+                tail.root_ = right;
+                return tail;
+            }
+
+            // the chunk at pos is made again as two, with the small neighbours
+            size_t from = first, to = first + cut->points;
+            widen(from, to);
+            chunk_builder head(*this, byte_offset(pos) - byte_offset(from));
+            chunk_builder rest(*this, byte_offset(to) - byte_offset(pos));
+            visit(from, pos - from, head);
+            visit(pos, to - pos, rest);
+
+            node* old = nullptr;
+            split(root_, from, left, right);
+            split(right, to - from, old, right);
+            destroy(old);
+            root_ = merge(left, head.finish());
+            tail.root_ = merge(rest.finish(), right);
+            return tail;
+        }
+
+        /*
+        other is moved to the end of this one, and left empty
+        if the chunks at the seam are both less than half full they are made one
+        */
+        void append(utf8_rope&& other)
+        {
+            if (this == &other || !other.root_)
+                return;
+
+            size_t first = 0, other_first = 0;
+            const node* last = root_ ? chunk_at(length() - 1, first) : nullptr;
+            const node* next = other.chunk_at(0, other_first);
+
+            if (!last || last->size >= chunk_capacity / 2 || next->size >= chunk_capacity / 2) {
+                root_ = merge(root_, other.root_);
+                other.root_ = nullptr;
+                return;
+            }
+
+            chunk_builder seam(*this, size_t(last->size) + next->size);
+            seam(last->text(), last->size);
+            seam(next->text(), next->size);
+
+            node *left = nullptr, *old = nullptr, *right = nullptr;
+            split(root_, first, left, old);
+            destroy(old);
+            split(other.root_, next->points, old, right);
+            destroy(old);
+            other.root_ = nullptr;
+            root_ = merge(merge(left, seam.finish()), right);
+        }
+
+        // copy of the count code points starting at pos
+        utf8_rope copy(size_t pos, size_t count) const
+        {
+            utf8_rope result;
+            visit(pos, count, [&](const char* text, size_t size) { result.append(text, size); });
+            return result;
+        }
+
+        // code point at pos, 0 if out of range
+        char32_t at(size_t pos) const noexcept
+        {
+            const node* n = root_;
+            while (n) {
+                const size_t left = points(n->left);
+                if (pos < left) {
+                    n = n->left;
+                }
+                else if (pos < left + n->points) {
+                    const size_t offset = byte_of(n, pos - left);
+                    char32_t cp = 0;
+                    decode_utf8(n->text() + offset, n->text() + n->size, cp);
+                    return cp;
+                }
+                else {
+                    pos -= left + n->points;
+                    n = n->right;
+                }
+            }
+            return 0;
+        }
+
+        // byte offset of the code point at pos, bytes() if out of range
+        size_t byte_offset(size_t pos) const noexcept
+        {
+            size_t result = 0;
+            const node* n = root_;
+            while (n) {
+                const size_t left = points(n->left);
+                if (pos < left) {
+                    n = n->left;
+                }
+                else if (pos < left + n->points) {
+                    return result + bytes(n->left) + byte_of(n, pos - left);
+                }
+                else {
+                    pos -= left + n->points;
+                    result += bytes(n->left) + n->size;
+                    n = n->right;
+                }
+            }
+            return result;
+        }
+
+        // code point offset where the line starts, length() if there is no such line
+        size_t line_start(size_t line) const noexcept
+        {
+            if (line == 0)
+                return 0;
+
+            size_t result = 0;
+            const node* n = root_;
+            while (n) {
+                const size_t left = lines(n->left);
+                if (line <= left) {
+                    n = n->left;
+                }
+                else if (line <= left + n->lines) {
+                    // position right after the line-th new line
+                    size_t seen = left, pos = points(n->left);
+                    for (size_t j = 0; j < n->size; ++j) {
+                        pos += !is_continuation(n->text()[j]);
+                        if (n->text()[j] == '\n' && ++seen == line)
+                            return result + pos;
+                    }
+                    return result + pos;
+                }
+                else {
+                    line -= left + n->lines;
+                    result += points(n->left) + n->points;
+                    n = n->right;
+                }
+            }
+            return length();
+        }
+
+        // line the code point at pos is on
+        size_t line_of(size_t pos) const noexcept
+        {
+            size_t result = 0;
+            const node* n = root_;
+            while (n) {
+                const size_t left = points(n->left);
+                if (pos < left) {
+                    n = n->left;
+                }
+                else if (pos < left + n->points) {
+                    result += lines(n->left);
+                    const size_t end = byte_of(n, pos - left);
+                    for (size_t j = 0; j < end; ++j)
+                        result += n->text()[j] == '\n';
+                    return result;
+                }
+                else {
+                    pos -= left + n->points;
+                    result += lines(n->left) + n->lines;
+                    n = n->right;
+                }
+            }
+            return result;
+        }
+
+        /*
+        f(const char* utf8, size_t bytes) is called for every piece of the range, in order
+        pieces never split the utf8 sequence
+        */
+        template <typename F>
+        void visit(size_t pos, size_t count, F&& f) const
+        {
+            if (pos >= length() || count == 0)
+                return;
+            const size_t end = count > length() - pos ? length() : pos + count;
+            visit(root_, pos, end, 0, f);
+        }
+
+        // code units needed to export the range into the encoding, terminator not included
+        size_t export_length(size_t pos, size_t count, encoding to) const noexcept
+        {
+            size_t total = 0;
+            visit(pos, count, [&](const char* text, size_t size) {
+                total += transcoded_length(text, size, encoding::utf8, to);
+            });
+            return total;
+        }
+
+        /*
+        export the range into the encoding, with the dbj::utf converters
+        written is in code units of the target, dst is zero terminated if there is room left
+        */
+        conversion_result export_range(size_t pos, size_t count, void* dst, size_t dst_units,
+            encoding to, size_t& written) const noexcept
+        {
+            written = 0;
+            conversion_result result = conversionOK;
+            unsigned char* target = static_cast<unsigned char*>(dst);
+
+            visit(pos, count, [&](const char* text, size_t size) {
+                if (result != conversionOK)
+                    return;
+                size_t done = 0;
+                result = transcode(text, size, encoding::utf8,
+                    target + written * code_unit_size(to), dst_units - written, to, done);
+                written += done;
+            });
+
+            if (result == conversionOK && written < dst_units)
+                memset(target + written * code_unit_size(to), 0, code_unit_size(to));
+            return result;
+        }
+
+    private:
+        struct node final {
+            node* left;
+            node* right;
+            uint32_t priority;
+            uint32_t size;   // bytes in this chunk
+            uint32_t points; // code points in this chunk
+            uint32_t lines;  // new lines in this chunk
+            size_t total_bytes;
+            size_t total_points;
+            size_t total_lines;
+
+            // text of the chunk follows the node, in the same block
+            char* text() noexcept { return reinterpret_cast<char*>(this + 1); }
+            const char* text() const noexcept { return reinterpret_cast<const char*>(this + 1); }
+        };
+
+        static size_t bytes(const node* n) noexcept { return n ? n->total_bytes : 0; }
+        static size_t points(const node* n) noexcept { return n ? n->total_points : 0; }
+        static size_t lines(const node* n) noexcept { return n ? n->total_lines : 0; }
+
+        static bool is_continuation(char c) noexcept { return ((unsigned char)c & 0xC0) == 0x80; }
+
+        static void update(node* n) noexcept
+        {
+            n->total_bytes = bytes(n->left) + n->size + bytes(n->right);
+            n->total_points = points(n->left) + n->points + points(n->right);
+            n->total_lines = lines(n->left) + n->lines + lines(n->right);
+        }
+
+        static void count(node* n) noexcept
+        {
+            const char* text = n->text();
+            uint32_t p = 0, l = 0;
+            for (uint32_t j = 0; j < n->size; ++j) {
+                p += !is_continuation(text[j]);
+                l += text[j] == '\n';
+            }
+            n->points = p;
+            n->lines = l;
+        }
+
+        // byte offset of the k-th code point in the chunk
+        static size_t byte_of(const node* n, size_t k) noexcept
+        {
+            const char* text = n->text();
+            size_t j = 0;
+            for (size_t seen = 0; j < n->size; ++j) {
+                if (!is_continuation(text[j]) && seen++ == k)
+                    break;
+            }
+            return j;
+        }
+
+        // the chunk holding the code point at pos and its first code point, nullptr past the end
+        const node* chunk_at(size_t pos, size_t& first) const noexcept
+        {
+            first = 0;
+            const node* n = root_;
+            while (n) {
+                const size_t left = points(n->left);
+                if (pos < left) {
+                    n = n->left;
+                }
+                else if (pos < left + n->points) {
+                    first += left;
+                    return n;
+                }
+                else {
+                    pos -= left + n->points;
+                    first += left + n->points;
+                    n = n->right;
+                }
+            }
+            return nullptr;
+        }
+
+        // xorshift, priorities only need to be well spread
+        uint32_t next_priority() noexcept
+        {
+            seed_ ^= seed_ << 13;
+            seed_ ^= seed_ >> 17;
+            seed_ ^= seed_ << 5;
+            return seed_;
+        }
+
+        // room for capacity bytes of text, empty
+        node* make_node(size_t capacity)
+        {
+            node* n = new (::operator new(sizeof(node) + capacity)) node{};
+            n->priority = next_priority();
+            return n;
+        }
+
+        static void destroy(node* n) noexcept
+        {
+            if (!n)
+                return;
+            destroy(n->left);
+            destroy(n->right);
+            ::operator delete(n);
+        }
+
+        /*
+        the text given to it piece by piece, total bytes in all, is cut into
+        as few chunks as needed, of about the same size, each allocated to
+        its size; finish() returns them as a tree, until then they are
+        owned by the builder
+        */
+        class chunk_builder final {
+            chunk_builder(const chunk_builder&) = delete;
+            chunk_builder& operator=(const chunk_builder&) = delete;
+
+        public:
+            chunk_builder(utf8_rope& rope, size_t total) noexcept : rope_(rope), left_(total) {}
+
+            ~chunk_builder()
+            {
+                destroy(current_);
+                destroy(result_);
+            }
+
+            void operator()(const char* text, size_t size)
+            {
+                while (size) {
+                    if (!current_ || filled_ == capacity_)
+                        next_chunk(*text);
+                    const size_t room = capacity_ - filled_;
+                    const size_t taken = size < room ? size : room;
+                    memcpy(current_->text() + filled_, text, taken);
+                    filled_ += taken;
+                    text += taken;
+                    size -= taken;
+                }
+            }
+
+            node* finish() noexcept
+            {
+                if (current_)
+                    seal(filled_);
+                node* result = result_;
+                result_ = nullptr;
+                return result;
+            }
+
+        private:
+            static size_t chunk_size(size_t bytes) noexcept
+            {
+                const size_t chunks = (bytes + chunk_capacity - 1) / chunk_capacity;
+                return chunks ? (bytes + chunks - 1) / chunks : 1;
+            }
+
+            // current chunk is full and next is the byte after it
+            void next_chunk(char next)
+            {
+                if (!current_) {
+                    current_ = rope_.make_node(capacity_ = chunk_size(left_));
+                    return;
+                }
+
+                // the utf8 sequence is not split, up to 3 bytes go to the next chunk
+                const char* text = current_->text();
+                size_t cut = capacity_;
+                while (cut + 3 > capacity_ && cut > 1 && is_continuation(cut == capacity_ ? next : text[cut]))
+                    --cut;
+                const size_t carried = capacity_ - cut;
+
+                const size_t rest = left_ > cut ? left_ - cut : 0;
+                const size_t capacity = chunk_size(rest > carried ? rest : carried + 1);
+                node* fresh = rope_.make_node(capacity);
+
+                memcpy(fresh->text(), text + cut, carried);
+                seal(cut);
+                current_ = fresh;
+                capacity_ = capacity;
+                filled_ = carried;
+            }
+
+            void seal(size_t size) noexcept
+            {
+                current_->size = uint32_t(size);
+                count(current_);
+                update(current_);
+                result_ = merge(result_, current_);
+                current_ = nullptr;
+                left_ = left_ > size ? left_ - size : 0;
+            }
+
+            utf8_rope& rope_;
+            size_t left_;           // bytes not yet in a sealed chunk
+            node* current_{};       // being filled
+            size_t capacity_{};
+            size_t filled_{};
+            node* result_{};
+        };
+
+        // chunk range [from, to) is extended over the neighbours less than half full
+        void widen(size_t& from, size_t& to) const noexcept
+        {
+            size_t first = 0;
+            if (from > 0) {
+                const node* n = chunk_at(from - 1, first);
+                if (n->size < chunk_capacity / 2)
+                    from = first;
+            }
+            if (to < length()) {
+                const node* n = chunk_at(to, first);
+                if (n->size < chunk_capacity / 2)
+                    to = first + n->points;
+            }
+        }
+
+        /*
+        count code points at pos are replaced by src
+        the chunks at both ends of the range are made again, with the
+        neighbours less than half full, everything else is untouched
+        */
+        void replace(size_t pos, size_t count, const char* src, size_t src_bytes)
+        {
+            const size_t total = length();
+            if (pos > total)
+                pos = total;
+            if (count > total - pos)
+                count = total - pos;
+            if (!count && !src_bytes)
+                return;
+            const size_t end = pos + count;
+
+            size_t from = total, to = total, first = 0;
+            if (const node* n = chunk_at(pos, first)) {
+                from = first;
+                to = first + n->points;
+            }
+            if (count) {
+                const node* n = chunk_at(end - 1, first);
+                to = first + n->points;
+            }
+            widen(from, to);
+
+            const size_t kept = (byte_offset(pos) - byte_offset(from)) + (byte_offset(to) - byte_offset(end));
+            chunk_builder middle(*this, kept + src_bytes);
+            visit(from, pos - from, middle);
+            if (src_bytes)
+                middle(src, src_bytes);
+            visit(end, to - end, middle);
+
+            node *left = nullptr, *old = nullptr, *right = nullptr;
+            split(root_, from, left, right);
+            split(right, to - from, old, right);
+            destroy(old);
+            root_ = merge(merge(left, middle.finish()), right);
+        }
+
+        static node* merge(node* a, node* b) noexcept
+        {
+            if (!a)
+                return b;
+            if (!b)
+                return a;
+            if (a->priority >= b->priority) {
+                a->right = merge(a->right, b);
+                update(a);
+                return a;
+            }
+            b->left = merge(a, b->left);
+            update(b);
+            return b;
+        }
+
+        /*
+        first pos code points go to left, the rest to right
+        pos must be where the chunk starts, thus nothing is allocated
+        */
+        static void split(node* n, size_t pos, node*& left, node*& right) noexcept
+        {
+            if (!n) {
+                left = right = nullptr;
+                return;
+            }
+
+            const size_t before = points(n->left);
+
+            if (pos <= before) {
+                split(n->left, pos, left, n->left);
+                update(n);
+                right = n;
+            }
+            else {
+                assert(pos >= before + n->points);
+                split(n->right, pos - before - n->points, n->right, right);
+                update(n);
+                left = n;
+            }
+        }
+
+        // pieces of [pos, end) in the subtree starting at the code point base
+        template <typename F>
+        static void visit(const node* n, size_t pos, size_t end, size_t base, F& f)
+        {
+            if (!n)
+                return;
+
+            const size_t first = base + points(n->left);
+            const size_t last = first + n->points;
+
+            if (pos < first)
+                visit(n->left, pos, end, base, f);
+
+            if (pos < last && end > first) {
+                const size_t from = pos > first ? byte_of(n, pos - first) : 0;
+                const size_t to = end < last ? byte_of(n, end - first) : n->size;
+                if (to > from)
+                    f(n->text() + from, to - from);
+            }
+
+            if (end > last)
+                visit(n->right, pos, end, last, f);
+        }
+
+        node* root_{};
+        uint32_t seed_{ 0x9E3779B9u };
+    };
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_ROPE_INC
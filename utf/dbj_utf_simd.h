@@ -0,0 +1,503 @@
+#pragma once
+#ifndef DBJ_UTF_SIMD_INC
+#define DBJ_UTF_SIMD_INC
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Tiny set of vectorized kernels used by the dbj utf modules.
+
+SSE2 only, that is the baseline of every x64 CPU, thus no run time dispatch.
+Without SSE2 (ARM, x86 builds without /arch:SSE2) scalar loops are used,
+results are identical.
+
+Define DBJ_UTF_NO_SIMD to force the scalar versions.
+
+SSSE3 (pshufb) is used only where it is enabled at compile time, for MSVC
+that is /arch:AVX or above.
+*/
+
+#if !defined(DBJ_UTF_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define DBJ_UTF_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(DBJ_UTF_SSE2) && (defined(__SSSE3__) || defined(__AVX__))
+#define DBJ_UTF_SSSE3 1
+#include <tmmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/*
+kernels scanning for the terminator read whole aligned 16 byte blocks, that
+never crosses into the next page, but it does read past the terminator
+*/
+#if defined(__clang__) || defined(__GNUC__)
+#define DBJ_UTF_NO_ASAN __attribute__((no_sanitize_address))
+#elif defined(_MSC_VER)
+#define DBJ_UTF_NO_ASAN __declspec(no_sanitize_address)
+#else
+#define DBJ_UTF_NO_ASAN
+#endif
+
+namespace dbj::utf::simd {
+
+    // index of the lowest set bit, mask must not be 0
+    inline unsigned lowest_bit(uint32_t mask) noexcept
+    {
+#ifdef _MSC_VER
+        unsigned long index{};
+        _BitScanForward(&index, mask);
+        return (unsigned)index;
+#else
+        return (unsigned)__builtin_ctz(mask);
+#endif
+    }
+
+    // index of the highest set bit, mask must not be 0
+    inline unsigned highest_bit(uint32_t mask) noexcept
+    {
+#ifdef _MSC_VER
+        unsigned long index{};
+        _BitScanReverse(&index, mask);
+        return (unsigned)index;
+#else
+        return 31u - (unsigned)__builtin_clz(mask);
+#endif
+    }
+
+    inline unsigned popcount(uint32_t mask) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return (unsigned)__builtin_popcount(mask);
+#else
+        // no popcnt instruction assumed
+        mask = mask - ((mask >> 1) & 0x55555555u);
+        mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+        return (((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+#endif
+    }
+
+    /*
+    number of leading bytes < 0x80
+    */
+    inline size_t ascii_prefix(const char* src, size_t size) noexcept
+    {
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        for (; j + 16 <= size; j += 16) {
+            const __m128i chunk = _mm_loadu_si128((const __m128i*)(src + j));
+            const uint32_t high = (uint32_t)_mm_movemask_epi8(chunk);
+            if (high)
+                return j + lowest_bit(high);
+        }
+#endif
+        while (j < size && (unsigned char)src[j] < 0x80)
+            ++j;
+        return j;
+    }
+
+    /*
+    number of leading printable ASCII bytes, 0x20 .. 0x7E
+    */
+    inline size_t printable_ascii_prefix(const char* src, size_t size) noexcept
+    {
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        // signed compare, bytes >= 0x80 are negative and fail the first test
+        const __m128i below = _mm_set1_epi8(0x1F);
+        const __m128i above = _mm_set1_epi8(0x7F);
+        for (; j + 16 <= size; j += 16) {
+            const __m128i chunk = _mm_loadu_si128((const __m128i*)(src + j));
+            const __m128i ok = _mm_and_si128(_mm_cmpgt_epi8(chunk, below), _mm_cmplt_epi8(chunk, above));
+            const uint32_t bad = (uint32_t)_mm_movemask_epi8(ok) ^ 0xFFFFu;
+            if (bad)
+                return j + lowest_bit(bad);
+        }
+#endif
+        while (j < size && (unsigned char)src[j] >= 0x20 && (unsigned char)src[j] < 0x7F)
+            ++j;
+        return j;
+    }
+
+    /*
+    utf8 code points are counted as the bytes that are not 10xxxxxx
+    */
+#ifdef DBJ_UTF_SSE2
+    // one bit per byte that starts the code point
+    inline uint32_t lead_bytes(const char* src) noexcept
+    {
+        // signed compare, continuation bytes are -128 .. -65
+        return (uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)src), _mm_set1_epi8(-65)));
+    }
+#endif
+
+    inline size_t count_code_points(const char* src, size_t size) noexcept
+    {
+        size_t count = 0, j = 0;
+#ifdef DBJ_UTF_SSE2
+        for (; j + 16 <= size; j += 16)
+            count += popcount(lead_bytes(src + j));
+#endif
+        for (; j < size; ++j)
+            count += ((unsigned char)src[j] & 0xC0) != 0x80;
+        return count;
+    }
+
+    /*
+    byte offset of the code point n, or size if there are not that many
+    */
+    inline size_t skip_code_points(const char* src, size_t size, size_t n) noexcept
+    {
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        for (; j + 16 <= size; j += 16) {
+            const uint32_t leads = lead_bytes(src + j);
+            const unsigned count = popcount(leads);
+            if (count > n) {
+                uint32_t mask = leads;
+                while (n--)
+                    mask &= mask - 1;
+                return j + lowest_bit(mask);
+            }
+            n -= count;
+        }
+#endif
+        for (; j < size; ++j) {
+            if (((unsigned char)src[j] & 0xC0) != 0x80) {
+                if (n == 0)
+                    return j;
+                --n;
+            }
+        }
+        return size;
+    }
+
+    /*
+    utf32 kernels, in units; "not found" is the count given
+    */
+
+#ifdef DBJ_UTF_SSE2
+    // one bit per char32_t lane
+    inline uint32_t lanes_32(__m128i mask) noexcept { return (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(mask)); }
+
+    // 16 bytes from p would cross into the next page
+    inline bool crosses_page(const void* p) noexcept { return ((uintptr_t)p & 4095) > 4096 - 16; }
+#endif
+
+    /*
+    index of the first 0, not beyond max
+    */
+    DBJ_UTF_NO_ASAN inline size_t strnlen_32(const char32_t* src, size_t max) noexcept
+    {
+#ifdef DBJ_UTF_SSE2
+        const uintptr_t address = (uintptr_t)src;
+        const char32_t* block = (const char32_t*)(address & ~uintptr_t(15));
+        // lanes before src are ignored
+        uint32_t found = lanes_32(_mm_cmpeq_epi32(_mm_load_si128((const __m128i*)block), _mm_setzero_si128()))
+            & (0xFu << ((address & 15) >> 2));
+        for (;;) {
+            if (found) {
+                const size_t at = size_t(block + lowest_bit(found) - src);
+                return at < max ? at : max;
+            }
+            block += 4;
+            if (size_t(block - src) >= max)
+                return max;
+            found = lanes_32(_mm_cmpeq_epi32(_mm_load_si128((const __m128i*)block), _mm_setzero_si128()));
+        }
+#else
+        size_t j = 0;
+        while (j < max && src[j])
+            ++j;
+        return j;
+#endif
+    }
+
+    inline size_t strlen_32(const char32_t* src) noexcept { return strnlen_32(src, SIZE_MAX); }
+
+    inline size_t find_32(const char32_t* src, size_t count, char32_t cp) noexcept
+    {
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        const __m128i what = _mm_set1_epi32((int)cp);
+        for (; j + 4 <= count; j += 4) {
+            const uint32_t found = lanes_32(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(src + j)), what));
+            if (found)
+                return j + lowest_bit(found);
+        }
+#endif
+        for (; j < count; ++j)
+            if (src[j] == cp)
+                return j;
+        return count;
+    }
+
+    inline size_t rfind_32(const char32_t* src, size_t count, char32_t cp) noexcept
+    {
+        size_t j = count;
+#ifdef DBJ_UTF_SSE2
+        const __m128i what = _mm_set1_epi32((int)cp);
+        for (; j >= 4; j -= 4) {
+            const uint32_t found = lanes_32(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(src + j - 4)), what));
+            if (found)
+                return j - 4 + highest_bit(found);
+        }
+#endif
+        while (j-- > 0)
+            if (src[j] == cp)
+                return j;
+        return count;
+    }
+
+    /*
+    first index where the two differ, or count
+    */
+    inline size_t mismatch_32(const char32_t* left, const char32_t* right, size_t count) noexcept
+    {
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        for (; j + 4 <= count; j += 4) {
+            const __m128i same = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(left + j)),
+                _mm_loadu_si128((const __m128i*)(right + j)));
+            const uint32_t differ = lanes_32(same) ^ 0xFu;
+            if (differ)
+                return j + lowest_bit(differ);
+        }
+#endif
+        for (; j < count; ++j)
+            if (left[j] != right[j])
+                return j;
+        return count;
+    }
+
+    /*
+    substring search, candidates are the positions where both the first
+    and the last unit of the needle match, only they are compared in full
+    */
+    inline size_t find_32(const char32_t* src, size_t count, const char32_t* needle, size_t needle_count) noexcept
+    {
+        if (needle_count == 0)
+            return 0;
+        if (needle_count > count)
+            return count;
+        if (needle_count == 1)
+            return find_32(src, count, needle[0]);
+
+        const size_t last = count - needle_count; // last candidate
+        const size_t tail = needle_count - 1;
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        const __m128i first_unit = _mm_set1_epi32((int)needle[0]);
+        const __m128i last_unit = _mm_set1_epi32((int)needle[tail]);
+        for (; j + 3 <= last; j += 4) {
+            const __m128i head = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(src + j)), first_unit);
+            const __m128i end = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(src + j + tail)), last_unit);
+            for (uint32_t found = lanes_32(_mm_and_si128(head, end)); found; found &= found - 1) {
+                const size_t at = j + lowest_bit(found);
+                if (mismatch_32(src + at + 1, needle + 1, tail - 1) == tail - 1)
+                    return at;
+            }
+        }
+#endif
+        for (; j <= last; ++j)
+            if (src[j] == needle[0] && src[j + tail] == needle[tail]
+                && mismatch_32(src + j + 1, needle + 1, tail - 1) == tail - 1)
+                return j;
+        return count;
+    }
+
+    inline size_t rfind_32(const char32_t* src, size_t count, const char32_t* needle, size_t needle_count) noexcept
+    {
+        if (needle_count == 0)
+            return count;
+        if (needle_count > count)
+            return count;
+        if (needle_count == 1)
+            return rfind_32(src, count, needle[0]);
+
+        const size_t tail = needle_count - 1;
+        // candidates left to check are [0, j)
+        size_t j = count - needle_count + 1;
+#ifdef DBJ_UTF_SSE2
+        const __m128i first_unit = _mm_set1_epi32((int)needle[0]);
+        const __m128i last_unit = _mm_set1_epi32((int)needle[tail]);
+        for (; j >= 4; j -= 4) {
+            const __m128i head = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(src + j - 4)), first_unit);
+            const __m128i end = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(src + j - 4 + tail)), last_unit);
+            uint32_t found = lanes_32(_mm_and_si128(head, end));
+            while (found) {
+                const unsigned lane = highest_bit(found);
+                const size_t at = j - 4 + lane;
+                if (mismatch_32(src + at + 1, needle + 1, tail - 1) == tail - 1)
+                    return at;
+                found &= ~(1u << lane);
+            }
+        }
+#endif
+        while (j-- > 0)
+            if (src[j] == needle[0] && src[j + tail] == needle[tail]
+                && mismatch_32(src + j + 1, needle + 1, tail - 1) == tail - 1)
+                return j;
+        return count;
+    }
+
+    /*
+    strncmp semantics: first position where left is 0 or the two differ, not beyond count
+    blocks that would cross the page are done one by one
+    */
+    DBJ_UTF_NO_ASAN inline size_t stop_32(const char32_t* left, const char32_t* right, size_t count) noexcept
+    {
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        while (j + 4 <= count) {
+            if (crosses_page(left + j) || crosses_page(right + j)) {
+                for (const size_t end = j + 4; j < end; ++j)
+                    if (!left[j] || left[j] != right[j])
+                        return j;
+                continue;
+            }
+            const __m128i l = _mm_loadu_si128((const __m128i*)(left + j));
+            const __m128i r = _mm_loadu_si128((const __m128i*)(right + j));
+            const uint32_t stop = (lanes_32(_mm_cmpeq_epi32(l, r)) ^ 0xFu)
+                | lanes_32(_mm_cmpeq_epi32(l, _mm_setzero_si128()));
+            if (stop)
+                return j + lowest_bit(stop);
+            j += 4;
+        }
+#endif
+        for (; j < count; ++j)
+            if (!left[j] || left[j] != right[j])
+                return j;
+        return count;
+    }
+
+    /*
+    fixed width kernels, narrowing assumes the values fit
+    */
+    inline uint32_t or_32(const char32_t* src, size_t count) noexcept
+    {
+        uint32_t bits = 0;
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        __m128i acc = _mm_setzero_si128();
+        for (; j + 4 <= count; j += 4)
+            acc = _mm_or_si128(acc, _mm_loadu_si128((const __m128i*)(src + j)));
+        acc = _mm_or_si128(acc, _mm_srli_si128(acc, 8));
+        acc = _mm_or_si128(acc, _mm_srli_si128(acc, 4));
+        bits = (uint32_t)_mm_cvtsi128_si32(acc);
+#endif
+        for (; j < count; ++j)
+            bits |= src[j];
+        return bits;
+    }
+
+    inline uint32_t or_16(const char16_t* src, size_t count) noexcept
+    {
+        uint32_t bits = 0;
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        __m128i acc = _mm_setzero_si128();
+        for (; j + 8 <= count; j += 8)
+            acc = _mm_or_si128(acc, _mm_loadu_si128((const __m128i*)(src + j)));
+        acc = _mm_or_si128(acc, _mm_srli_si128(acc, 8));
+        acc = _mm_or_si128(acc, _mm_srli_si128(acc, 4));
+        acc = _mm_or_si128(acc, _mm_srli_si128(acc, 2));
+        bits = (uint32_t)_mm_cvtsi128_si32(acc) & 0xFFFFu;
+#endif
+        for (; j < count; ++j)
+            bits |= src[j];
+        return bits;
+    }
+
+    // values <= 0xFF
+    inline void narrow_32_to_8(uint8_t* dst, const char32_t* src, size_t count) noexcept
+    {
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        for (; j + 16 <= count; j += 16) {
+            const __m128i a = _mm_packs_epi32(_mm_loadu_si128((const __m128i*)(src + j)), _mm_loadu_si128((const __m128i*)(src + j + 4)));
+            const __m128i b = _mm_packs_epi32(_mm_loadu_si128((const __m128i*)(src + j + 8)), _mm_loadu_si128((const __m128i*)(src + j + 12)));
+            _mm_storeu_si128((__m128i*)(dst + j), _mm_packus_epi16(a, b));
+        }
+#endif
+        for (; j < count; ++j)
+            dst[j] = (uint8_t)src[j];
+    }
+
+    // values <= 0xFFFF
+    inline void narrow_32_to_16(uint16_t* dst, const char32_t* src, size_t count) noexcept
+    {
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        // no unsigned 32 -> 16 pack in SSE2, bias into the signed range and back
+        const __m128i bias32 = _mm_set1_epi32(0x8000);
+        const __m128i bias16 = _mm_set1_epi16((short)0x8000);
+        for (; j + 8 <= count; j += 8) {
+            const __m128i a = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(src + j)), bias32);
+            const __m128i b = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(src + j + 4)), bias32);
+            _mm_storeu_si128((__m128i*)(dst + j), _mm_add_epi16(_mm_packs_epi32(a, b), bias16));
+        }
+#endif
+        for (; j < count; ++j)
+            dst[j] = (uint16_t)src[j];
+    }
+
+    // values <= 0xFF
+    inline void narrow_16_to_8(uint8_t* dst, const char16_t* src, size_t count) noexcept
+    {
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        for (; j + 16 <= count; j += 16) {
+            const __m128i a = _mm_loadu_si128((const __m128i*)(src + j));
+            const __m128i b = _mm_loadu_si128((const __m128i*)(src + j + 8));
+            _mm_storeu_si128((__m128i*)(dst + j), _mm_packus_epi16(a, b));
+        }
+#endif
+        for (; j < count; ++j)
+            dst[j] = (uint8_t)src[j];
+    }
+
+    inline void widen_8_to_32(char32_t* dst, const uint8_t* src, size_t count) noexcept
+    {
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        for (; j + 16 <= count; j += 16) {
+            const __m128i bytes = _mm_loadu_si128((const __m128i*)(src + j));
+            const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+            const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+            _mm_storeu_si128((__m128i*)(dst + j), _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128((__m128i*)(dst + j + 4), _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128((__m128i*)(dst + j + 8), _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128((__m128i*)(dst + j + 12), _mm_unpackhi_epi16(high, zero));
+        }
+#endif
+        for (; j < count; ++j)
+            dst[j] = src[j];
+    }
+
+    inline void widen_16_to_32(char32_t* dst, const uint16_t* src, size_t count) noexcept
+    {
+        size_t j = 0;
+#ifdef DBJ_UTF_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        for (; j + 8 <= count; j += 8) {
+            const __m128i units = _mm_loadu_si128((const __m128i*)(src + j));
+            _mm_storeu_si128((__m128i*)(dst + j), _mm_unpacklo_epi16(units, zero));
+            _mm_storeu_si128((__m128i*)(dst + j + 4), _mm_unpackhi_epi16(units, zero));
+        }
+#endif
+        for (; j < count; ++j)
+            dst[j] = src[j];
+    }
+
+} // namespace dbj::utf::simd
+
+#endif // !DBJ_UTF_SIMD_INC
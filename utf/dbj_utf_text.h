@@ -0,0 +1,111 @@
+#pragma once
+#ifndef DBJ_UTF_TEXT_INC
+#define DBJ_UTF_TEXT_INC
+
+#include <mutex>
+#include "dbj_utf_cpp.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Text kept in the encoding it arrived in. Other encodings are made on the
+first request and kept for the lifetime of the text.
+
+    dbj::utf::utf_text name(json_value, json_value_size); // utf8 in
+    ::SetWindowTextW(hwnd, name.utf16().get());            // converted once
+    log(name.utf8().get());                                // no conversion
+
+Each form is made exactly once, even when requested from many threads at
+the same time (std::call_once). Forms are never changed after they are
+made, thus the references returned are safe to share between threads.
+
+utf_text is not copyable and not movable, share it by reference or pointer.
+*/
+
+namespace dbj::utf {
+
+    class utf_text final {
+        utf_text(const utf_text&) = delete;
+        utf_text& operator=(const utf_text&) = delete;
+
+    public:
+        // src_units are in the source encoding
+        utf_text(const char* src, size_t src_units) : original_(encoding::utf8) {
+            std::call_once(utf8_once_, [&] { utf8_ = new utf8_string(src, src_units); });
+        }
+
+        utf_text(const char16_t* src, size_t src_units) : original_(encoding::utf16) {
+            std::call_once(utf16_once_, [&] { utf16_ = new utf16_string(src, src_units); });
+        }
+
+        utf_text(const char32_t* src, size_t src_units) : original_(encoding::utf32) {
+            std::call_once(utf32_once_, [&] { utf32_ = new utf32_string(src, src_units); });
+        }
+
+        explicit utf_text(const char* src) : utf_text(src, strlen(src)) {}
+        explicit utf_text(const char16_t* src) : utf_text(src, strlen_16(src)) {}
+        explicit utf_text(const char32_t* src) : utf_text(src, strlen_32(src)) {}
+
+        ~utf_text() {
+            delete utf8_;
+            delete utf16_;
+            delete utf32_;
+        }
+
+        // the encoding text arrived in
+        encoding original() const noexcept { return original_; }
+
+        // code points
+        size_t length() const noexcept {
+            switch (original_) {
+            case encoding::utf8: return utf8_->length();
+            case encoding::utf16: return utf16_->length();
+            default: return utf32_->length();
+            }
+        }
+
+        const utf8_string& utf8() const {
+            std::call_once(utf8_once_, [this] {
+                if (original_ == encoding::utf16)
+                    utf8_ = new utf8_string(source16(), utf16_->units());
+                else
+                    utf8_ = new utf8_string(utf32_->get(), utf32_->length());
+            });
+            return *utf8_;
+        }
+
+        const utf16_string& utf16() const {
+            std::call_once(utf16_once_, [this] {
+                if (original_ == encoding::utf8)
+                    utf16_ = new utf16_string(utf8_->get(), utf8_->bytes());
+                else
+                    utf16_ = new utf16_string(utf32_->get(), utf32_->length());
+            });
+            return *utf16_;
+        }
+
+        const utf32_string& utf32() const {
+            std::call_once(utf32_once_, [this] {
+                if (original_ == encoding::utf8)
+                    utf32_ = new utf32_string(utf8_->get(), utf8_->bytes());
+                else
+                    utf32_ = new utf32_string(source16(), utf16_->units());
+            });
+            return *utf32_;
+        }
+
+    private:
+        // utf16_string::get() is wchar_t on WIN32
+        const char16_t* source16() const noexcept { return reinterpret_cast<const char16_t*>(utf16_->get()); }
+
+        const encoding original_;
+        mutable utf8_string* utf8_{};
+        mutable utf16_string* utf16_{};
+        mutable utf32_string* utf32_{};
+        mutable std::once_flag utf8_once_;
+        mutable std::once_flag utf16_once_;
+        mutable std::once_flag utf32_once_;
+    };
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_TEXT_INC
@@ -0,0 +1,284 @@
+#pragma once
+#ifndef DBJ_UTF_TOKENIZER_INC
+#define DBJ_UTF_TOKENIZER_INC
+
+#include "dbj_utf_utils.h"
+#include "dbj_utf_simd.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Zero copy splitting of the utf8 buffer on a set of delimiters.
+Delimiters are code points, ASCII or not.
+
+    dbj::utf::delimiter_set delims("&=;§");
+    dbj::utf::utf8_tokenizer tok(query, query_size, delims);
+    dbj::utf::token t;
+    while (tok.next(t)) {
+        // query + t.offset, t.length bytes
+    }
+
+Nothing is copied, nothing is allocated, tokens are (offset,length) views.
+Tokenizer keeps its own copy of the delimiter set, it is about 200 bytes,
+thus the set can be a temporary.
+
+How are the delimiters found:
+
+Every ASCII delimiter and the lead byte of every non ASCII delimiter is
+a "candidate" byte. In valid utf8 lead bytes never show up inside the
+multibyte sequence, thus only candidate positions need checking.
+
+16 bytes are classified at once:
+- SSSE3: two pshufb nibble lookups and one and, regardless of the set size
+- SSE2: one compare per distinct candidate byte, if there are no more than 16
+- scalar: 256 bit bitmap
+Candidate positions are then confirmed against the exact set.
+
+Like every split, two adjacent delimiters make one empty token between them,
+unless skip_empty is requested.
+
+There can be at most delimiter_set::max_wide (16) distinct non ASCII
+delimiters. The set given more is not valid(), it is not used: the
+tokenizer gives no tokens.
+*/
+
+namespace dbj::utf {
+
+    struct token final {
+        size_t offset;
+        size_t length;
+    };
+
+    class delimiter_set final {
+    public:
+        enum : unsigned { max_wide = 16 };
+
+        /*
+        each code point of the zero terminated utf8 string is one delimiter
+        more than max_wide non ASCII delimiters make the set not valid()
+        */
+        explicit delimiter_set(const char* utf8_delimiters) noexcept
+        {
+            const char* end = utf8_delimiters + strlen(utf8_delimiters);
+            const char* walker = utf8_delimiters;
+            while (walker < end) {
+                char32_t cp{};
+                const unsigned step = decode_utf8(walker, end, cp);
+                add(walker, step);
+                walker += step;
+            }
+            build_nibbles();
+        }
+
+        explicit delimiter_set(const char8_t* utf8_delimiters) noexcept
+            : delimiter_set(reinterpret_cast<const char*>(utf8_delimiters))
+        {
+        }
+
+        delimiter_set(const char32_t* delimiters, size_t count) noexcept
+        {
+            for (size_t j = 0; j < count; ++j) {
+                char sequence[4]{};
+                size_t written = 0;
+                if (conversionOK == transcode(delimiters + j, 1, encoding::utf32, sequence, 4, encoding::utf8, written))
+                    add(sequence, unsigned(written));
+            }
+            build_nibbles();
+        }
+
+        // false if there were more than max_wide non ASCII delimiters
+        bool valid() const noexcept { return !too_many_; }
+
+        bool is_candidate(unsigned char c) const noexcept { return candidates_[c >> 5] & (1u << (c & 31)); }
+
+        /*
+        if there is a delimiter at src return its length in bytes, else 0
+        */
+        unsigned match(const char* src, const char* end) const noexcept
+        {
+            const unsigned char lead = (unsigned char)*src;
+            if (lead < 0x80)
+                return is_candidate(lead) ? 1 : 0;
+
+            for (unsigned j = 0; j < wide_count_; ++j) {
+                const unsigned len = wide_length_[j];
+                if ((unsigned char)wide_[j][0] == lead && size_t(end - src) >= len && 0 == memcmp(src, wide_[j], len))
+                    return len;
+            }
+            return 0;
+        }
+
+        /*
+        position of the next delimiter at or after src, or end
+        delimiter_length is set to its length in bytes, 0 at the end
+        */
+        const char* find(const char* src, const char* end, unsigned& delimiter_length) const noexcept
+        {
+            const char* walker = src;
+#ifdef DBJ_UTF_SSE2
+            while (walker + 16 <= end) {
+                uint32_t mask = candidates_in(walker);
+                while (mask) {
+                    const unsigned at = simd::lowest_bit(mask);
+                    if ((delimiter_length = match(walker + at, end)) != 0)
+                        return walker + at;
+                    mask &= mask - 1;
+                }
+                walker += 16;
+            }
+#endif
+            for (; walker < end; ++walker) {
+                if (is_candidate((unsigned char)*walker) && (delimiter_length = match(walker, end)) != 0)
+                    return walker;
+            }
+            delimiter_length = 0;
+            return end;
+        }
+
+    private:
+        void add(const char* sequence, unsigned length) noexcept
+        {
+            const unsigned char lead = (unsigned char)sequence[0];
+
+            if (length > 1) {
+                for (unsigned j = 0; j < wide_count_; ++j)
+                    if (wide_length_[j] == length && 0 == memcmp(wide_[j], sequence, length))
+                        return;
+                if (wide_count_ == max_wide) {
+                    too_many_ = true;
+                    return;
+                }
+                memcpy(wide_[wide_count_], sequence, length);
+                wide_length_[wide_count_] = (uint8_t)length;
+                ++wide_count_;
+            }
+            else if (lead >= 0x80) {
+                // illegal utf8 is not a delimiter
+                return;
+            }
+
+            if (!is_candidate(lead)) {
+                candidates_[lead >> 5] |= 1u << (lead & 31);
+                if (byte_count_ < 16)
+                    bytes_[byte_count_] = lead;
+                ++byte_count_;
+            }
+        }
+
+        /*
+        each high nibble gets one of 8 bucket bits, byte is candidate if
+        lo_[low nibble] & hi_[high nibble] != 0 ; two high nibbles sharing
+        the bucket might give false positives, match() sorts them out
+        */
+        void build_nibbles() noexcept
+        {
+            for (unsigned c = 0; c < 256; ++c) {
+                if (!is_candidate((unsigned char)c))
+                    continue;
+                const uint8_t bucket = uint8_t(1u << ((c >> 4) & 7));
+                lo_[c & 15] |= bucket;
+                hi_[c >> 4] = bucket;
+            }
+            // unused high nibbles must not match
+            for (unsigned h = 0; h < 16; ++h) {
+                bool used = false;
+                for (unsigned l = 0; l < 16 && !used; ++l)
+                    used = is_candidate((unsigned char)(h << 4 | l));
+                if (!used)
+                    hi_[h] = 0;
+            }
+        }
+
+#ifdef DBJ_UTF_SSE2
+        uint32_t candidates_in(const char* src) const noexcept
+        {
+            const __m128i chunk = _mm_loadu_si128((const __m128i*)src);
+#ifdef DBJ_UTF_SSSE3
+            const __m128i low_table = _mm_loadu_si128((const __m128i*)lo_);
+            const __m128i high_table = _mm_loadu_si128((const __m128i*)hi_);
+            const __m128i nibble = _mm_set1_epi8(0x0F);
+            const __m128i low = _mm_shuffle_epi8(low_table, _mm_and_si128(chunk, nibble));
+            const __m128i high = _mm_shuffle_epi8(high_table, _mm_and_si128(_mm_srli_epi16(chunk, 4), nibble));
+            const __m128i hit = _mm_cmpeq_epi8(_mm_and_si128(low, high), _mm_setzero_si128());
+            return (uint32_t)_mm_movemask_epi8(hit) ^ 0xFFFFu;
+#else
+            if (byte_count_ > 16) {
+                uint32_t mask = 0;
+                for (unsigned j = 0; j < 16; ++j)
+                    mask |= uint32_t(is_candidate((unsigned char)src[j])) << j;
+                return mask;
+            }
+            __m128i hit = _mm_setzero_si128();
+            for (unsigned j = 0; j < byte_count_; ++j)
+                hit = _mm_or_si128(hit, _mm_cmpeq_epi8(chunk, _mm_set1_epi8((char)bytes_[j])));
+            return (uint32_t)_mm_movemask_epi8(hit);
+#endif
+        }
+#endif // DBJ_UTF_SSE2
+
+        uint32_t candidates_[8]{};
+        uint8_t bytes_[16]{};
+        unsigned byte_count_{};
+        alignas(16) uint8_t lo_[16]{};
+        alignas(16) uint8_t hi_[16]{};
+        char wide_[max_wide][4]{};
+        uint8_t wide_length_[max_wide]{};
+        unsigned wide_count_{};
+        bool too_many_{};
+    };
+
+    class utf8_tokenizer final {
+    public:
+        // no tokens if the delimiters are not valid()
+        utf8_tokenizer(const char* data, size_t size, const delimiter_set& delimiters, bool skip_empty = false) noexcept
+            : data_(data), end_(data + size), walker_(data), delimiters_(delimiters), skip_empty_(skip_empty),
+            done_(!delimiters.valid())
+        {
+        }
+
+        bool next(token& result) noexcept
+        {
+            while (!done_) {
+                unsigned delimiter_length = 0;
+                const char* found = delimiters_.find(walker_, end_, delimiter_length);
+
+                result.offset = size_t(walker_ - data_);
+                result.length = size_t(found - walker_);
+
+                done_ = found == end_;
+                walker_ = done_ ? end_ : found + delimiter_length;
+
+                if (!skip_empty_ || result.length)
+                    return true;
+            }
+            return false;
+        }
+
+        // offset of the rest of the buffer not yet tokenized, size when done
+        size_t position() const noexcept { return size_t(walker_ - data_); }
+
+    private:
+        const char* data_;
+        const char* end_;
+        const char* walker_;
+        delimiter_set delimiters_;
+        bool skip_empty_;
+        bool done_{};
+    };
+
+    /*
+    tokenize into the caller provided array, returns the number of tokens written
+    stops when the array is full
+    */
+    inline size_t tokenize_utf8(const char* data, size_t size, const delimiter_set& delimiters,
+        token* tokens, size_t capacity, bool skip_empty = false) noexcept
+    {
+        utf8_tokenizer tok(data, size, delimiters, skip_empty);
+        size_t count = 0;
+        while (count < capacity && tok.next(tokens[count]))
+            ++count;
+        return count;
+    }
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_TOKENIZER_INC
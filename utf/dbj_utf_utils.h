@@ -7,6 +7,7 @@
 this is C++ code
 */
 #include "dbj_utf_conversions.h"
+#include "dbj_utf_simd.h"
 
 namespace dbj::utf {
 
@@ -22,6 +23,17 @@ namespace dbj::utf {
 
 #endif // not __cpp_char8_t defined
 
+    /*
+    value is the code unit size in bytes
+    */
+    enum class encoding : uint8_t {
+        utf8 = 1,
+        utf16 = 2,
+        utf32 = 4
+    };
+
+    constexpr size_t code_unit_size(encoding enc) noexcept { return size_t(enc); }
+
     inline conversion_result copy_string_8_to_32(char32_t* dst, size_t dstSize,
         size_t& dstCount, const char* src) {
         const UTF8* sourceStart = reinterpret_cast<const UTF8*>(src);
@@ -49,8 +61,44 @@ namespace dbj::utf {
             reinterpret_cast<const char*>(src));
     }
 
+    /*
+    decode one code point from the utf8 sequence starting at src
+    returns the number of bytes consumed, 0 only if src >= end
+    illegal or truncated sequence is consumed as one byte
+    and reported as LINENOISE_UNI_REPLACEMENT_CHAR
+    */
+    inline unsigned decode_utf8(const char* src, const char* end, char32_t& cp) {
+        if (src >= end)
+            return 0;
+
+        const UTF8* source = reinterpret_cast<const UTF8*>(src);
+
+        if (*source < 0x80) {
+            cp = *source;
+            return 1;
+        }
+
+        const unsigned length = trailing_bytes_for_utf8[*source] + 1;
+
+        if ((size_t)(end - src) < length || !is_legal_utf8(source, (int)length)) {
+            cp = LINENOISE_UNI_REPLACEMENT_CHAR;
+            return 1;
+        }
+
+        UTF32 ch = 0;
+        for (unsigned k = 0; k < length; ++k) {
+            ch = (ch << 6) + source[k];
+        }
+        cp = ch - offsets_from_utf8[length - 1];
+        return length;
+    }
+
     inline size_t strlen_32(const char32_t* str) {
-        const char32_t* ptr = str;
+        return simd::strlen_32(str);
+    }
+
+    inline size_t strlen_16(const char16_t* str) {
+        const char16_t* ptr = str;
 
         while (*ptr) {
             ++ptr;
@@ -118,26 +166,189 @@ namespace dbj::utf {
     }
 
     inline void copy_string_32(char32_t* dst, const char32_t* src, size_t len) {
-        while (0 < len && *src) {
-            *dst++ = *src++;
-            --len;
+        const size_t count = simd::strnlen_32(src, len);
+        memcpy(dst, src, count * sizeof(char32_t));
+        dst[count] = 0;
+    }
+
+    inline int strncmp32(const char32_t* left, const char32_t* right, size_t len) {
+        const size_t at = simd::stop_32(left, right, len);
+
+        if (at < len && left[at]) {
+            return left[at] - right[at];
         }
 
-        *dst = 0;
+        return 0;
     }
 
-    inline int strncmp32(const char32_t* left, const char32_t* right, size_t len) {
-        while (0 < len && *left) {
-            if (*left != *right) {
-                return *left - *right;
+    /*
+    searching and ordering of the utf32 buffers, counted not zero terminated
+    not found is npos
+    */
+    inline constexpr size_t npos = size_t(-1);
+
+    inline size_t find_32(const char32_t* src, size_t count, char32_t cp, size_t from = 0) {
+        if (from >= count)
+            return npos;
+        const size_t at = from + simd::find_32(src + from, count - from, cp);
+        return at < count ? at : npos;
+    }
+
+    // last at or before from
+    inline size_t rfind_32(const char32_t* src, size_t count, char32_t cp, size_t from = npos) {
+        const size_t end = from < count ? from + 1 : count;
+        const size_t at = simd::rfind_32(src, end, cp);
+        return at < end ? at : npos;
+    }
+
+    inline size_t find_32(const char32_t* src, size_t count, const char32_t* needle, size_t needle_count, size_t from = 0) {
+        if (from > count || needle_count > count - from)
+            return npos;
+        const size_t rest = count - from;
+        const size_t at = simd::find_32(src + from, rest, needle, needle_count);
+        return at < rest || needle_count == 0 ? from + at : npos;
+    }
+
+    // last starting at or before from
+    inline size_t rfind_32(const char32_t* src, size_t count, const char32_t* needle, size_t needle_count, size_t from = npos) {
+        if (needle_count > count)
+            return npos;
+        const size_t last = count - needle_count;
+        const size_t end = (from < last ? from : last) + needle_count;
+        if (needle_count == 0)
+            return end;
+        const size_t at = simd::rfind_32(src, end, needle, needle_count);
+        return at < end ? at : npos;
+    }
+
+    /*
+    memcmp style ordering by code point value, shorter prefix is less
+    returns < 0, 0 or > 0
+    */
+    inline int compare_32(const char32_t* left, size_t left_count, const char32_t* right, size_t right_count) {
+        const size_t common = left_count < right_count ? left_count : right_count;
+        const size_t at = simd::mismatch_32(left, right, common);
+
+        if (at < common)
+            return left[at] < right[at] ? -1 : 1;
+
+        return left_count < right_count ? -1 : left_count > right_count ? 1 : 0;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /*
+    number of code units in the target encoding, terminator not included
+    exact for the legal input, for the illegal one conversion fails anyway
+    */
+    inline size_t transcoded_length(const void* src, size_t src_units, encoding from, encoding to) {
+        if (from == to)
+            return src_units;
+
+        size_t length = 0;
+
+        if (from == encoding::utf8) {
+            const UTF8* walker = static_cast<const UTF8*>(src);
+            const UTF8* end = walker + src_units;
+            for (; walker < end; ++walker) {
+                // count the lead bytes, 4 byte sequences need two utf16 units
+                length += (*walker & 0xC0) != 0x80;
+                length += (to == encoding::utf16) && (*walker >= 0xF0);
             }
+        }
+        else if (from == encoding::utf16) {
+            const UTF16* walker = static_cast<const UTF16*>(src);
+            const UTF16* end = walker + src_units;
+            for (; walker < end; ++walker) {
+                const UTF32 ch = *walker;
+                const bool pair = ch >= LINENOISE_UNI_SUR_HIGH_START && ch <= LINENOISE_UNI_SUR_HIGH_END
+                    && walker + 1 < end
+                    && walker[1] >= LINENOISE_UNI_SUR_LOW_START && walker[1] <= LINENOISE_UNI_SUR_LOW_END;
+                if (to == encoding::utf32)
+                    length += 1;
+                else
+                    length += pair ? 4 : ch < 0x80 ? 1 : ch < 0x800 ? 2 : 3;
+                walker += pair;
+            }
+        }
+        else {
+            const UTF32* walker = static_cast<const UTF32*>(src);
+            const UTF32* end = walker + src_units;
+            for (; walker < end; ++walker) {
+                const UTF32 ch = *walker;
+                if (to == encoding::utf16)
+                    length += (ch > LINENOISE_UNI_MAX_BMP && ch <= LINENOISE_UNI_MAX_LEGAL_UTF32) ? 2 : 1;
+                else
+                    length += ch < 0x80 ? 1 : ch < 0x800 ? 2 : ch < 0x10000 ? 3
+                    : ch <= LINENOISE_UNI_MAX_LEGAL_UTF32 ? 4 : 3;
+            }
+        }
+        return length;
+    }
 
-            ++left;
-            ++right;
-            --len;
+    /*
+    any to any, using the direct converter, lenient
+    dst_units is the capacity of dst, written is in code units of the target
+    dst is zero terminated if there is room left
+    */
+    inline conversion_result transcode(const void* src, size_t src_units, encoding from,
+        void* dst, size_t dst_units, encoding to, size_t& written) {
+        written = 0;
+        conversion_result res = conversionOK;
+
+        if (from == to) {
+            if (src_units > dst_units)
+                return targetExhausted;
+            memcpy(dst, src, src_units * code_unit_size(from));
+            written = src_units;
+        }
+        else if (from == encoding::utf8) {
+            const UTF8* source = static_cast<const UTF8*>(src);
+            if (to == encoding::utf16) {
+                UTF16* target = static_cast<UTF16*>(dst);
+                res = convert_utf8_to_utf16(&source, source + src_units, &target, target + dst_units, lenientConversion);
+                written = target - static_cast<UTF16*>(dst);
+            }
+            else {
+                UTF32* target = static_cast<UTF32*>(dst);
+                res = convert_utf8_to_utf32(&source, source + src_units, &target, target + dst_units, lenientConversion);
+                written = target - static_cast<UTF32*>(dst);
+            }
+        }
+        else if (from == encoding::utf16) {
+            const UTF16* source = static_cast<const UTF16*>(src);
+            if (to == encoding::utf8) {
+                UTF8* target = static_cast<UTF8*>(dst);
+                res = convert_utf16_to_utf8(&source, source + src_units, &target, target + dst_units, lenientConversion);
+                written = target - static_cast<UTF8*>(dst);
+            }
+            else {
+                UTF32* target = static_cast<UTF32*>(dst);
+                res = convert_utf16_to_utf32(&source, source + src_units, &target, target + dst_units, lenientConversion);
+                written = target - static_cast<UTF32*>(dst);
+            }
+        }
+        else {
+            const UTF32* source = static_cast<const UTF32*>(src);
+            if (to == encoding::utf8) {
+                UTF8* target = static_cast<UTF8*>(dst);
+                res = convert_utf32_to_utf8(&source, source + src_units, &target, target + dst_units, lenientConversion);
+                written = target - static_cast<UTF8*>(dst);
+            }
+            else {
+                char16_t* target = static_cast<char16_t*>(dst);
+                res = convert_utf32_to_utf16(&source, source + src_units, &target, target + dst_units, lenientConversion);
+                written = target - static_cast<char16_t*>(dst);
+            }
         }
 
-        return 0;
+        if (res == conversionOK && written < dst_units) {
+            switch (to) {
+            case encoding::utf8: static_cast<UTF8*>(dst)[written] = 0; break;
+            case encoding::utf16: static_cast<UTF16*>(dst)[written] = 0; break;
+            case encoding::utf32: static_cast<UTF32*>(dst)[written] = 0; break;
+            }
+        }
+        return res;
     }
 } // dbj::utf
 
@@ -0,0 +1,126 @@
+#pragma once
+#ifndef DBJ_UTF_VALIDATE_INC
+#define DBJ_UTF_VALIDATE_INC
+
+#include "dbj_utf_simd.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Standalone UTF-16 validation. Use it to reject untrusted input before
+spending anything on the conversion.
+
+UTF-16 is valid if every high surrogate (D800..DBFF) is immediately
+followed by the low surrogate (DC00..DFFF) and every low surrogate is
+immediately preceded by the high one. Nothing else can be wrong.
+
+    size_t bad = validate_utf16(src, count, utf16_byte_order::big_endian);
+    if (bad != count) {
+        // src[bad] is the first unpaired surrogate
+    }
+
+SSE2 version checks 8 units per step. Blocks without surrogates, that is
+almost all of the real text, cost one and, one compare and one movemask.
+*/
+
+namespace dbj::utf {
+
+    enum class utf16_byte_order {
+        little_endian,
+        big_endian,
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        native = big_endian
+#else
+        // windows is always little endian
+        native = little_endian
+#endif
+    };
+
+    namespace detail {
+
+        constexpr char16_t byte_swap_16(char16_t u) noexcept
+        {
+            return char16_t((u << 8) | (u >> 8));
+        }
+
+        constexpr bool is_high_surrogate(char16_t u) noexcept { return (u & 0xFC00) == 0xD800; }
+        constexpr bool is_low_surrogate(char16_t u) noexcept { return (u & 0xFC00) == 0xDC00; }
+
+        /*
+        scalar validation from pos onward
+        prev_high is true if src[pos - 1] is high surrogate
+        */
+        inline size_t validate_utf16_scalar(const char16_t* src, size_t pos, size_t count,
+            bool swap, bool prev_high) noexcept
+        {
+            for (; pos < count; ++pos) {
+                const char16_t u = swap ? byte_swap_16(src[pos]) : src[pos];
+                if (prev_high) {
+                    if (!is_low_surrogate(u))
+                        return pos - 1;
+                    prev_high = false;
+                    continue;
+                }
+                if (is_low_surrogate(u))
+                    return pos;
+                prev_high = is_high_surrogate(u);
+            }
+            return prev_high ? count - 1 : count;
+        }
+    } // detail
+
+    /*
+    returns the offset, in code units, of the first unpaired surrogate
+    or count if the whole buffer is valid
+    */
+    inline size_t validate_utf16(const char16_t* src, size_t count,
+        utf16_byte_order order = utf16_byte_order::native) noexcept
+    {
+        const bool swap = order != utf16_byte_order::native;
+        size_t pos = 0;
+        bool prev_high = false;
+
+#ifdef DBJ_UTF_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i surrogate_mask = _mm_set1_epi16((short)0xF800);
+        const __m128i pair_mask = _mm_set1_epi16((short)0xFC00);
+        const __m128i surrogate = _mm_set1_epi16((short)0xD800);
+        const __m128i low_surrogate = _mm_set1_epi16((short)0xDC00);
+
+        for (; pos + 8 <= count; pos += 8) {
+            __m128i units = _mm_loadu_si128((const __m128i*)(src + pos));
+            if (swap)
+                units = _mm_or_si128(_mm_slli_epi16(units, 8), _mm_srli_epi16(units, 8));
+
+            const __m128i any = _mm_cmpeq_epi16(_mm_and_si128(units, surrogate_mask), surrogate);
+            if (!prev_high && _mm_movemask_epi8(any) == 0)
+                continue;
+
+            const __m128i masked = _mm_and_si128(units, pair_mask);
+            // one bit per unit
+            const uint32_t high = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(masked, surrogate), zero));
+            const uint32_t low = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(masked, low_surrogate), zero));
+
+            // low surrogate is expected exactly after each high one
+            const uint32_t expected = ((high << 1) | (prev_high ? 1u : 0u)) & 0xFFu;
+            const uint32_t wrong = expected ^ low;
+
+            if (wrong) {
+                const unsigned at = simd::lowest_bit(wrong);
+                // missing low, the culprit is the high surrogate in front
+                return (expected >> at) & 1u ? pos + at - 1 : pos + at;
+            }
+            prev_high = (high >> 7) & 1u;
+        }
+#endif
+        return detail::validate_utf16_scalar(src, pos, count, swap, prev_high);
+    }
+
+    inline bool is_valid_utf16(const char16_t* src, size_t count,
+        utf16_byte_order order = utf16_byte_order::native) noexcept
+    {
+        return validate_utf16(src, count, order) == count;
+    }
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_VALIDATE_INC
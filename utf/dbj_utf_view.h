@@ -0,0 +1,296 @@
+#pragma once
+#ifndef DBJ_UTF_VIEW_INC
+#define DBJ_UTF_VIEW_INC
+
+#include "dbj_utf_cpp.h"
+#include "dbj_utf_validate.h"
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Non owning views into utf8, utf16 and utf32 text: pointer and length.
+Nothing is allocated, nothing is copied.
+
+    dbj::utf::utf8_view request(receive_buffer, received);
+    size_t colon = request.find(dbj::utf::utf8_view(":"));
+    dbj::utf::utf8_view name = request.substr(0, colon);
+
+    if (name.is_valid() && name == dbj::utf::utf8_view("Host")) ...
+
+    dbj::utf::utf8_string text(...);
+    dbj::utf::utf8_view all = dbj::utf::view_of(text); // free
+
+Positions and sizes are in code units. substr() does not move to the
+code point boundaries, positions returned by find() are on them. A valid
+view cut off the boundaries is of the unknown validity.
+Ordering is by code units, as memcmp would do.
+
+Validity is not checked on construction. is_valid() checks, unless it is
+known; it writes nothing, thus a view shared by const reference can be
+checked from any number of threads. validate() checks once and keeps the
+result in the view; the creator can state it up front when it is known.
+*/
+
+namespace dbj::utf {
+
+    enum class view_validity : uint8_t { unknown, valid, invalid };
+
+    template <typename Unit>
+    class basic_utf_view final {
+    public:
+        static constexpr encoding unit_encoding = encoding(sizeof(Unit));
+
+        constexpr basic_utf_view() noexcept = default;
+
+        constexpr basic_utf_view(const Unit* data, size_t size, view_validity validity = view_validity::unknown) noexcept
+            : data_(data), size_(size), validity_(validity)
+        {
+        }
+
+        // zero terminated
+        explicit basic_utf_view(const Unit* data) noexcept : data_(data), size_(unit_length(data)) {}
+
+        const Unit* data() const noexcept { return data_; }
+        // code units
+        size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        Unit operator[](size_t pos) const noexcept { return data_[pos]; }
+
+        // code points
+        size_t length() const noexcept
+        {
+            if constexpr (sizeof(Unit) == 1) {
+                return simd::count_code_points(data_, size_);
+            }
+            else if constexpr (sizeof(Unit) == 2) {
+                size_t count = 0;
+                for (size_t j = 0; j < size_; ++j)
+                    count += !detail::is_low_surrogate(data_[j]) || j == 0 || !detail::is_high_surrogate(data_[j - 1]);
+                return count;
+            }
+            else {
+                return size_;
+            }
+        }
+
+        bool is_valid() const noexcept
+        {
+            if (validity_ == view_validity::unknown)
+                return check();
+            return validity_ == view_validity::valid;
+        }
+
+        // as is_valid(), the result is kept
+        bool validate() noexcept
+        {
+            if (validity_ == view_validity::unknown)
+                validity_ = check() ? view_validity::valid : view_validity::invalid;
+            return validity_ == view_validity::valid;
+        }
+
+        view_validity validity() const noexcept { return validity_; }
+
+        /*
+        slicing, clipped to the view, validity is passed on when both ends
+        are on the code point boundaries, or to the empty view
+        */
+        basic_utf_view substr(size_t pos, size_t count = npos) const noexcept
+        {
+            if (pos > size_)
+                pos = size_;
+            if (count > size_ - pos)
+                count = size_ - pos;
+            const bool valid = validity_ == view_validity::valid && (!count || (on_boundary(pos) && on_boundary(pos + count)));
+            return basic_utf_view(data_ + pos, count, valid ? view_validity::valid : view_validity::unknown);
+        }
+
+        void remove_prefix(size_t count) noexcept { *this = substr(count); }
+        void remove_suffix(size_t count) noexcept { *this = substr(0, count < size_ ? size_ - count : 0); }
+
+        /*
+        < 0, 0, > 0
+        */
+        int compare(basic_utf_view other) const noexcept
+        {
+            const size_t common = size_ < other.size_ ? size_ : other.size_;
+            size_t at = common;
+            if constexpr (sizeof(Unit) == 1) {
+                const int result = memcmp(data_, other.data_, common);
+                if (result)
+                    return result;
+            }
+            else if constexpr (sizeof(Unit) == 4) {
+                at = simd::mismatch_32(data_, other.data_, common);
+            }
+            else {
+                for (at = 0; at < common && data_[at] == other.data_[at]; ++at) {
+                }
+            }
+            if (at < common)
+                return data_[at] < other.data_[at] ? -1 : 1;
+            return size_ < other.size_ ? -1 : size_ > other.size_ ? 1 : 0;
+        }
+
+        friend bool operator==(basic_utf_view a, basic_utf_view b) noexcept {
+            return a.size_ == b.size_ && a.compare(b) == 0;
+        }
+        friend bool operator!=(basic_utf_view a, basic_utf_view b) noexcept { return !(a == b); }
+        friend bool operator<(basic_utf_view a, basic_utf_view b) noexcept { return a.compare(b) < 0; }
+
+        bool starts_with(basic_utf_view prefix) const noexcept {
+            return prefix.size_ <= size_ && substr(0, prefix.size_) == prefix;
+        }
+        bool ends_with(basic_utf_view suffix) const noexcept {
+            return suffix.size_ <= size_ && substr(size_ - suffix.size_) == suffix;
+        }
+
+        /*
+        searching, npos if not found
+        */
+        size_t find(basic_utf_view what, size_t from = 0) const noexcept
+        {
+            if constexpr (sizeof(Unit) == 4) {
+                return find_32(data_, size_, what.data_, what.size_, from);
+            }
+            else {
+                if (from > size_ || what.size_ > size_ - from)
+                    return npos;
+                if (what.size_ == 0)
+                    return from;
+                const size_t last = size_ - what.size_;
+                for (size_t j = from; j <= last; ++j) {
+                    if constexpr (sizeof(Unit) == 1) {
+                        // lead byte of the needle never shows up inside a sequence
+                        const void* found = memchr(data_ + j, what.data_[0], last - j + 1);
+                        if (!found)
+                            return npos;
+                        j = size_t(static_cast<const Unit*>(found) - data_);
+                    }
+                    if (data_[j] == what.data_[0] && 0 == memcmp(data_ + j, what.data_, what.size_ * sizeof(Unit)))
+                        return j;
+                }
+                return npos;
+            }
+        }
+
+        size_t rfind(basic_utf_view what, size_t from = npos) const noexcept
+        {
+            if constexpr (sizeof(Unit) == 4) {
+                return rfind_32(data_, size_, what.data_, what.size_, from);
+            }
+            else {
+                if (what.size_ > size_)
+                    return npos;
+                if (what.size_ == 0)
+                    return from < size_ ? from : size_;
+                const size_t last = size_ - what.size_;
+                for (size_t j = (from < last ? from : last) + 1; j-- > 0;) {
+                    if (data_[j] == what.data_[0] && 0 == memcmp(data_ + j, what.data_, what.size_ * sizeof(Unit)))
+                        return j;
+                }
+                return npos;
+            }
+        }
+
+        // code point, searched for in this encoding
+        size_t find(char32_t cp, size_t from = 0) const noexcept
+        {
+            if constexpr (sizeof(Unit) == 4) {
+                return find_32(data_, size_, cp, from);
+            }
+            else {
+                Unit units[4]{};
+                size_t count = 0;
+                if (conversionOK != transcode(&cp, 1, encoding::utf32, units, 4, unit_encoding, count))
+                    return npos;
+                return find(basic_utf_view(units, count), from);
+            }
+        }
+
+        /*
+        converting into the caller's buffer, with the dbj::utf converters
+        */
+        size_t converted_length(encoding to) const noexcept
+        {
+            return transcoded_length(data_, size_, unit_encoding, to);
+        }
+
+        // dst is zero terminated if there is room left
+        conversion_result convert(void* dst, size_t dst_units, encoding to, size_t& written) const noexcept
+        {
+            return transcode(data_, size_, unit_encoding, dst, dst_units, to, written);
+        }
+
+    private:
+        static size_t unit_length(const Unit* data) noexcept
+        {
+            if constexpr (sizeof(Unit) == 1)
+                return strlen(data);
+            else if constexpr (sizeof(Unit) == 2)
+                return strlen_16(data);
+            else
+                return strlen_32(data);
+        }
+
+        // pos starts a code point, or is the end; for the valid text only
+        bool on_boundary(size_t pos) const noexcept
+        {
+            if (pos == 0 || pos >= size_)
+                return true;
+            if constexpr (sizeof(Unit) == 1)
+                return (static_cast<unsigned char>(data_[pos]) & 0xC0) != 0x80;
+            else if constexpr (sizeof(Unit) == 2)
+                return !detail::is_low_surrogate(data_[pos]);
+            else
+                return true;
+        }
+
+        bool check() const noexcept
+        {
+            if constexpr (sizeof(Unit) == 1) {
+                const UTF8* walker = reinterpret_cast<const UTF8*>(data_);
+                const UTF8* end = walker + size_;
+                while (walker < end) {
+                    const size_t ascii = simd::ascii_prefix(reinterpret_cast<const char*>(walker), size_t(end - walker));
+                    walker += ascii;
+                    if (walker == end)
+                        break;
+                    const int length = trailing_bytes_for_utf8[*walker] + 1;
+                    if (end - walker < length || !is_legal_utf8(walker, length))
+                        return false;
+                    walker += length;
+                }
+                return true;
+            }
+            else if constexpr (sizeof(Unit) == 2) {
+                return is_valid_utf16(data_, size_);
+            }
+            else {
+                for (size_t j = 0; j < size_; ++j)
+                    if (data_[j] > LINENOISE_UNI_MAX_LEGAL_UTF32
+                        || (data_[j] >= LINENOISE_UNI_SUR_HIGH_START && data_[j] <= LINENOISE_UNI_SUR_LOW_END))
+                        return false;
+                return true;
+            }
+        }
+
+        const Unit* data_{};
+        size_t size_{};
+        view_validity validity_{ view_validity::unknown };
+    };
+
+    using utf8_view = basic_utf_view<char>;
+    using utf16_view = basic_utf_view<char16_t>;
+    using utf32_view = basic_utf_view<char32_t>;
+
+    /*
+    views of the owning strings
+    */
+    inline utf8_view view_of(const utf8_string& text) noexcept { return utf8_view(text.get(), text.bytes()); }
+    inline utf16_view view_of(const utf16_string& text) noexcept {
+        return utf16_view(reinterpret_cast<const char16_t*>(text.get()), text.units());
+    }
+    inline utf32_view view_of(const utf32_string& text) noexcept { return utf32_view(text.get(), text.length()); }
+
+} // namespace dbj::utf
+
+#endif // !DBJ_UTF_VIEW_INC
@@ -5,7 +5,31 @@
  * DBJ changed back to C
  * defined in wcwidth.c
  */
+#include <stddef.h>
+
+/* C has char16_t and char32_t in uchar.h, old MSVC C++ has none of them */
+#if !defined __cplusplus
+#include <uchar.h>
+#elif defined _MSC_VER && _MSC_VER < 1900
+typedef unsigned short char16_t;
+typedef unsigned int char32_t;
+#endif
+
+#ifdef __cplusplus
 extern "C" {
+#endif
+	/**
+	 * Width profile, DBJ_WCWIDTH_PROFILE_CJK and DBJ_WCWIDTH_PROFILE_EMOJI
+	 * can be combined
+	 */
+	enum dbj_wcwidth_profile {
+		DBJ_WCWIDTH_PROFILE_DEFAULT = 0,
+		/* East Asian Ambiguous characters are 2 columns wide */
+		DBJ_WCWIDTH_PROFILE_CJK = 1,
+		/* Emoji in the text presentation are 2 columns wide */
+		DBJ_WCWIDTH_PROFILE_EMOJI = 2
+	};
+
 	/**
 	 * @param ucs          utf32 char
 	 *
@@ -13,11 +37,41 @@ extern "C" {
 	extern int dbj_wcwidth(char32_t ucs);
 	/**
 	 * Calculate a char32_t string width
+	 * Text ends at the first NUL or after n units, whichever comes first,
+	 * in all the dbj_wcswidth functions and in dbj::utf::measure_utf8()
 	 * @param pwcs  utf32 string
 	 * @param n    length of text to calculate
 	 */
 	extern int dbj_wcswidth(const char32_t* pwcs, size_t n);
+	/**
+	 * As dbj_wcswidth, on utf8 text, no conversion
+	 * @param pstr  utf8 string
+	 * @param n    length in bytes
+	 */
+	extern int dbj_wcswidth_utf8(const char* pstr, size_t n);
+	/**
+	 * As dbj_wcswidth, on utf16 text, no conversion
+	 * @param pstr  utf16 string
+	 * @param n    length in utf16 units
+	 */
+	extern int dbj_wcswidth_utf16(const char16_t* pstr, size_t n);
+
+	/**
+	 * The same, for the profile given
+	 * @param profile  dbj_wcwidth_profile values, or-ed
+	 */
+	extern int dbj_wcwidth_ex(char32_t ucs, int profile);
+	extern int dbj_wcswidth_ex(const char32_t* pwcs, size_t n, int profile);
+	extern int dbj_wcswidth_utf8_ex(const char* pstr, size_t n, int profile);
+	extern int dbj_wcswidth_utf16_ex(const char16_t* pstr, size_t n, int profile);
+
+	/**
+	 * DBJ_WCWIDTH_PROFILE_CJK, as Markus Kuhn's mk_wcwidth_cjk
+	 */
+	extern int dbj_wcwidth_cjk(char32_t ucs);
+	extern int dbj_wcswidth_cjk(const char32_t* pwcs, size_t n);
+#ifdef __cplusplus
 } // "C"
+#endif
 
 #endif // !DBJ_WCWIDTH_INC
-
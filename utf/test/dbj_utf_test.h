@@ -0,0 +1,115 @@
+#pragma once
+#ifndef DBJ_UTF_TEST_INC
+#define DBJ_UTF_TEST_INC
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Tests are standalone programs, one per module, no framework.
+
+    DBJ_CHECK(dbj::utf::is_alphabetic(U'Ж'));
+    ...
+    return DBJ_TEST_RESULT;
+
+Failed checks are printed to stderr, main() returns 1 if any did fail.
+Tests given the UCD folder (the same one tools/dbj_ucd_gen.py takes)
+compare the whole code space with it, without it they do spot checks only.
+*/
+
+namespace dbj::utf::test {
+
+    inline int failures = 0;
+
+    inline bool check(bool ok, const char* file, int line, const char* expression) noexcept
+    {
+        if (!ok) {
+            ++failures;
+            // do not flood the output, the count is printed at the end
+            if (failures <= 32)
+                fprintf(stderr, "%s(%d): failed: %s\n", file, line, expression);
+        }
+        return ok;
+    }
+
+    inline int result(const char* name) noexcept
+    {
+        if (failures)
+            fprintf(stderr, "%s: %d checks failed\n", name, failures);
+        else
+            printf("%s: OK\n", name);
+        return failures ? 1 : 0;
+    }
+
+    // xorshift, the same sequence on every platform
+    class random final {
+    public:
+        explicit random(uint64_t seed = 0x9E3779B97F4A7C15ull) noexcept : state_(seed | 1) {}
+
+        uint32_t next() noexcept
+        {
+            state_ ^= state_ << 13;
+            state_ ^= state_ >> 7;
+            state_ ^= state_ << 17;
+            return uint32_t(state_ >> 32);
+        }
+
+        // [0, limit)
+        uint32_t below(uint32_t limit) noexcept { return limit ? next() % limit : 0; }
+
+    private:
+        uint64_t state_;
+    };
+
+    /*
+    calls on_range(first, last, value) for every data line of the UCD file
+    "0041..005A    ; Lu # comment" ; value is the first field after the
+    code points, trimmed; returns false if the file can not be opened
+    */
+    template <typename F>
+    inline bool read_ucd(const char* folder, const char* name, F on_range)
+    {
+        char path[1024]{};
+        snprintf(path, sizeof(path), "%s/%s", folder, name);
+        FILE* file = fopen(path, "r");
+        if (!file) {
+            fprintf(stderr, "can not open %s\n", path);
+            return false;
+        }
+        char line[1024];
+        while (fgets(line, sizeof(line), file)) {
+            char* hash = strchr(line, '#');
+            if (hash)
+                *hash = 0;
+            char* semicolon = strchr(line, ';');
+            if (!semicolon)
+                continue;
+            char* walker = nullptr;
+            const unsigned long first = strtoul(line, &walker, 16);
+            unsigned long last = first;
+            if (walker[0] == '.' && walker[1] == '.')
+                last = strtoul(walker + 2, nullptr, 16);
+
+            char* value = semicolon + 1;
+            while (*value == ' ' || *value == '\t')
+                ++value;
+            size_t length = strcspn(value, ";");
+            while (length && (value[length - 1] == ' ' || value[length - 1] == '\t'
+                || value[length - 1] == '\n' || value[length - 1] == '\r'))
+                --length;
+            value[length] = 0;
+            on_range(char32_t(first), char32_t(last), (const char*)value);
+        }
+        fclose(file);
+        return true;
+    }
+
+} // namespace dbj::utf::test
+
+#define DBJ_CHECK(x) dbj::utf::test::check(bool(x), __FILE__, __LINE__, #x)
+#define DBJ_TEST_RESULT dbj::utf::test::result(__FILE__)
+
+#endif // !DBJ_UTF_TEST_INC
@@ -0,0 +1,179 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+utf8_builder against std::string doing the same appends; the buffer
+grows by doubling, finish() hands it over, illegal utf16 is reported
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_builder.h"
+
+#include <climits>
+#include <string>
+
+using namespace dbj::utf;
+
+static void append_utf8(std::string& out, char32_t cp)
+{
+    if (cp < 0x80) {
+        out += char(cp);
+    }
+    else if (cp < 0x800) {
+        out += char(0xC0 | (cp >> 6));
+        out += char(0x80 | (cp & 0x3F));
+    }
+    else if (cp < 0x10000) {
+        out += char(0xE0 | (cp >> 12));
+        out += char(0x80 | ((cp >> 6) & 0x3F));
+        out += char(0x80 | (cp & 0x3F));
+    }
+    else {
+        out += char(0xF0 | (cp >> 18));
+        out += char(0x80 | ((cp >> 12) & 0x3F));
+        out += char(0x80 | ((cp >> 6) & 0x3F));
+        out += char(0x80 | (cp & 0x3F));
+    }
+}
+
+// counts the blocks taken, heap otherwise
+struct counting final {
+    size_t allocations = 0, live = 0;
+
+    static void* allocate_fn(void* context, size_t bytes)
+    {
+        counting& self = *static_cast<counting*>(context);
+        ++self.allocations;
+        ++self.live;
+        return malloc(bytes);
+    }
+
+    static void deallocate_fn(void* context, void* block, size_t)
+    {
+        --static_cast<counting*>(context)->live;
+        free(block);
+    }
+
+    const utf_allocator handle{ allocate_fn, deallocate_fn, this };
+};
+
+static const char32_t code_point_pool[] = { U'a', U' ', 0x00E9, 0x4E2D, 0x1F600, 0x0301 };
+
+// random appends of every kind, true if the builder holds the model
+static bool appends(test::random& rng, utf8_builder& builder, std::string& model, int count)
+{
+    for (int j = 0; j < count; ++j) {
+        std::u32string piece;
+        for (size_t n = rng.below(rng.below(20) ? 10 : 500); n; --n)
+            piece += code_point_pool[rng.below(6)];
+        std::string piece8;
+        std::u16string piece16;
+        for (char32_t cp : piece) {
+            append_utf8(piece8, cp);
+            if (cp > 0xFFFF) {
+                piece16 += char16_t(0xD800 + ((cp - 0x10000) >> 10));
+                piece16 += char16_t(0xDC00 + ((cp - 0x10000) & 0x3FF));
+            }
+            else {
+                piece16 += char16_t(cp);
+            }
+        }
+
+        const long long number = (long long)(rng.next() % 2000000) - 1000000;
+        switch (rng.below(9)) {
+        case 0: builder.append(piece8.data(), piece8.size()); model += piece8; break;
+        case 1: builder.append(piece8.c_str()); model += piece8; break;
+        case 2: builder.append(piece16.data(), piece16.size()); model += piece8; break;
+        case 3: builder.append(piece.data(), piece.size()); model += piece8; break;
+        case 4: builder.append(piece.empty() ? U'x' : piece[0]); append_utf8(model, piece.empty() ? U'x' : piece[0]); break;
+        case 5: builder.append(char('a' + j % 26)); model += char('a' + j % 26); break;
+        case 6: builder.append_int(number); model += std::to_string(number); break;
+        case 7: builder.append_uint((unsigned long long)number); model += std::to_string((unsigned long long)number); break;
+        default:
+            builder.append_format("<%s|%d>", piece8.c_str(), j);
+            model += "<" + piece8 + "|" + std::to_string(j) + ">";
+        }
+        if (!DBJ_CHECK(builder.size() == model.size() && model == builder.c_str()))
+            return false;
+    }
+    return DBJ_CHECK(builder.capacity() >= builder.size() && builder.status() == conversionOK);
+}
+
+int main()
+{
+    test::random rng;
+
+    // doubling: the blocks taken are logarithmic in the size
+    for (int round = 0; round < 20 && !test::failures; ++round) {
+        counting counter;
+        {
+            utf8_builder builder(&counter.handle);
+            std::string model;
+            appends(rng, builder, model, 3000);
+            size_t blocks = 1;
+            for (size_t capacity = utf8_builder::min_capacity; capacity <= model.size(); capacity *= 2)
+                ++blocks;
+            DBJ_CHECK(counter.allocations <= blocks && counter.live == 1);
+
+            // the buffer is handed over, not copied
+            const char* buffer = builder.c_str();
+            const utf8_string result = builder.finish();
+            DBJ_CHECK(result.get() == buffer && result.bytes() == model.size() && model == result.get());
+            DBJ_CHECK(result.allocator() == &counter.handle && counter.allocations <= blocks);
+            DBJ_CHECK(builder.size() == 0 && builder.capacity() == 0 && *builder.c_str() == 0);
+
+            // reusable after finish, and after clear
+            model.clear();
+            appends(rng, builder, model, 50);
+            builder.clear();
+            model.clear();
+            appends(rng, builder, model, 50);
+            const utf8_string again = builder.finish();
+            DBJ_CHECK(model == again.get());
+        }
+        DBJ_CHECK(counter.live == 0);
+    }
+
+    {
+        // numbers at the limits, doubles, long formats
+        utf8_builder builder;
+        builder.append_int(LLONG_MIN).append(' ').append_int(LLONG_MAX).append(' ').append_uint(ULLONG_MAX)
+            .append(' ').append_int(0).append(' ').append_double(0.1).append(' ').append_double(-2.5, 3);
+        DBJ_CHECK(0 == strcmp(builder.c_str(),
+            "-9223372036854775808 9223372036854775807 18446744073709551615 0 0.10000000000000001 -2.5"));
+
+        const std::string big(5000, 'f');
+        builder.clear();
+        builder.append_format("[%s]", big.c_str());
+        DBJ_CHECK(builder.size() == big.size() + 2 && "[" + big + "]" == builder.c_str());
+        builder.append_format("%s", "");
+        DBJ_CHECK(builder.size() == big.size() + 2);
+    }
+    {
+        // illegal code points are U+FFFD
+        utf8_builder builder;
+        builder.append(char32_t(0xD800)).append(char32_t(0x110000)).append(char32_t(0x10FFFF));
+        DBJ_CHECK(0 == strcmp(builder.c_str(), "\xEF\xBF\xBD\xEF\xBF\xBD\xF4\x8F\xBF\xBF"));
+
+        // unpaired surrogate at the end: what is before it is kept, the failure stays
+        builder.clear();
+        const char16_t broken[] = { u'a', 0xD800 };
+        builder.append(broken, 2).append("b");
+        DBJ_CHECK(builder.status() != conversionOK && builder.c_str()[0] == 'a' && builder.c_str()[builder.size() - 1] == 'b');
+        builder.clear();
+        DBJ_CHECK(builder.status() == conversionOK && builder.size() == 0);
+    }
+    {
+        // empty builder finishes as the empty string; moved from is empty
+        utf8_builder empty;
+        DBJ_CHECK(empty.size() == 0 && *empty.c_str() == 0);
+        const utf8_string nothing = empty.finish();
+        DBJ_CHECK(nothing.bytes() == 0 && *nothing.get() == 0);
+
+        utf8_builder from(100);
+        DBJ_CHECK(from.capacity() >= 100);
+        from.append("kept");
+        utf8_builder to(std::move(from));
+        DBJ_CHECK(0 == strcmp(to.c_str(), "kept") && from.size() == 0 && *from.c_str() == 0);
+    }
+
+    return DBJ_TEST_RESULT;
+}
@@ -0,0 +1,128 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+conversion_cache: results equal to transcode(), hits and evictions
+counted, results outlive the eviction, 8 threads on the small cache
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_cache.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace dbj::utf;
+
+// shared_text equals the transcode() result
+static bool converts(const shared_text& text, const void* src, size_t units, encoding from, encoding to)
+{
+    std::vector<char32_t> expected(units * 4 + 1);
+    size_t written = 0;
+    if (conversionOK != transcode(src, units, from, expected.data(), expected.size(), to, written))
+        return false;
+
+    const void* data = to == encoding::utf8 ? (const void*)text.utf8()
+        : to == encoding::utf16 ? (const void*)text.utf16() : (const void*)text.utf32();
+    const size_t unit = code_unit_size(to);
+    const char zero[4]{};
+    return text && text.target() == to && text.size() == written && data
+        && 0 == memcmp(data, expected.data(), written * unit)
+        && 0 == memcmp((const char*)data + written * unit, zero, unit);
+}
+
+static std::string key(int j)
+{
+    return "k\xC3\xA9y \xF0\x9F\x98\x80 " + std::to_string(j);
+}
+
+int main()
+{
+    {
+        conversion_cache cache(64);
+        DBJ_CHECK(cache.capacity() == 64);
+
+        const std::string k = key(1);
+        shared_text first = cache.to_utf16(k.data(), k.size());
+        shared_text second = cache.to_utf16(k.data(), k.size());
+        DBJ_CHECK(converts(first, k.data(), k.size(), encoding::utf8, encoding::utf16));
+        // the same block
+        DBJ_CHECK(first.utf16() == second.utf16());
+        DBJ_CHECK(cache.stats().misses == 1 && cache.stats().hits == 1);
+
+        // the same bytes, another target is another entry
+        shared_text wide = cache.to_utf32(k.data(), k.size());
+        DBJ_CHECK(converts(wide, k.data(), k.size(), encoding::utf8, encoding::utf32));
+        DBJ_CHECK(wide.utf16() == nullptr && wide.utf8() == nullptr);
+        DBJ_CHECK(cache.stats().misses == 2);
+
+        shared_text back = cache.to_utf8(wide.utf32(), wide.size());
+        DBJ_CHECK(back.size() == k.size() && 0 == memcmp(back.utf8(), k.data(), k.size()));
+
+        // flood it, first survives the eviction
+        for (int j = 2; j < 1000; ++j) {
+            const std::string other = key(j);
+            DBJ_CHECK(converts(cache.to_utf32(other.data(), other.size()), other.data(), other.size(), encoding::utf8, encoding::utf32));
+        }
+        DBJ_CHECK(cache.stats().evictions > 0);
+        DBJ_CHECK(converts(first, k.data(), k.size(), encoding::utf8, encoding::utf16));
+
+        cache.clear();
+        DBJ_CHECK(converts(first, k.data(), k.size(), encoding::utf8, encoding::utf16));
+        DBJ_CHECK(converts(cache.to_utf16(k.data(), k.size()), k.data(), k.size(), encoding::utf8, encoding::utf16));
+
+        // illegal input, nothing cached
+        const char illegal[] = "\xC3(";
+        DBJ_CHECK(!cache.to_utf32(illegal, 2));
+        DBJ_CHECK(!cache.to_utf32(illegal, 2));
+
+        // empty input is not illegal
+        shared_text empty = cache.to_utf32("", 0);
+        DBJ_CHECK(empty && empty.size() == 0 && empty.utf32()[0] == 0);
+
+        shared_text moved(std::move(first));
+        DBJ_CHECK(!first && moved);
+        first = moved;
+        DBJ_CHECK(first.utf16() == moved.utf16());
+    }
+    {
+        // pass through
+        conversion_cache none(0);
+        DBJ_CHECK(none.capacity() == 0);
+        shared_text text = none.to_utf32("abc", 3);
+        DBJ_CHECK(converts(text, "abc", 3, encoding::utf8, encoding::utf32));
+        DBJ_CHECK(none.stats().hits == 0 && none.stats().misses == 1);
+    }
+    {
+        // hot and cold keys from 8 threads, round trips through the cache
+        conversion_cache cache(64);
+        std::vector<std::string> keys;
+        for (int j = 0; j < 200; ++j)
+            keys.push_back(key(j));
+
+        std::atomic<int> wrong{ 0 };
+        auto work = [&](int seed) {
+            for (int round = 0; round < 5000; ++round) {
+                const std::string& k = keys[size_t(round * 7 + seed) % (round % 3 ? 200 : 10)];
+                shared_text utf16 = cache.to_utf16(k.data(), k.size());
+                if (!converts(utf16, k.data(), k.size(), encoding::utf8, encoding::utf16))
+                    ++wrong;
+                shared_text utf32 = cache.to_utf32(utf16.utf16(), utf16.size());
+                shared_text utf8 = cache.to_utf8(utf32.utf32(), utf32.size());
+                if (utf8.size() != k.size() || 0 != memcmp(utf8.utf8(), k.data(), k.size()))
+                    ++wrong;
+            }
+        };
+        std::vector<std::thread> threads;
+        for (int j = 0; j < 8; ++j)
+            threads.emplace_back(work, j);
+        for (std::thread& t : threads)
+            t.join();
+
+        DBJ_CHECK(wrong == 0);
+        const conversion_cache::statistics stats = cache.stats();
+        DBJ_CHECK(stats.hits + stats.misses == 8 * 5000 * 3);
+        DBJ_CHECK(stats.hits > 0 && stats.evictions > 0);
+    }
+
+    return DBJ_TEST_RESULT;
+}
@@ -0,0 +1,130 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+compact_string against std::u32string: the narrowest width, code points,
+copy() and the conversions back, the same from utf8, utf16 and utf32;
+illegal utf8 and lone surrogates as documented
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_compact.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace dbj::utf;
+
+// ASCII, Latin-1, BMP without surrogates, astral
+static char32_t random_code_point(test::random& rng, uint32_t range)
+{
+    switch (range) {
+    case 0: return rng.below(0x80);
+    case 1: return rng.below(0x100);
+    case 2: {
+        const char32_t cp = rng.below(0x10000 - 0x800);
+        return cp < 0xD800 ? cp : cp + 0x800;
+    }
+    default: return 0x10000 + rng.below(0x100000);
+    }
+}
+
+static bool same(const compact_string& s, const std::u32string& text)
+{
+    for (size_t j = 0; j < text.size(); ++j)
+        if (s.at(j) != text[j] || s[j] != text[j])
+            return false;
+    return s.length() == text.size() && s.at(text.size()) == 0;
+}
+
+static void against_model(test::random& rng)
+{
+    for (int round = 0; round < 20000 && !test::failures; ++round) {
+        const uint32_t widest = rng.below(4);
+        std::u32string text;
+        for (size_t n = rng.below(round % 10 ? 70 : 700); n; --n)
+            text += random_code_point(rng, rng.below(widest + 1));
+
+        char32_t high = 0;
+        for (char32_t cp : text)
+            high |= cp;
+        const unsigned width = high <= 0xFF ? 1 : high <= 0xFFFF ? 2 : 4;
+
+        const compact_string from32(text.data(), text.size());
+        DBJ_CHECK(same(from32, text) && from32.width() == width && from32.bytes() == text.size() * width);
+
+        // the same from every encoding and every string
+        const utf32_string s32(text.data(), text.size());
+        const utf8_string s8(s32);
+        const utf16_string s16(s32);
+        const compact_string from8(s8.get(), s8.bytes());
+        const compact_string from16(reinterpret_cast<const char16_t*>(s16.get()), s16.units());
+        const compact_string from_string(s32);
+        DBJ_CHECK(from8 == from32 && from16 == from32 && from_string == from32);
+        DBJ_CHECK(same(from8, text) && same(from16, text));
+
+        // copy, clipped to the end
+        const size_t pos = rng.below(uint32_t(text.size() + 2));
+        const size_t count = rng.below(100);
+        std::vector<char32_t> out(count + 1, U'#');
+        const size_t copied = from32.copy(pos, count, out.data());
+        const size_t expected = pos < text.size() ? std::min(count, text.size() - pos) : 0;
+        DBJ_CHECK(copied == expected && out[copied] == U'#');
+        DBJ_CHECK(0 == memcmp(out.data(), text.data() + (pos < text.size() ? pos : 0), copied * sizeof(char32_t)));
+
+        // back into the utf strings
+        const utf32_string back32 = from32.to_utf32();
+        const utf8_string back8 = from32.to_utf8();
+        const utf16_string back16 = from32.to_utf16();
+        DBJ_CHECK(back32 == s32 && back32.flags() == s32.flags());
+        DBJ_CHECK(back8.bytes() == s8.bytes() && 0 == memcmp(back8.get(), s8.get(), s8.bytes() + 1));
+        DBJ_CHECK(back16.units() == s16.units() && 0 == memcmp(back16.get(), s16.get(), (s16.units() + 1) * 2));
+
+        // a different code point is a different string
+        if (!text.empty()) {
+            std::u32string other = text;
+            other[rng.below(uint32_t(other.size()))] ^= 1;
+            DBJ_CHECK(compact_string(other.data(), other.size()) != from32);
+        }
+    }
+}
+
+static void edges()
+{
+    // each illegal utf8 byte is U+FFFD, that is 2 bytes wide
+    const compact_string illegal("a\xFF" "b", 3);
+    DBJ_CHECK(illegal.length() == 3 && illegal.at(1) == 0xFFFD && illegal.width() == 2);
+
+    // lone surrogates are kept, the pair is one code point
+    const char16_t lone[] = { u'a', 0xD800, u'b' };
+    const compact_string kept(lone, 3);
+    DBJ_CHECK(kept.width() == 2 && kept.length() == 3 && kept.at(1) == 0xD800);
+    const char16_t pair[] = { 0xD83D, 0xDE00 };
+    const compact_string joined(pair, 2);
+    DBJ_CHECK(joined.length() == 1 && joined.at(0) == 0x1F600 && joined.width() == 4);
+
+    // empty, from any source
+    const compact_string empty("", 0);
+    DBJ_CHECK(empty.empty() && empty.width() == 1 && empty.data() == nullptr);
+    DBJ_CHECK(empty == compact_string(U"", 0) && empty == compact_string(u"", 0) && empty == compact_string());
+    DBJ_CHECK(empty.to_utf8().bytes() == 0 && empty.to_utf16().units() == 0 && empty.to_utf32().length() == 0);
+
+    // moves leave the empty string
+    compact_string from(U"Zo\u00EB", 3);
+    compact_string to(std::move(from));
+    DBJ_CHECK(to.width() == 1 && to.length() == 3 && to.at(2) == 0x00EB && from.empty());
+    from = std::move(to);
+    DBJ_CHECK(from.length() == 3 && to.empty() && to.width() == 1);
+
+    // from the arena
+    utf_arena arena;
+    const compact_string in_arena(U"h\u00E9llo", 5, arena.allocator());
+    DBJ_CHECK(in_arena.width() == 1 && in_arena.allocator() == arena.allocator() && in_arena.at(1) == 0x00E9);
+}
+
+int main()
+{
+    test::random rng;
+    against_model(rng);
+    edges();
+    return DBJ_TEST_RESULT;
+}
@@ -0,0 +1,216 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+symbol_table and compressed_strings: every string comes back as it was,
+whole or cut to the buffer given; equality on the compressed form; URL
+like text compresses, any bytes at all round trip, within the bound;
+std::bad_alloc when the allocator has no more memory
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_compress.h"
+
+#include <string>
+#include <vector>
+
+using namespace dbj::utf;
+
+static std::string url(test::random& rng)
+{
+    static const char* hosts[] = { "www.example.com", "api.github.com", "en.wikipedia.org", "news.ycombinator.com" };
+    static const char* words[] = { "users", "repos", "issues", "wiki", "Main_Page", "questions", "search",
+        "Z\xC3\xBCrich", "\xE6\x9D\xB1\xE4\xBA\xAC", "caf\xC3\xA9", "images", "download" };
+
+    std::string s = rng.below(4) ? "https://" : "http://";
+    s += hosts[rng.below(4)];
+    for (uint32_t n = 1 + rng.below(5); n; --n) {
+        s += '/';
+        s += words[rng.below(12)];
+        if (!rng.below(3))
+            s += std::to_string(rng.below(100000));
+    }
+    if (!rng.below(4))
+        s += std::string("?q=") + words[rng.below(12)];
+    return s;
+}
+
+// any byte, 0 and 255 (the escape code) included
+static std::string binary(test::random& rng)
+{
+    std::string s;
+    for (size_t n = rng.below(60); n; --n)
+        s += char(rng.below(4) ? rng.below(256) : rng.below(2) ? 0 : 255);
+    return s;
+}
+
+// blocks left, nullptr after them
+struct failing final {
+    size_t left = 0;
+
+    static void* allocate_fn(void* context, size_t bytes)
+    {
+        failing& self = *static_cast<failing*>(context);
+        if (!self.left)
+            return nullptr;
+        --self.left;
+        return malloc(bytes);
+    }
+
+    static void deallocate_fn(void*, void* block, size_t) { free(block); }
+
+    const utf_allocator handle{ allocate_fn, deallocate_fn, this };
+};
+
+static void train(symbol_table& table, const std::vector<std::string>& sample)
+{
+    std::vector<const char*> strings;
+    std::vector<size_t> sizes;
+    for (const std::string& s : sample) {
+        strings.push_back(s.data());
+        sizes.push_back(s.size());
+    }
+    table.train(strings.data(), sizes.data(), strings.size());
+}
+
+static void round_trip(test::random& rng)
+{
+    std::vector<std::string> all;
+    for (int j = 0; j < 20000; ++j)
+        all.push_back(url(rng));
+    for (int j = 0; j < 500; ++j)
+        all.push_back(binary(rng));
+    all.push_back("");
+
+    symbol_table table;
+    train(table, std::vector<std::string>(all.begin(), all.begin() + 2000));
+
+    DBJ_CHECK(table.size() > 0 && table.size() <= symbol_table::max_symbols);
+    for (unsigned code = 0; code < table.size(); ++code)
+        DBJ_CHECK(table.symbol_length(code) >= 1 && table.symbol_length(code) <= symbol_table::max_symbol_length);
+
+    compressed_strings strings(table);
+    size_t raw = 0, url_raw = 0, url_compressed = 0;
+    for (const std::string& s : all) {
+        const size_t before = strings.compressed_bytes();
+        DBJ_CHECK(strings.append(s.data(), s.size()) == strings.count() - 1);
+        const size_t compressed = strings.compressed_bytes() - before;
+        DBJ_CHECK(compressed <= symbol_table::compressed_bound(s.size()));
+        raw += s.size();
+        if (strings.count() <= 20000) {
+            url_raw += s.size();
+            url_compressed += compressed;
+        }
+    }
+    DBJ_CHECK(strings.count() == all.size());
+    // the URLs are what the table was trained on
+    if (!DBJ_CHECK(url_compressed * 3 < url_raw * 2))
+        fprintf(stderr, "    %zu bytes compressed to %zu\n", url_raw, url_compressed);
+
+    std::vector<char> buffer(4096);
+    for (size_t j = 0; j < all.size() && !test::failures; ++j) {
+        const std::string& s = all[j];
+        DBJ_CHECK(strings.size_of(j) == s.size());
+        DBJ_CHECK(strings.get(j, buffer.data(), buffer.size()) == s.size() && 0 == memcmp(buffer.data(), s.data(), s.size()));
+
+        // cut to the capacity, not a byte more
+        const size_t capacity = rng.below(uint32_t(s.size() + 2));
+        std::vector<char> small(capacity + 1, '#');
+        DBJ_CHECK(strings.get(j, small.data(), capacity) == s.size());
+        const size_t fits = capacity < s.size() ? capacity : s.size();
+        DBJ_CHECK(0 == memcmp(small.data(), s.data(), fits) && small[capacity] == '#');
+
+        DBJ_CHECK(strings.equal(j, s.data(), s.size()));
+        const size_t other = rng.below(uint32_t(all.size()));
+        DBJ_CHECK(strings.equal(j, other) == (s == all[other]));
+        if (!s.empty()) {
+            std::string changed = s;
+            changed[rng.below(uint32_t(changed.size()))] ^= 1;
+            DBJ_CHECK(!strings.equal(j, changed.data(), changed.size()));
+            DBJ_CHECK(!strings.equal(j, s.data(), s.size() - 1));
+        }
+    }
+
+    // the same sample trains the same table, codes are the same
+    symbol_table again;
+    train(again, std::vector<std::string>(all.begin(), all.begin() + 2000));
+    std::vector<uint8_t> a(symbol_table::compressed_bound(4096)), b(a.size());
+    for (size_t j = 0; j < 100; ++j) {
+        const std::string& s = all[j * 7];
+        const size_t size = table.compress(s.data(), s.size(), a.data());
+        DBJ_CHECK(again.compress(s.data(), s.size(), b.data()) == size && 0 == memcmp(a.data(), b.data(), size));
+    }
+    // long string, bigger than the local buffer of equal()
+    const std::string longer = all[0] + all[1] + all[2] + all[3] + all[4] + all[5] + all[6] + all[7];
+    strings.append(longer.data(), longer.size());
+    DBJ_CHECK(strings.equal(strings.count() - 1, longer.data(), longer.size()));
+}
+
+static void tables()
+{
+    // empty table: every byte escaped
+    symbol_table empty;
+    DBJ_CHECK(empty.size() == 0);
+    uint8_t codes[32];
+    char out[16];
+    const size_t size = empty.compress("abc\xFF", 4, codes);
+    DBJ_CHECK(size == symbol_table::compressed_bound(4) && empty.decompressed_size(codes, size) == 4);
+    DBJ_CHECK(empty.decompress(codes, size, out, sizeof(out)) == 4 && 0 == memcmp(out, "abc\xFF", 4));
+
+    // trained on nothing, on the empty strings
+    symbol_table nothing;
+    const char* blank = "";
+    const size_t zero = 0;
+    nothing.train(&blank, &zero, 1);
+    nothing.train(nullptr, nullptr, 0);
+    DBJ_CHECK(nothing.compress("xyz", 3, codes) == 6);
+
+    // from the arena
+    symbol_table table;
+    const char* sample[] = { "https://www.example.com/", "https://www.example.com/index" };
+    const size_t sizes[] = { 24, 29 };
+    table.train(sample, sizes, 2);
+    utf_arena arena;
+    compressed_strings strings(table, arena.allocator());
+    for (int j = 0; j < 1000; ++j)
+        strings.append(sample[j % 2], sizes[j % 2]);
+    DBJ_CHECK(strings.count() == 1000 && strings.equal(998, sample[0], sizes[0]) && strings.equal(1, 999));
+    DBJ_CHECK(strings.compressed_bytes() < 1000 * 10);
+}
+
+template <typename Make>
+static bool throws_bad_alloc(Make make)
+{
+    try {
+        make();
+    }
+    catch (const std::bad_alloc&) {
+        return true;
+    }
+    return false;
+}
+
+static void out_of_memory()
+{
+    symbol_table table;
+    failing none;
+    compressed_strings nothing(table, &none.handle);
+    DBJ_CHECK(throws_bad_alloc([&] { nothing.append("abc", 3); }) && nothing.count() == 0);
+
+    // offsets and the first data block, then no more
+    none.left = 2;
+    compressed_strings strings(table, &none.handle);
+    const std::string small(100, 'a'), big(3000, 'b');
+    DBJ_CHECK(strings.append(small.data(), small.size()) == 0);
+    DBJ_CHECK(throws_bad_alloc([&] { strings.append(big.data(), big.size()); }));
+    DBJ_CHECK(strings.count() == 1 && strings.equal(0, small.data(), small.size()));
+    // the probe of the long string
+    DBJ_CHECK(throws_bad_alloc([&] { strings.equal(0, big.data(), big.size()); }));
+}
+
+int main()
+{
+    test::random rng;
+    round_trip(rng);
+    tables();
+    out_of_memory();
+    return DBJ_TEST_RESULT;
+}
@@ -0,0 +1,164 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+    test_grapheme [UCD folder]
+
+With the UCD folder every line of auxiliary/GraphemeBreakTest.txt is
+segmented by the utf32 and by the utf8 iterators, and counted; the file
+is looked for in the folder itself and in its auxiliary subfolder.
+Lines with surrogates are not utf8, they are tested as utf32 only.
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_grapheme.h"
+
+#include <string>
+#include <vector>
+
+using namespace dbj::utf;
+
+static void append_utf8(std::string& out, char32_t cp)
+{
+    if (cp < 0x80) {
+        out += char(cp);
+    }
+    else if (cp < 0x800) {
+        out += char(0xC0 | (cp >> 6));
+        out += char(0x80 | (cp & 0x3F));
+    }
+    else if (cp < 0x10000) {
+        out += char(0xE0 | (cp >> 12));
+        out += char(0x80 | ((cp >> 6) & 0x3F));
+        out += char(0x80 | (cp & 0x3F));
+    }
+    else {
+        out += char(0xF0 | (cp >> 18));
+        out += char(0x80 | ((cp >> 12) & 0x3F));
+        out += char(0x80 | ((cp >> 6) & 0x3F));
+        out += char(0x80 | (cp & 0x3F));
+    }
+}
+
+/*
+text split in clusters: the cluster lengths in code points
+tests the utf32 iterator, and the utf8 one if there are no surrogates
+*/
+static bool segments(const std::u32string& text, const std::vector<size_t>& expected)
+{
+    bool ok = true;
+
+    std::vector<size_t> found;
+    utf32_grapheme_iterator it32(text.data(), text.size());
+    for (size_t offset{}, length{}; it32.next(offset, length);)
+        found.push_back(length);
+    ok &= DBJ_CHECK(found == expected);
+    ok &= DBJ_CHECK(count_grapheme_clusters(text.data(), text.size()) == expected.size());
+
+    for (char32_t cp : text)
+        if (cp >= 0xD800 && cp <= 0xDFFF)
+            return ok;
+
+    // expected lengths in bytes
+    std::string utf8;
+    std::vector<size_t> expected8;
+    size_t at = 0;
+    for (size_t length : expected) {
+        const size_t before = utf8.size();
+        for (size_t j = 0; j < length; ++j)
+            append_utf8(utf8, text[at++]);
+        expected8.push_back(utf8.size() - before);
+    }
+
+    found.clear();
+    size_t next_offset = 0;
+    utf8_grapheme_iterator it8(utf8.data(), utf8.size());
+    for (size_t offset{}, length{}; it8.next(offset, length);) {
+        ok &= DBJ_CHECK(offset == next_offset);
+        next_offset = offset + length;
+        found.push_back(length);
+    }
+    ok &= DBJ_CHECK(found == expected8);
+    ok &= DBJ_CHECK(count_grapheme_clusters(utf8.data(), utf8.size()) == expected.size());
+    return ok;
+}
+
+static void spot_checks()
+{
+    // CR LF, controls
+    segments(U"a\r\nb\n\r", { 1, 2, 1, 1, 1 });
+    // combining marks, spacing mark, prepend
+    segments(U"e\u0301\u0302x\u0915\u094D\u0903\u0600a", { 3, 1, 3, 2 });
+    // Hangul L V T, LV T, L L
+    segments(U"\u1100\u1161\u11A8\uAC00\u11A8\u1100\u1100", { 3, 2, 2 });
+    // flags, odd regional indicator is alone
+    segments(U"\U0001F1E9\U0001F1EA\U0001F1EB\U0001F1F7\U0001F1FA", { 2, 2, 1 });
+    // emoji ZWJ sequence with modifiers and a variation selector
+    segments(U"\U0001F469\U0001F3FD\u200D\U0001F52C\u2764\uFE0F!", { 4, 2, 1 });
+    // ZWJ not after the pictograph does not join
+    segments(U"a\u200D\U0001F52C", { 2, 1 });
+    // ASCII only, one cluster per byte
+    segments(U"plain text", std::vector<size_t>(10, 1));
+    segments(U"", {});
+}
+
+static bool open_test_file(const char* ucd, FILE*& file)
+{
+    for (const char* name : { "GraphemeBreakTest.txt", "auxiliary/GraphemeBreakTest.txt" }) {
+        const std::string path = std::string(ucd) + "/" + name;
+        if ((file = fopen(path.c_str(), "r")) != nullptr)
+            return true;
+    }
+    fprintf(stderr, "can not open %s/GraphemeBreakTest.txt\n", ucd);
+    return false;
+}
+
+/*
+    ÷ 0020 × 0308 ÷ 0020 ÷    # comment
+÷ is a break, × is not
+*/
+static void against_test_file(const char* ucd)
+{
+    FILE* file = nullptr;
+    if (!DBJ_CHECK(open_test_file(ucd, file)))
+        return;
+
+    unsigned lines = 0, line_number = 0;
+    char line[4096];
+    while (fgets(line, sizeof(line), file)) {
+        ++line_number;
+        if (char* hash = strchr(line, '#'))
+            *hash = 0;
+
+        std::u32string text;
+        std::vector<size_t> expected;
+        size_t cluster = 0;
+        for (char* token = strtok(line, " \t\r\n"); token; token = strtok(nullptr, " \t\r\n")) {
+            if (0 == strcmp(token, "\xC3\xB7")) {
+                // ÷
+                if (cluster)
+                    expected.push_back(cluster);
+                cluster = 0;
+            }
+            else if (0 != strcmp(token, "\xC3\x97")) {
+                // not ×, the code point
+                text += char32_t(strtoul(token, nullptr, 16));
+                ++cluster;
+            }
+        }
+        if (text.empty())
+            continue;
+
+        ++lines;
+        if (!segments(text, expected))
+            fprintf(stderr, "    GraphemeBreakTest.txt line %u\n", line_number);
+    }
+    fclose(file);
+    DBJ_CHECK(lines > 0);
+}
+
+int main(int argc, char** argv)
+{
+    spot_checks();
+    if (argc > 1)
+        against_test_file(argv[1]);
+    return DBJ_TEST_RESULT;
+}
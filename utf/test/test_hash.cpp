@@ -0,0 +1,142 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+hash_text is hash_bytes of the utf8 form, the same from utf8, utf16,
+utf32 and the utf string classes, for every length around the block
+sizes of the schedule; illegal code points hash as U+FFFD. Values of
+hash_bytes are pinned, they must not change between releases.
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_cpp.h"
+
+#include <string>
+
+using namespace dbj::utf;
+
+static void append_utf8(std::string& out, char32_t cp)
+{
+    if (cp < 0x80) {
+        out += char(cp);
+    }
+    else if (cp < 0x800) {
+        out += char(0xC0 | (cp >> 6));
+        out += char(0x80 | (cp & 0x3F));
+    }
+    else if (cp < 0x10000) {
+        out += char(0xE0 | (cp >> 12));
+        out += char(0x80 | ((cp >> 6) & 0x3F));
+        out += char(0x80 | (cp & 0x3F));
+    }
+    else {
+        out += char(0xF0 | (cp >> 18));
+        out += char(0x80 | ((cp >> 12) & 0x3F));
+        out += char(0x80 | ((cp >> 6) & 0x3F));
+        out += char(0x80 | (cp & 0x3F));
+    }
+}
+
+static std::u16string to_utf16(const std::u32string& text)
+{
+    std::u16string result;
+    for (char32_t cp : text) {
+        if (cp > 0xFFFF) {
+            result += char16_t(0xD800 + ((cp - 0x10000) >> 10));
+            result += char16_t(0xDC00 + ((cp - 0x10000) & 0x3FF));
+        }
+        else {
+            result += char16_t(cp);
+        }
+    }
+    return result;
+}
+
+static const char32_t code_point_pool[] = { U'a', U'Z', 0x7F, 0x80, 0x00E9, 0x4E2D, 0x1F600, 0x10FFFF };
+
+// same value from every encoding, true if so
+static bool equal_everywhere(const std::u32string& text, uint64_t seed)
+{
+    std::string utf8;
+    for (char32_t cp : text)
+        append_utf8(utf8, cp);
+    const std::u16string utf16 = to_utf16(text);
+
+    const uint64_t expected = hash_bytes(utf8.data(), utf8.size(), seed);
+    return hash_text(utf8.data(), utf8.size(), seed) == expected
+        && hash_text(utf16.data(), utf16.size(), seed) == expected
+        && hash_text(text.data(), text.size(), seed) == expected;
+}
+
+int main()
+{
+    test::random rng;
+
+    // every length, ASCII only (the SIMD narrowing) and mixed
+    for (size_t length = 0; length < 400 && !test::failures; ++length)
+        for (int round = 0; round < 8; ++round) {
+            std::u32string text;
+            for (size_t j = 0; j < length; ++j)
+                text += round < 4 ? char32_t('a' + rng.below(26)) : code_point_pool[rng.below(8)];
+            const uint64_t seed = round % 2 ? rng.next() : 0;
+            if (!DBJ_CHECK(equal_everywhere(text, seed)))
+                fprintf(stderr, "    %zu code points, seed %llu\n", length, (unsigned long long)seed);
+        }
+
+    // long ones, streamed
+    for (int round = 0; round < 50 && !test::failures; ++round) {
+        std::u32string text;
+        for (size_t n = 1000 + rng.below(20000); n; --n)
+            text += rng.below(4) ? char32_t('a' + rng.below(26)) : code_point_pool[rng.below(8)];
+        DBJ_CHECK(equal_everywhere(text, rng.next()));
+    }
+
+    {
+        // the string classes
+        const char32_t text32[] = U"Z\u00FCrich \u4E2D \U0001F600 and a bit more of the text";
+        const utf32_string s32(text32, strlen_32(text32));
+        const utf8_string s8(s32);
+        const utf16_string s16(s32);
+        const uint64_t expected = hash_bytes(s8.get(), s8.bytes(), 42);
+        DBJ_CHECK(hash_text(s8, 42) == expected && hash_text(s16, 42) == expected && hash_text(s32, 42) == expected);
+        DBJ_CHECK(hash_text(s8) != expected);
+#ifdef __cpp_char8_t
+        const char8_t text8[] = u8"Z\u00FCrich \u4E2D \U0001F600 and a bit more of the text";
+        DBJ_CHECK(hash_text(text8, sizeof(text8) - 1, 42) == expected);
+#endif
+    }
+    {
+        // unpaired surrogates, values above U+10FFFF: U+FFFD
+        const char* replaced = "a\xEF\xBF\xBD" "b\xEF\xBF\xBD";
+        const uint64_t expected = hash_bytes(replaced, strlen(replaced));
+        const char16_t lone16[] = { u'a', 0xD800, u'b', 0xDC00 };
+        const char32_t lone32[] = { U'a', 0xDFFF, U'b', 0x110000 };
+        DBJ_CHECK(hash_text(lone16, 4) == expected && hash_text(lone32, 4) == expected);
+
+        std::u32string many(200, U'x');
+        many[150] = 0x110000;
+        std::string many8(150, 'x');
+        many8 += "\xEF\xBF\xBD" + std::string(49, 'x');
+        DBJ_CHECK(hash_text(many.data(), many.size()) == hash_bytes(many8.data(), many8.size()));
+    }
+    {
+        // pinned values, one per branch of the schedule
+        static const struct { size_t size; uint64_t seed; uint64_t value; } pinned[] = {
+            { 0, 0, 0x0409638ee2bde459ull },
+            { 3, 0, 0x291cbf5d69a58d38ull },
+            { 8, 0, 0x94b27a810ddd868dull },
+            { 16, 0, 0xc64ffe0606b7c46full },
+            { 17, 0, 0xaaf94df85ba1db56ull },
+            { 48, 0, 0x339573cc83a04d02ull },
+            { 49, 0, 0xd46014114c226ad6ull },
+            { 200, 0, 0x20008f60002abbb2ull },
+            { 200, 0x1234567890ABCDEFull, 0xd5aef6420067877dull },
+        };
+        std::string bytes;
+        for (int j = 0; j < 200; ++j)
+            bytes += char('A' + j % 61);
+        for (const auto& p : pinned)
+            if (!DBJ_CHECK(hash_bytes(bytes.data(), p.size, p.seed) == p.value))
+                fprintf(stderr, "    %zu bytes: 0x%016llxull\n", p.size, (unsigned long long)hash_bytes(bytes.data(), p.size, p.seed));
+    }
+
+    return DBJ_TEST_RESULT;
+}
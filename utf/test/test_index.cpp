@@ -0,0 +1,89 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+utf8_index against the offsets of the code points recorded while the
+text was made, for every stride; at(), slice() and substring() at the
+ends, and over illegal utf8
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_index.h"
+
+#include <string>
+#include <vector>
+
+using namespace dbj::utf;
+
+static void against_offsets(test::random& rng)
+{
+    static const char* pieces[] = { "a", "\xC3\xA9", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80", "\n" };
+    static const char32_t code_points[] = { U'a', 0x00E9, 0x4E2D, 0x1F600, U'\n' };
+
+    for (int round = 0; round < 300 && !test::failures; ++round) {
+        std::string text;
+        std::vector<size_t> offsets;
+        std::vector<char32_t> expected;
+        for (size_t n = rng.below(round % 10 ? 500 : 20000); n; --n) {
+            const uint32_t k = rng.below(5);
+            offsets.push_back(text.size());
+            expected.push_back(code_points[k]);
+            text += pieces[k];
+        }
+        offsets.push_back(text.size());
+        const size_t length = expected.size();
+
+        const size_t stride = round % 3 ? 1 + rng.below(100) : size_t(utf8_index::default_stride);
+        const utf8_index index(text.data(), text.size(), stride);
+        DBJ_CHECK(index.length() == length && index.bytes() == text.size() && index.stride() == stride);
+
+        for (size_t n = 0; n < length; n += 1 + rng.below(8))
+            if (!DBJ_CHECK(index.offset_of(n) == offsets[n] && index.at(n) == expected[n]))
+                break;
+        DBJ_CHECK(index.offset_of(length) == text.size() && index.at(length) == 0 && index.at(length + 5) == 0);
+
+        for (int q = 0; q < 100; ++q) {
+            const size_t first = rng.below(uint32_t(length + 1));
+            const size_t count = rng.below(2) ? rng.below(uint32_t(stride + 2)) : rng.below(1000);
+            const size_t last = first + count < length ? first + count : length;
+            size_t offset = 0, bytes = 0;
+            DBJ_CHECK(index.slice(first, count, offset, bytes));
+            DBJ_CHECK(offset == offsets[first] && bytes == offsets[last] - offsets[first]);
+
+            const utf8_string part = index.substring(first, count);
+            DBJ_CHECK(part.length() == last - first && part.bytes() == bytes
+                && 0 == memcmp(part.get(), text.data() + offset, bytes));
+        }
+        size_t offset = 0, bytes = 0;
+        DBJ_CHECK(!index.slice(length + 1, 1, offset, bytes));
+        DBJ_CHECK(index.substring(length + 1, 1).bytes() == 0);
+        DBJ_CHECK(index.slice(0, size_t(-1), offset, bytes) && offset == 0 && bytes == text.size());
+    }
+}
+
+static void edges()
+{
+    // empty text
+    const utf8_index empty("", 0);
+    size_t offset = 1, bytes = 1;
+    DBJ_CHECK(empty.length() == 0 && empty.at(0) == 0 && empty.offset_of(0) == 0);
+    DBJ_CHECK(empty.slice(0, 5, offset, bytes) && offset == 0 && bytes == 0);
+
+    // from the string, moved, stride 0 is the default
+    const utf8_string text("Zu\xCC\x88rich", 8);
+    utf8_index first(text, 0);
+    const utf8_index index(std::move(first));
+    DBJ_CHECK(index.stride() == utf8_index::default_stride && index.length() == 7 && index.at(2) == 0x0308);
+
+    // lead bytes are counted, the stray continuation byte is not a code point
+    const char broken[] = "a\x80" "b\xC3";
+    const utf8_index illegal(broken, 4, 1);
+    DBJ_CHECK(illegal.length() == 3 && illegal.at(0) == U'a' && illegal.at(1) == U'b');
+    DBJ_CHECK(illegal.offset_of(1) == 2 && illegal.offset_of(2) == 3 && illegal.at(2) == 0xFFFD);
+}
+
+int main()
+{
+    test::random rng;
+    against_offsets(rng);
+    edges();
+    return DBJ_TEST_RESULT;
+}
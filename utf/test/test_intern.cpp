@@ -0,0 +1,93 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+intern_pool: equal strings are one handle, from many threads too;
+size, length, hash and the bytes kept as given
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_intern.h"
+
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace dbj::utf;
+
+static std::string name(int j)
+{
+    return "tag \xC5\xBE" + std::to_string(j) + (j % 7 ? "" : std::string(200, 'x'));
+}
+
+int main()
+{
+    {
+        intern_pool pool;
+        const interned a = pool.intern("Zu\xCC\x88rich");
+        const interned b = pool.intern(std::string("Zu\xCC\x88rich").c_str());
+        const interned c = pool.intern("Zurich");
+        DBJ_CHECK(a && a == b && a != c);
+        DBJ_CHECK(a.size() == 8 && a.length() == 7 && 0 == strcmp(a.c_str(), "Zu\xCC\x88rich"));
+        DBJ_CHECK(a.hash() == hash_bytes("Zu\xCC\x88rich", 8));
+        DBJ_CHECK(pool.count() == 2);
+
+        // embedded NUL is kept, the string is counted
+        const interned zero = pool.intern("a\0b", 3);
+        DBJ_CHECK(zero.size() == 3 && 0 == memcmp(zero.c_str(), "a\0b", 4) && zero != pool.intern("a"));
+
+        const interned empty = pool.intern("", 0);
+        DBJ_CHECK(empty && empty.size() == 0 && empty == pool.intern(""));
+
+        const interned none;
+        DBJ_CHECK(!none && none.size() == 0 && 0 == strcmp(none.c_str(), ""));
+
+        std::unordered_set<interned, interned_hasher> set{ a, b, c };
+        DBJ_CHECK(set.size() == 2);
+    }
+    {
+        // tables grow, handles stay valid; strings bigger than the arena chunk
+        intern_pool pool;
+        std::vector<interned> handles;
+        for (int j = 0; j < 20000; ++j) {
+            const std::string s = name(j);
+            handles.push_back(pool.intern(s.data(), s.size()));
+        }
+        const std::string huge(100 * 1024, 'h');
+        const interned big = pool.intern(huge.data(), huge.size());
+        DBJ_CHECK(big.size() == huge.size() && 0 == memcmp(big.c_str(), huge.data(), huge.size()));
+        DBJ_CHECK(pool.count() == 20001);
+        DBJ_CHECK(pool.reserved() >= huge.size());
+
+        for (int j = 0; j < 20000; ++j) {
+            const std::string s = name(j);
+            if (!DBJ_CHECK(handles[size_t(j)].size() == s.size() && s == handles[size_t(j)].c_str()
+                && pool.intern(s.data(), s.size()) == handles[size_t(j)]))
+                break;
+        }
+        DBJ_CHECK(pool.count() == 20001);
+    }
+    {
+        // 8 threads intern the same names in different order, each name is one handle
+        intern_pool pool;
+        std::vector<std::vector<interned>> seen(8, std::vector<interned>(2000));
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t)
+            threads.emplace_back([&, t] {
+                for (int j = 0; j < 2000; ++j) {
+                    const int k = (j * (t + 1)) % 2000;
+                    const std::string s = name(k);
+                    seen[size_t(t)][size_t(k)] = pool.intern(s.data(), s.size());
+                }
+            });
+        for (std::thread& t : threads)
+            t.join();
+
+        DBJ_CHECK(pool.count() == 2000);
+        for (int t = 1; t < 8; ++t)
+            for (size_t k = 0; k < 2000; ++k)
+                if (seen[size_t(t)][k] && !DBJ_CHECK(seen[size_t(t)][k] == seen[0][k]))
+                    break;
+    }
+
+    return DBJ_TEST_RESULT;
+}
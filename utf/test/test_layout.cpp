@@ -0,0 +1,322 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+utf8_line_breaker and utf32_line_breaker against the slow greedy
+breaking, one code point at a time, by the rules of dbj_utf_layout.h;
+truncate_columns against the longest prefix that fits, the result
+exactly that wide, cut to the capacity as snprintf does
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_layout.h"
+
+#include <string>
+#include <vector>
+
+using namespace dbj::utf;
+
+namespace {
+
+    struct model_line final {
+        size_t begin{};
+        size_t end{};
+        int columns{};
+
+        bool operator==(const model_line& other) const
+        {
+            return begin == other.begin && end == other.end && columns == other.columns;
+        }
+    };
+
+    const int profiles[] = { DBJ_WCWIDTH_PROFILE_DEFAULT, DBJ_WCWIDTH_PROFILE_CJK };
+
+} // namespace
+
+static int width_of(char32_t cp, int profile)
+{
+    const int width = dbj_wcwidth_ex(cp, profile);
+    return width < 0 ? 0 : width;
+}
+
+static int width_of(const std::u32string& text, size_t begin, size_t end, int profile)
+{
+    int columns = 0;
+    for (size_t j = begin; j < end; ++j)
+        columns += width_of(text[j], profile);
+    return columns;
+}
+
+static size_t trimmed(const std::u32string& text, size_t begin, size_t end)
+{
+    while (end > begin && text[end - 1] == U' ')
+        --end;
+    return end;
+}
+
+/*
+the lines of the paragraph [begin, end), greedy: the line ends at the
+last break that fits, or where it overflows if there is no break
+breaks: before the run of spaces, the next line after it; before the
+wide char and after it, the zero width chars stay with the char before
+*/
+static void break_paragraph(const std::u32string& text, size_t begin, size_t end, int columns, int profile,
+    std::vector<model_line>& lines)
+{
+    size_t pos = begin;
+    while (pos < end) {
+        model_line line{ pos, npos, 0 };
+        size_t line_next = 0;
+        size_t break_end = npos, break_next = 0;
+        int used = 0, last_width = 0;
+
+        for (size_t k = pos; k < end; ++k) {
+            const char32_t cp = text[k];
+            const int width = width_of(cp, profile);
+
+            if (k > pos) {
+                // before the run of spaces
+                if (cp == U' ' && text[k - 1] != U' ') {
+                    size_t after = k;
+                    while (after < end && text[after] == U' ')
+                        ++after;
+                    break_end = k, break_next = after;
+                }
+                // around the wide char
+                else if (width && (width == 2 || last_width == 2) && trimmed(text, pos, k) > pos)
+                    break_end = trimmed(text, pos, k), break_next = k;
+            }
+            if (width && used + width > columns && k > pos) {
+                if (break_end != npos)
+                    line.end = break_end, line_next = break_next;
+                else
+                    line.end = k, line_next = k;
+                break;
+            }
+            used += width;
+            if (width)
+                last_width = width;
+        }
+        if (line.end == npos)
+            line.end = trimmed(text, pos, end), line_next = end;
+        line.columns = width_of(text, line.begin, line.end, profile);
+        lines.push_back(line);
+        pos = line_next;
+    }
+}
+
+static std::vector<model_line> break_slowly(const std::u32string& text, int columns, int profile)
+{
+    std::vector<model_line> lines;
+    if (columns < 1)
+        columns = 1;
+    size_t begin = 0;
+    for (size_t j = 0; j < text.size(); ++j) {
+        const bool crlf = text[j] == U'\r' && j + 1 < text.size() && text[j + 1] == U'\n';
+        if (text[j] != U'\n' && !crlf)
+            continue;
+        const size_t count = lines.size();
+        break_paragraph(text, begin, j, columns, profile, lines);
+        if (lines.size() == count)
+            lines.push_back({ begin, begin, 0 });
+        j += crlf;
+        begin = j + 1;
+    }
+    break_paragraph(text, begin, text.size(), columns, profile, lines);
+    return lines;
+}
+
+template <typename Unit>
+static std::vector<model_line> break_fast(const Unit* text, size_t size, int columns, int profile)
+{
+    std::vector<model_line> lines;
+    basic_line_breaker<Unit> breaker(text, size, columns, profile);
+    for (text_line line; breaker.next(line);)
+        lines.push_back({ line.begin, line.end, line.columns });
+    return lines;
+}
+
+static void encode(char32_t cp, std::string& utf8)
+{
+    if (cp < 0x80)
+        utf8 += char(cp);
+    else if (cp < 0x800)
+        utf8 += char(0xC0 | cp >> 6), utf8 += char(0x80 | (cp & 0x3F));
+    else if (cp < 0x10000)
+        utf8 += char(0xE0 | cp >> 12), utf8 += char(0x80 | (cp >> 6 & 0x3F)), utf8 += char(0x80 | (cp & 0x3F));
+    else
+        utf8 += char(0xF0 | cp >> 18), utf8 += char(0x80 | (cp >> 12 & 0x3F)),
+            utf8 += char(0x80 | (cp >> 6 & 0x3F)), utf8 += char(0x80 | (cp & 0x3F));
+}
+
+// words, spaces, wide and zero width chars, controls and line ends
+static std::u32string random_text(test::random& rng)
+{
+    static const char32_t others[] = { 0x00E9, 0x00A1, 0x0301, 0x200B, 0x4E2D, 0x3042, 0xFF21, 0x1F600,
+        U'\t', U'\r', 0x0085, 0x2500 };
+    std::u32string text;
+    const uint32_t word = 1 + rng.below(12);
+    for (size_t n = rng.below(200); n; --n) {
+        switch (rng.below(12)) {
+        case 0: case 1: text += U' '; break;
+        case 2: text += rng.below(4) ? U' ' : U'\n'; break;
+        case 3: text += rng.below(2) ? U"\r\n" : U"  "; break;
+        case 4: case 5: text += others[rng.below(12)]; break;
+        default:
+            for (size_t k = 1 + rng.below(word); k; --k)
+                text += char32_t(U'a' + rng.below(26));
+        }
+    }
+    return text;
+}
+
+static void against_model(test::random& rng)
+{
+    for (int round = 0; round < 20000 && !test::failures; ++round) {
+        const std::u32string text = random_text(rng);
+        const int columns = int(rng.below(round % 2 ? 10 : 50));
+        const int profile = profiles[rng.below(2)];
+
+        const std::vector<model_line> expected = break_slowly(text, columns, profile);
+        if (!DBJ_CHECK(break_fast(text.data(), text.size(), columns, profile) == expected))
+            break;
+
+        // the same lines in utf8, offsets in bytes
+        std::string utf8;
+        std::vector<size_t> offsets;
+        for (char32_t cp : text) {
+            offsets.push_back(utf8.size());
+            encode(cp, utf8);
+        }
+        offsets.push_back(utf8.size());
+        std::vector<model_line> expected8 = expected;
+        for (model_line& line : expected8)
+            line.begin = offsets[line.begin], line.end = offsets[line.end];
+        DBJ_CHECK(break_fast(utf8.data(), utf8.size(), columns, profile) == expected8);
+
+        // no line wider than asked, but the one char wider than the line
+        for (const model_line& line : expected)
+            DBJ_CHECK(line.columns <= (columns < 1 ? 1 : columns) || (line.columns == 2 && line.end - line.begin >= 1));
+    }
+}
+
+static void lines()
+{
+    const auto check = [](const char* text, int columns, std::vector<model_line> expected, int profile = DBJ_WCWIDTH_PROFILE_DEFAULT) {
+        return DBJ_CHECK(break_fast(text, strlen(text), columns, profile) == expected);
+    };
+    check("", 10, {});
+    check("hello world", 80, { { 0, 11, 11 } });
+    check("hello world", 5, { { 0, 5, 5 }, { 6, 11, 5 } });
+    check("hello world", 8, { { 0, 5, 5 }, { 6, 11, 5 } });
+    // the word longer than the line is cut
+    check("abcdefgh", 3, { { 0, 3, 3 }, { 3, 6, 3 }, { 6, 8, 2 } });
+    // spaces at the break belong to no line, the newline ends the line
+    check("ab   cd", 3, { { 0, 2, 2 }, { 5, 7, 2 } });
+    check("ab\ncd\r\n\nef", 10, { { 0, 2, 2 }, { 3, 5, 2 }, { 7, 7, 0 }, { 8, 10, 2 } });
+    // spaces and the newline after the full line: no empty line
+    check("abc \ndef", 3, { { 0, 3, 3 }, { 5, 8, 3 } });
+    check("abc\ndef", 3, { { 0, 3, 3 }, { 4, 7, 3 } });
+    // the spaces before the wide char
+    check("a  \xE4\xB8\xAD", 4, { { 0, 1, 1 }, { 3, 6, 2 } });
+    // the wide chars break anywhere, the combining mark stays
+    check("\xE4\xB8\xAD\xE6\x96\x87\xE5\xAD\x97", 4, { { 0, 6, 4 }, { 6, 9, 2 } });
+    check("a\xCC\x81" "b", 1, { { 0, 3, 1 }, { 3, 4, 1 } });
+    // the char wider than the line
+    check("\xE4\xB8\xAD" "a", 1, { { 0, 3, 2 }, { 3, 4, 1 } });
+    // leading spaces are kept, columns below 1 are 1
+    check("   ab", 4, { { 0, 4, 4 }, { 4, 5, 1 } });
+    check("ab", 0, { { 0, 1, 1 }, { 1, 2, 1 } });
+
+    // the profile
+    check("\xC2\xA1\xC2\xA1\xC2\xA1", 4, { { 0, 6, 3 } });
+    check("\xC2\xA1\xC2\xA1\xC2\xA1", 4, { { 0, 4, 4 }, { 4, 6, 2 } }, DBJ_WCWIDTH_PROFILE_CJK);
+}
+
+/*
+whole text if it fits, else the longest prefix that fits with the
+ellipsis, zero width chars after it included, then the ellipsis and
+the spaces to the columns
+*/
+static std::u32string truncate_slowly(const std::u32string& text, int columns, const std::u32string& ellipsis, int profile)
+{
+    if (width_of(text, 0, text.size(), profile) <= columns)
+        return text;
+    int reserve = width_of(ellipsis, 0, ellipsis.size(), profile);
+    std::u32string mark = ellipsis;
+    if (reserve > columns)
+        reserve = 0, mark.clear();
+    const int limit = columns > reserve ? columns - reserve : 0;
+
+    size_t size = 0;
+    int used = 0;
+    while (size < text.size() && used + width_of(text[size], profile) <= limit)
+        used += width_of(text[size++], profile);
+    std::u32string result = text.substr(0, size) + mark;
+    result.append(size_t(columns - used - reserve), U' ');
+    return result;
+}
+
+static void truncating(test::random& rng)
+{
+    static const std::u32string ellipses[] = { U"…", U"...", U"", U"中中中" };
+
+    for (int round = 0; round < 20000 && !test::failures; ++round) {
+        std::u32string text = random_text(rng);
+        text.resize(rng.below(uint32_t(text.size() + 1)));
+        const int columns = int(rng.below(30));
+        const int profile = profiles[rng.below(2)];
+        const std::u32string& ellipsis = ellipses[rng.below(4)];
+
+        const std::u32string expected = truncate_slowly(text, columns, ellipsis, profile);
+        if (expected.size() != text.size() || expected != text)
+            DBJ_CHECK(width_of(expected, 0, expected.size(), profile) == columns);
+
+        std::vector<char32_t> dst(expected.size() + 8, U'#');
+        size_t written = truncate_columns(text.data(), text.size(), columns, dst.data(), dst.size(),
+            ellipsis.data(), ellipsis.size(), profile);
+        if (!DBJ_CHECK(written == expected.size() && std::u32string(dst.data()) == expected))
+            break;
+
+        // the same in utf8, default ellipsis
+        if (ellipsis == ellipses[0]) {
+            std::string utf8, expected8;
+            for (char32_t cp : text)
+                encode(cp, utf8);
+            for (char32_t cp : expected)
+                encode(cp, expected8);
+            std::vector<char> dst8(expected8.size() + 8, '#');
+            written = truncate_columns(utf8.data(), utf8.size(), columns, dst8.data(), dst8.size(), profile);
+            DBJ_CHECK(written == expected8.size() && std::string(dst8.data()) == expected8);
+
+            // as snprintf: what does not fit is dropped, zero terminated, the size of the whole
+            const size_t capacity = rng.below(uint32_t(expected8.size() + 2));
+            std::vector<char> small(capacity + 1, '#');
+            written = truncate_columns(utf8.data(), utf8.size(), columns, small.data(), capacity, profile);
+            DBJ_CHECK(written == expected8.size() && small[capacity] == '#');
+            if (capacity)
+                DBJ_CHECK(0 == expected8.compare(0, capacity - 1, small.data()) && small[std::min(capacity - 1, expected8.size())] == 0);
+        }
+    }
+
+    // the documented example
+    char cell[64];
+    const char name[] = "Very long name indeed";
+    DBJ_CHECK(truncate_columns(name, sizeof(name) - 1, 12, cell, sizeof(cell)) == 14);
+    DBJ_CHECK(0 == strcmp(cell, "Very long n\xE2\x80\xA6"));
+    // half of the wide char that did not fit is a space
+    DBJ_CHECK(truncate_columns("\xE4\xB8\xAD\xE4\xB8\xAD\xE4\xB8\xAD", 9, 4, cell, sizeof(cell)) == 7);
+    DBJ_CHECK(0 == strcmp(cell, "\xE4\xB8\xAD\xE2\x80\xA6 "));
+    // narrower text as it is, ellipsis wider than the columns dropped
+    DBJ_CHECK(truncate_columns("ab", 2, 12, cell, sizeof(cell)) == 2 && 0 == strcmp(cell, "ab"));
+    DBJ_CHECK(truncate_columns("abc", 3, 0, cell, sizeof(cell)) == 0 && cell[0] == 0);
+    DBJ_CHECK(truncate_columns("abc", 3, 2, cell, sizeof(cell), "...", 3) == 2 && 0 == strcmp(cell, "ab"));
+    DBJ_CHECK(truncate_columns("abc", 3, 2, cell, 0) == 4 && cell[0] == 'a');
+}
+
+int main()
+{
+    test::random rng;
+    lines();
+    against_model(rng);
+    truncating(rng);
+    return DBJ_TEST_RESULT;
+}
@@ -0,0 +1,290 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+utf_allocator use by the utf strings: every block from the allocator
+given, given back once and with its size; utf_arena and utf_pool blocks
+are aligned, do not overlap, and are reused after reset() or deallocate;
+std::bad_alloc when the allocator has no more memory
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_cpp.h"
+#include "../dbj_utf_builder.h"
+#include "../dbj_utf_compact.h"
+#include "../dbj_utf_index.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace dbj::utf;
+
+/*
+heap allocator remembering the live blocks and their sizes
+*/
+struct counting final {
+    std::map<void*, size_t> live;
+    size_t allocations = 0;
+    bool wrong = false;
+
+    static void* allocate_fn(void* context, size_t bytes)
+    {
+        counting& self = *static_cast<counting*>(context);
+        void* block = malloc(bytes);
+        self.live[block] = bytes;
+        ++self.allocations;
+        return block;
+    }
+
+    static void deallocate_fn(void* context, void* block, size_t bytes)
+    {
+        counting& self = *static_cast<counting*>(context);
+        const auto found = self.live.find(block);
+        if (found == self.live.end() || found->second != bytes)
+            self.wrong = true;
+        else
+            self.live.erase(found);
+        free(block);
+    }
+
+    const utf_allocator handle{ allocate_fn, deallocate_fn, this };
+};
+
+/*
+heap allocator giving the blocks left, nullptr after them
+*/
+struct failing final {
+    size_t left = 0;
+
+    static void* allocate_fn(void* context, size_t bytes)
+    {
+        failing& self = *static_cast<failing*>(context);
+        if (!self.left)
+            return nullptr;
+        --self.left;
+        return malloc(bytes);
+    }
+
+    static void deallocate_fn(void*, void* block, size_t) { free(block); }
+
+    const utf_allocator handle{ allocate_fn, deallocate_fn, this };
+};
+
+// long enough for the heap, with every utf8 length
+static const char text8[] = "h\xC3\xA9llo w\xC3\xB6rld \xE4\xB8\xAD \xF0\x9F\x98\x80, a string long enough "
+    "to go to the allocator and not into the inline buffer of any utf string class, "
+    "long enough for the utf8 one too";
+static const char16_t text16[] = u"h\u00E9llo w\u00F6rld \u4E2D \U0001F600, a string long enough "
+    u"to go to the allocator and not into the inline buffer of any utf string class, "
+    u"long enough for the utf8 one too";
+static const char32_t text32[] = U"h\u00E9llo w\u00F6rld \u4E2D \U0001F600, a string long enough "
+    U"to go to the allocator and not into the inline buffer of any utf string class, "
+    U"long enough for the utf8 one too";
+
+static const size_t bytes8 = sizeof(text8) - 1, units16 = sizeof(text16) / 2 - 1, length32 = sizeof(text32) / 4 - 1;
+
+static bool same(const utf8_string& s) { return s.bytes() == bytes8 && 0 == memcmp(s.get(), text8, sizeof(text8)); }
+static bool same(const utf16_string& s) { return s.units() == units16 && 0 == memcmp(s.get(), text16, sizeof(text16)); }
+static bool same(const utf32_string& s) { return s.length() == length32 && 0 == memcmp(s.get(), text32, sizeof(text32)); }
+
+static void strings()
+{
+    counting counter;
+    const utf_allocator* allocator = &counter.handle;
+    {
+        std::vector<utf32_string> all32;
+        std::vector<utf8_string> all8;
+        std::vector<utf16_string> all16;
+
+        all32.emplace_back(text8, bytes8, allocator);
+        all32.emplace_back(text16, units16, allocator);
+        all32.emplace_back(text32, length32, allocator);
+        all32.push_back(make_utf32_string(text8, bytes8, allocator));
+        all8.emplace_back(text8, bytes8, allocator);
+        all8.emplace_back(text16, units16, allocator);
+        all8.emplace_back(text32, length32, allocator);
+        all8.emplace_back(all32[0], allocator);
+        all8.push_back(make_utf8_string(text16, units16, allocator));
+        all16.emplace_back(text8, bytes8, allocator);
+        all16.emplace_back(text16, units16, allocator);
+        all16.emplace_back(text32, length32, allocator);
+        all16.emplace_back(all32[0], allocator);
+        all16.push_back(make_utf16_string(text32, length32, allocator));
+
+        const size_t made = all32.size() + all8.size() + all16.size();
+        DBJ_CHECK(counter.allocations == made && counter.live.size() == made);
+
+        for (const utf32_string& s : all32)
+            DBJ_CHECK(same(s) && s.allocator() == allocator);
+        for (const utf8_string& s : all8)
+            DBJ_CHECK(same(s) && s.allocator() == allocator);
+        for (const utf16_string& s : all16)
+            DBJ_CHECK(same(s) && s.allocator() == allocator);
+
+        // the copy uses the same allocator, the move takes the block
+        const utf32_string copy(all32[0]);
+        DBJ_CHECK(same(copy) && copy.allocator() == allocator && counter.allocations == made + 1);
+        utf8_string moved(std::move(all8[0]));
+        DBJ_CHECK(same(moved) && moved.allocator() == allocator && counter.allocations == made + 1);
+
+        // assigned from another allocator: own block back, the other one taken
+        utf32_string assigned(text32, length32, allocator);
+        assigned = utf32_string(text32, length32);
+        DBJ_CHECK(same(assigned) && assigned.allocator() == heap_allocator());
+        DBJ_CHECK(counter.live.size() == made + 1);
+
+        // copy assignment keeps its own allocator
+        utf32_string target(text32, length32);
+        target = all32[1];
+        DBJ_CHECK(same(target) && target.allocator() == heap_allocator() && counter.live.size() == made + 1);
+
+        // inline strings take nothing from the allocator
+        const size_t before = counter.allocations;
+        const utf32_string small32(U"ab", 2, allocator);
+        const utf8_string small8("ab", 2, allocator);
+        const utf16_string small16(u"ab", 2, allocator);
+        DBJ_CHECK(counter.allocations == before);
+    }
+    DBJ_CHECK(counter.live.empty() && !counter.wrong);
+}
+
+static bool aligned(const void* block) { return 0 == (reinterpret_cast<uintptr_t>(block) & 15); }
+
+static void arena()
+{
+    utf_arena arena;
+    test::random rng;
+    // the blocks given, each filled with its own byte
+    std::vector<std::pair<char*, size_t>> blocks;
+    for (int j = 0; j < 3000; ++j) {
+        const size_t size = j % 500 == 0 ? 100000 : 1 + rng.below(300);
+        char* block = static_cast<char*>(arena.allocate(size));
+        DBJ_CHECK(block && aligned(block));
+        memset(block, j & 0xFF, size);
+        blocks.emplace_back(block, size);
+    }
+    for (size_t j = 0; j < blocks.size(); ++j) {
+        const char* block = blocks[j].first;
+        bool kept = true;
+        for (size_t k = 0; k < blocks[j].second; ++k)
+            kept = kept && block[k] == char(j & 0xFF);
+        if (!DBJ_CHECK(kept))
+            break;
+    }
+
+    // after reset the chunk is reused from the start
+    arena.reset();
+    void* first = arena.allocate(16);
+    arena.reset();
+    DBJ_CHECK(arena.allocate(16) == first);
+
+    // strings in the arena, released all at once
+    for (int round = 0; round < 10; ++round) {
+        {
+            std::vector<utf32_string> names;
+            for (int j = 0; j < 100; ++j)
+                names.emplace_back(text8, bytes8, arena.allocator());
+            const utf8_string back(names.back(), arena.allocator());
+            DBJ_CHECK(same(names.front()) && same(back));
+        }
+        arena.reset();
+    }
+}
+
+static void pool()
+{
+    utf_pool pool;
+
+    // freed block is the next one of its size class
+    void* a = pool.allocate(100);
+    void* b = pool.allocate(128);
+    DBJ_CHECK(a && b && a != b && aligned(a) && aligned(b));
+    pool.deallocate(a, 100);
+    DBJ_CHECK(pool.allocate(120) == a);
+    DBJ_CHECK(pool.allocate(100) != a);
+    pool.deallocate(b, 128);
+    DBJ_CHECK(pool.allocate(65) == b);
+
+    // every class, and above max_block
+    for (size_t size = 1; size <= utf_pool::max_block * 2; size += 37) {
+        char* block = static_cast<char*>(pool.allocate(size));
+        DBJ_CHECK(block != nullptr);
+        memset(block, 'p', size);
+        pool.deallocate(block, size);
+        DBJ_CHECK(size > utf_pool::max_block || pool.allocate(size) == block);
+    }
+
+    // strings created and destroyed, the same blocks all the time
+    const void* seen = nullptr;
+    for (int round = 0; round < 1000; ++round) {
+        utf16_string s(text8, bytes8, pool.allocator());
+        DBJ_CHECK(same(s));
+        if (round == 0)
+            seen = s.get();
+        else if (!DBJ_CHECK(s.get() == seen))
+            break;
+    }
+}
+
+template <typename Make>
+static bool throws_bad_alloc(Make make)
+{
+    try {
+        make();
+    }
+    catch (const std::bad_alloc&) {
+        return true;
+    }
+    return false;
+}
+
+// nullptr from the allocator is std::bad_alloc, nothing is written through it
+static void out_of_memory()
+{
+    failing none;
+    const utf_allocator* allocator = &none.handle;
+
+    DBJ_CHECK(throws_bad_alloc([&] { utf32_string s(text32, length32, allocator); }));
+    DBJ_CHECK(throws_bad_alloc([&] { utf32_string s(text8, bytes8, allocator); }));
+    DBJ_CHECK(throws_bad_alloc([&] { utf32_string s(text16, units16, allocator); }));
+    DBJ_CHECK(throws_bad_alloc([&] { utf8_string s(text8, bytes8, allocator); }));
+    DBJ_CHECK(throws_bad_alloc([&] { utf8_string s(utf32_string(text32, length32), allocator); }));
+    DBJ_CHECK(throws_bad_alloc([&] { utf16_string s(text32, length32, allocator); }));
+    DBJ_CHECK(throws_bad_alloc([&] { utf16_string s(utf32_string(text32, length32), allocator); }));
+    DBJ_CHECK(throws_bad_alloc([&] { compact_string s(text32, length32, allocator); }));
+    DBJ_CHECK(throws_bad_alloc([&] { compact_string s(text8, bytes8, allocator); }));
+    DBJ_CHECK(throws_bad_alloc([&] { compact_string(text32, length32).to_utf32(allocator); }));
+    DBJ_CHECK(throws_bad_alloc([&] { utf8_index index(text8, bytes8, 64, allocator); }));
+    DBJ_CHECK(throws_bad_alloc([&] {
+        utf8_builder builder(allocator);
+        builder.append(text8, bytes8);
+    }));
+
+    // inline strings need no allocator
+    DBJ_CHECK(!throws_bad_alloc([&] { utf32_string s(U"ab", 2, allocator); }));
+
+    // the full builder keeps what it has
+    none.left = 1;
+    utf8_builder builder(allocator);
+    builder.append(text8, bytes8);
+    DBJ_CHECK(throws_bad_alloc([&] {
+        for (int j = 0; j < 100; ++j)
+            builder.append(text8, bytes8);
+    }));
+    DBJ_CHECK(builder.size() % bytes8 == 0 && 0 == memcmp(builder.c_str(), text8, bytes8));
+
+    // copy assignment failed, the string is left as it was
+    none.left = 1;
+    utf32_string target(text32, length32, allocator);
+    const utf32_string other(text32 + 1, length32 - 1);
+    DBJ_CHECK(throws_bad_alloc([&] { target = other; }));
+    DBJ_CHECK(same(target) && target.allocator() == allocator);
+}
+
+int main()
+{
+    strings();
+    arena();
+    pool();
+    out_of_memory();
+    return DBJ_TEST_RESULT;
+}
@@ -0,0 +1,109 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+measure_utf8() against the slow way: decode to utf32, then dbj_wcswidth()
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_metrics.h"
+
+#include <string>
+#include <vector>
+
+using namespace dbj::utf;
+
+static utf8_metrics measure_slowly(const std::string& text)
+{
+    utf8_metrics metrics;
+    const char* walker = text.data();
+    const char* const end = walker + text.size();
+    std::u32string utf32;
+
+    while (walker < end && *walker) {
+        char32_t cp{};
+        const unsigned step = decode_utf8(walker, end, cp);
+        if (step == 1 && (unsigned char)*walker >= 0x80 && metrics.valid) {
+            metrics.valid = false;
+            metrics.error_offset = size_t(walker - text.data());
+        }
+        utf32 += cp;
+        walker += step;
+    }
+    metrics.bytes = size_t(walker - text.data());
+    if (metrics.valid)
+        metrics.error_offset = metrics.bytes;
+    metrics.code_points = utf32.size();
+    metrics.width = dbj_wcswidth(utf32.c_str(), utf32.size());
+    return metrics;
+}
+
+static bool same(const utf8_metrics& a, const utf8_metrics& b)
+{
+    return a.valid == b.valid && a.error_offset == b.error_offset && a.bytes == b.bytes
+        && a.code_points == b.code_points && a.width == b.width;
+}
+
+int main()
+{
+    {
+        const utf8_metrics m = measure_utf8("abc", 3);
+        DBJ_CHECK(m.valid && m.bytes == 3 && m.code_points == 3 && m.width == 3 && m.error_offset == 3);
+    }
+    {
+        // 中 is 2 columns, é is 1, combining acute is 0
+        const char text[] = "\xE4\xB8\xAD\xC3\xA9" "e\xCC\x81";
+        const utf8_metrics m = measure_utf8(text, sizeof(text) - 1);
+        DBJ_CHECK(m.valid && m.code_points == 4 && m.width == 4);
+    }
+    {
+        // control char makes the width -1, the rest is still measured
+        const utf8_metrics m = measure_utf8("a\tb", 3);
+        DBJ_CHECK(m.valid && m.code_points == 3 && m.width == -1);
+    }
+    {
+        // truncated sequence, then illegal byte
+        const char text[] = "ab\xE4\xB8" "c\xFF";
+        const utf8_metrics m = measure_utf8(text, sizeof(text) - 1);
+        DBJ_CHECK(!m.valid && m.error_offset == 2 && m.bytes == 6);
+    }
+    {
+        // text ends at the first NUL, as in dbj_wcswidth_utf8
+        const char text[] = "ab\xE4\xB8\xAD\0zz\xFF";
+        const utf8_metrics m = measure_utf8(text, sizeof(text) - 1);
+        DBJ_CHECK(m.valid && m.bytes == 5 && m.error_offset == 5 && m.code_points == 3 && m.width == 4);
+        DBJ_CHECK(m.width == dbj_wcswidth_utf8(text, sizeof(text) - 1));
+    }
+    {
+        // NUL after a long ASCII run
+        std::string text(40, 'x');
+        text += '\0';
+        text += "\xFF";
+        const utf8_metrics m = measure_utf8(text.data(), text.size());
+        DBJ_CHECK(m.valid && m.bytes == 40 && m.width == 40);
+    }
+    {
+        const utf8_metrics m = measure_utf8("", 0);
+        DBJ_CHECK(m.valid && m.bytes == 0 && m.code_points == 0 && m.width == 0);
+    }
+
+    // random mixes against the slow way
+    static const char* const pieces[] = {
+        "a", "hello world ", "\t", "\xC3\xA9", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80", "\xCC\x81",
+        "\xFF", "\xE4\xB8", "\x7F", "0123456789abcdefghij", "\xED\xA0\x80", "" /* NUL */,
+    };
+    const size_t piece_count = sizeof(pieces) / sizeof(pieces[0]);
+    test::random rng;
+    for (int round = 0; round < 100000; ++round) {
+        std::string text;
+        for (unsigned n = rng.below(12); n; --n) {
+            const uint32_t j = rng.below(piece_count);
+            text += j == piece_count - 1 ? std::string(1, '\0') : std::string(pieces[j]);
+        }
+        const utf8_metrics fast = measure_utf8(text.data(), text.size());
+        const utf8_metrics slow = measure_slowly(text);
+        if (!DBJ_CHECK(same(fast, slow)))
+            break;
+        DBJ_CHECK(fast.width == dbj_wcswidth_utf8(text.data(), text.size()));
+    }
+
+    return DBJ_TEST_RESULT;
+}
@@ -0,0 +1,137 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+    test_property [UCD folder]
+
+With the UCD folder every code point is compared with
+DerivedGeneralCategory.txt, Scripts.txt, PropList.txt (White_Space)
+and DerivedCoreProperties.txt (Alphabetic).
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_property.h"
+
+#include <vector>
+
+using namespace dbj::utf;
+
+static void spot_checks()
+{
+    DBJ_CHECK(category_of(U'A') == general_category::Lu);
+    DBJ_CHECK(category_of(U'ж') == general_category::Ll);
+    DBJ_CHECK(category_of(U'ǅ') == general_category::Lt);
+    DBJ_CHECK(category_of(U'中') == general_category::Lo);
+    DBJ_CHECK(category_of(0x0301) == general_category::Mn);
+    DBJ_CHECK(category_of(U'7') == general_category::Nd);
+    DBJ_CHECK(category_of(U'Ⅻ') == general_category::Nl);
+    DBJ_CHECK(category_of(U'½') == general_category::No);
+    DBJ_CHECK(category_of(U'€') == general_category::Sc);
+    DBJ_CHECK(category_of(U' ') == general_category::Zs);
+    DBJ_CHECK(category_of(0x2028) == general_category::Zl);
+    DBJ_CHECK(category_of(0x0A) == general_category::Cc);
+    DBJ_CHECK(category_of(0x00AD) == general_category::Cf);
+    DBJ_CHECK(category_of(0xD800) == general_category::Cs);
+    DBJ_CHECK(category_of(0xE000) == general_category::Co);
+    DBJ_CHECK(category_of(0x0378) == general_category::Cn);
+    DBJ_CHECK(category_of(0x10FFFF) == general_category::Cn);
+    DBJ_CHECK(category_of(0x110000) == general_category::Cn);
+
+    DBJ_CHECK(script_of(U'A') == script::Latin);
+    DBJ_CHECK(script_of(U'Ж') == script::Cyrillic);
+    DBJ_CHECK(script_of(U'中') == script::Han);
+    DBJ_CHECK(script_of(U'1') == script::Common);
+    DBJ_CHECK(script_of(0x0301) == script::Inherited);
+    DBJ_CHECK(script_of(0x0378) == script::Unknown);
+    DBJ_CHECK(0 == strcmp(script_name(script::Cyrillic), "Cyrillic"));
+    DBJ_CHECK(0 == strcmp(script_name(dbj::utf::script(255)), "Unknown"));
+
+    DBJ_CHECK(is_alphabetic(U'ß'));
+    DBJ_CHECK(is_alphabetic(U'Ⅻ'));
+    DBJ_CHECK(!is_alphabetic(U'1'));
+    DBJ_CHECK(is_numeric(U'½'));
+    DBJ_CHECK(!is_numeric(U'x'));
+    DBJ_CHECK(is_white_space(0x3000));
+    DBJ_CHECK(is_white_space(0x85));
+    DBJ_CHECK(!is_white_space(0x200B));
+
+    DBJ_CHECK(properties(U'.').is_punctuation());
+    DBJ_CHECK(properties(U'+').is_symbol());
+    DBJ_CHECK(properties(0x0301).is_mark());
+    DBJ_CHECK(properties(U' ').is_separator());
+    DBJ_CHECK(properties(0x7F).is_control());
+
+    const char32_t text[] = U"Aж1 ";
+    general_category categories[4]{};
+    dbj::utf::script scripts[4]{};
+    property_record records[4]{};
+    classify(text, 4, categories);
+    classify(text, 4, scripts);
+    classify(text, 4, records);
+    for (unsigned j = 0; j < 4; ++j) {
+        DBJ_CHECK(categories[j] == category_of(text[j]));
+        DBJ_CHECK(scripts[j] == script_of(text[j]));
+        DBJ_CHECK(records[j].bits() == properties(text[j]).bits());
+    }
+}
+
+static void against_ucd(const char* ucd)
+{
+    static const char* const category_names[] = {
+        "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl",
+        "No", "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po", "Sm", "Sc",
+        "Sk", "So", "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co", "Cn",
+    };
+
+    std::vector<int> category(0x110000, int(general_category::Cn));
+    std::vector<int> scripts(0x110000, int(script::Unknown));
+    std::vector<bool> alphabetic(0x110000), white_space(0x110000);
+
+    DBJ_CHECK(test::read_ucd(ucd, "DerivedGeneralCategory.txt", [&](char32_t first, char32_t last, const char* value) {
+        int found = -1;
+        for (int j = 0; j < 30; ++j)
+            if (0 == strcmp(category_names[j], value))
+                found = j;
+        DBJ_CHECK(found >= 0);
+        for (char32_t cp = first; cp <= last; ++cp)
+            category[cp] = found;
+    }));
+
+    DBJ_CHECK(test::read_ucd(ucd, "Scripts.txt", [&](char32_t first, char32_t last, const char* value) {
+        int found = -1;
+        for (unsigned j = 0; j < script_count; ++j)
+            if (0 == strcmp(script_name(dbj::utf::script(j)), value))
+                found = int(j);
+        DBJ_CHECK(found >= 0);
+        for (char32_t cp = first; cp <= last; ++cp)
+            scripts[cp] = found;
+    }));
+
+    DBJ_CHECK(test::read_ucd(ucd, "PropList.txt", [&](char32_t first, char32_t last, const char* value) {
+        if (0 == strcmp(value, "White_Space"))
+            for (char32_t cp = first; cp <= last; ++cp)
+                white_space[cp] = true;
+    }));
+
+    DBJ_CHECK(test::read_ucd(ucd, "DerivedCoreProperties.txt", [&](char32_t first, char32_t last, const char* value) {
+        if (0 == strcmp(value, "Alphabetic"))
+            for (char32_t cp = first; cp <= last; ++cp)
+                alphabetic[cp] = true;
+    }));
+
+    for (char32_t cp = 0; cp < 0x110000; ++cp) {
+        const property_record p = properties(cp);
+        if (!DBJ_CHECK(int(p.category()) == category[cp]
+            && int(p.script()) == scripts[cp]
+            && p.is_alphabetic() == alphabetic[cp]
+            && p.is_white_space() == white_space[cp]))
+            fprintf(stderr, "    at U+%04X\n", unsigned(cp));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    static_assert(sizeof(property_record) == 2);
+    spot_checks();
+    if (argc > 1)
+        against_ucd(argv[1]);
+    return DBJ_TEST_RESULT;
+}
@@ -0,0 +1,266 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+utf8_rope against std::u32string doing the same edits; chunk sizes and
+the memory after many small edits; rope unchanged when an edit throws.
+Global operator new is replaced to count the bytes and to fail on demand.
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_rope.h"
+
+#include <new>
+#include <string>
+
+namespace {
+    size_t live_bytes = 0;
+    // operator new throws after this many more allocations, if not negative
+    long fail_after = -1;
+}
+
+void* operator new(size_t size)
+{
+    if (fail_after == 0) {
+        fail_after = -1;
+        throw std::bad_alloc();
+    }
+    if (fail_after > 0)
+        --fail_after;
+    size_t* block = static_cast<size_t*>(malloc(size + 16));
+    if (!block)
+        throw std::bad_alloc();
+    *block = size;
+    live_bytes += size;
+    return reinterpret_cast<char*>(block) + 16;
+}
+
+void operator delete(void* p) noexcept
+{
+    if (!p)
+        return;
+    size_t* block = reinterpret_cast<size_t*>(static_cast<char*>(p) - 16);
+    live_bytes -= *block;
+    free(block);
+}
+
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+
+using namespace dbj::utf;
+
+static std::string to_utf8(const std::u32string& text)
+{
+    std::string result(text.size() * 4 + 1, '\0');
+    size_t written = 0;
+    transcode(text.data(), text.size(), encoding::utf32, &result[0], result.size(), encoding::utf8, written);
+    result.resize(written);
+    return result;
+}
+
+static std::string content(const utf8_rope& rope)
+{
+    std::string result;
+    rope.visit(0, rope.length(), [&](const char* text, size_t size) { result.append(text, size); });
+    return result;
+}
+
+/*
+chunks are not empty, not above the capacity, never start inside the
+utf8 sequence, and no two neighbours are both less than half full
+*/
+static bool chunks_ok(const utf8_rope& rope)
+{
+    bool ok = true, previous_small = false;
+    rope.visit(0, rope.length(), [&](const char* text, size_t size) {
+        const bool small = size < utf8_rope::chunk_capacity / 2;
+        ok = ok && size > 0 && size <= utf8_rope::chunk_capacity
+            && ((unsigned char)text[0] & 0xC0) != 0x80 && !(small && previous_small);
+        previous_small = small;
+    });
+    return ok;
+}
+
+// the same random edits on the rope and on the model
+static void against_model(test::random& rng)
+{
+    static const char32_t pool[] = { U'a', U'\n', U'é', U'中', U'\U0001F600', U'z', U' ' };
+
+    for (int round = 0; round < 10 && !test::failures; ++round) {
+        utf8_rope rope;
+        std::u32string model;
+
+        for (int op = 0; op < 2000 && !test::failures; ++op) {
+            const uint32_t kind = rng.below(10);
+            if (kind < 5) {
+                std::u32string text;
+                for (size_t n = rng.below(rng.below(10) ? 20 : 3000); n; --n)
+                    text += pool[rng.below(7)];
+                const size_t pos = rng.below(uint32_t(model.size() + 2));
+                const std::string text8 = to_utf8(text);
+                rope.insert(pos, text8.data(), text8.size());
+                model.insert(pos < model.size() ? pos : model.size(), text);
+            }
+            else if (kind < 8 && !model.empty()) {
+                const size_t pos = rng.below(uint32_t(model.size()));
+                const size_t count = rng.below(rng.below(10) ? 50 : 5000);
+                rope.erase(pos, count);
+                model.erase(pos, count);
+            }
+            else if (kind == 8) {
+                const size_t pos = rng.below(uint32_t(model.size() + 1));
+                utf8_rope tail = rope.split_off(pos);
+                DBJ_CHECK(rope.length() == pos && tail.length() == model.size() - pos);
+                DBJ_CHECK(chunks_ok(rope) && chunks_ok(tail));
+                rope.append(std::move(tail));
+                DBJ_CHECK(tail.length() == 0);
+            }
+            else if (!model.empty()) {
+                const size_t pos = rng.below(uint32_t(model.size()));
+                DBJ_CHECK(rope.at(pos) == model[pos]);
+                DBJ_CHECK(rope.byte_offset(pos) == to_utf8(model.substr(0, pos)).size());
+                size_t line = 0;
+                for (size_t j = 0; j < pos; ++j)
+                    line += model[j] == '\n';
+                DBJ_CHECK(rope.line_of(pos) == line);
+                const size_t start = rope.line_start(line);
+                DBJ_CHECK(start <= pos && (start == 0 || model[start - 1] == '\n'));
+                DBJ_CHECK(model.find(U'\n', start) >= pos);
+            }
+            DBJ_CHECK(rope.length() == model.size());
+        }
+
+        const std::string text8 = to_utf8(model);
+        DBJ_CHECK(rope.bytes() == text8.size() && content(rope) == text8);
+        DBJ_CHECK(chunks_ok(rope));
+        DBJ_CHECK(rope.at(model.size()) == 0 && rope.byte_offset(model.size()) == text8.size());
+
+        size_t lines = 1;
+        for (char32_t cp : model)
+            lines += cp == '\n';
+        DBJ_CHECK(rope.line_count() == lines && rope.line_start(lines) == model.size());
+
+        std::u32string utf32(model.size() + 1, U'\0');
+        size_t written = 0;
+        DBJ_CHECK(rope.export_length(0, model.size(), encoding::utf32) == model.size());
+        DBJ_CHECK(conversionOK == rope.export_range(0, model.size(), &utf32[0], utf32.size(), encoding::utf32, written));
+        DBJ_CHECK(written == model.size() && utf32.compare(0, written, model) == 0 && utf32[written] == 0);
+
+        const size_t utf16_units = rope.export_length(0, model.size(), encoding::utf16);
+        std::u16string utf16(utf16_units + 1, u'\0');
+        DBJ_CHECK(conversionOK == rope.export_range(0, model.size(), &utf16[0], utf16.size(), encoding::utf16, written));
+        DBJ_CHECK(written == utf16_units);
+
+        const size_t from = model.size() / 3, count = model.size() / 3;
+        const utf8_rope part = rope.copy(from, count);
+        DBJ_CHECK(content(part) == to_utf8(model.substr(from, count)));
+    }
+}
+
+// memory stays close to the text, however many edits
+static void memory()
+{
+    std::string text;
+    for (int j = 0; j < 1000000; ++j)
+        text += j % 61 == 60 ? '\n' : char('a' + j % 26);
+
+    test::random rng(5);
+    const size_t before = live_bytes;
+    {
+        utf8_rope rope(text.data(), text.size());
+        const size_t loaded = live_bytes - before;
+        DBJ_CHECK(loaded < text.size() * 11 / 10);
+
+        std::string model = text;
+        for (int edit = 0; edit < 20000; ++edit) {
+            const size_t pos = rng.below(uint32_t(model.size() + 1));
+            if (rng.below(2)) {
+                rope.insert(pos, "x", 1);
+                model.insert(pos, 1, 'x');
+            }
+            else if (pos < model.size()) {
+                rope.erase(pos, 1);
+                model.erase(pos, 1);
+            }
+        }
+        // the rope alone, model is a std::string block of capacity + 1
+        const size_t edited = live_bytes - before - (model.capacity() + 1);
+        DBJ_CHECK(content(rope) == model);
+        DBJ_CHECK(chunks_ok(rope));
+        if (!DBJ_CHECK(edited < model.size() * 12 / 10))
+            fprintf(stderr, "    %zu bytes of the rope for %zu bytes of text\n", edited, model.size());
+    }
+    DBJ_CHECK(live_bytes == before);
+}
+
+// the edit with one of its first allocations failing, true if it threw
+template <typename F>
+static bool fails(test::random& rng, F edit)
+{
+    fail_after = long(rng.below(6));
+    try {
+        edit();
+        fail_after = -1;
+        return false;
+    }
+    catch (const std::bad_alloc&) {
+        fail_after = -1;
+        return true;
+    }
+}
+
+// allocations of the edits fail now and then, the ropes stay as they were
+static void exception_safety(test::random& rng)
+{
+    const std::string big(5000, 'q');
+    utf8_rope rope("seed text \xC3\xA9\n");
+    int thrown = 0;
+
+    for (int round = 0; round < 3000 && !test::failures; ++round) {
+        const std::string before = content(rope);
+        const size_t length = rope.length();
+        const size_t pos = rng.below(uint32_t(length + 1));
+        const uint32_t kind = rng.below(3);
+
+        if (kind == 0) {
+            const bool threw = fails(rng, [&] {
+                if (round % 7)
+                    rope.insert(pos, "abc\xC3\xA9");
+                else
+                    rope.insert(pos, big.data(), big.size());
+            });
+            thrown += threw;
+            DBJ_CHECK(!threw || (content(rope) == before && rope.length() == length));
+        }
+        else if (kind == 1) {
+            const size_t count = 1 + rng.below(round % 5 ? 3 : 3000);
+            const bool threw = fails(rng, [&] { rope.erase(pos, count); });
+            thrown += threw;
+            DBJ_CHECK(!threw || (content(rope) == before && rope.length() == length));
+        }
+        else {
+            utf8_rope tail;
+            if (fails(rng, [&] { tail = rope.split_off(pos); })) {
+                ++thrown;
+                DBJ_CHECK(content(rope) == before && rope.length() == length);
+            }
+            else if (fails(rng, [&] { rope.append(std::move(tail)); })) {
+                ++thrown;
+                DBJ_CHECK(content(rope) + content(tail) == before && tail.length() == length - pos);
+                rope.append(std::move(tail));
+            }
+            DBJ_CHECK(tail.length() == 0 && content(rope) == before);
+        }
+        DBJ_CHECK(chunks_ok(rope));
+        // the rope stays small
+        if (rope.length() > 20000)
+            rope.erase(0, 10000);
+    }
+    DBJ_CHECK(thrown > 0);
+}
+
+int main()
+{
+    test::random rng;
+    against_model(rng);
+    memory();
+    exception_safety(rng);
+    return DBJ_TEST_RESULT;
+}
@@ -0,0 +1,309 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+dbj_utf_simd.h kernels against the plain loops, at every alignment and
+at the sizes around the 16 byte blocks; on POSIX also the utf32 strings
+ending at a page that can not be read. Build it once more with
+-DDBJ_UTF_NO_SIMD to test the scalar fallbacks.
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_simd.h"
+
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define DBJ_UTF_TEST_GUARD_PAGE
+#endif
+
+using namespace dbj::utf;
+
+namespace reference {
+
+    inline size_t ascii_prefix(const char* src, size_t size)
+    {
+        size_t j = 0;
+        while (j < size && (unsigned char)src[j] < 0x80)
+            ++j;
+        return j;
+    }
+
+    inline size_t printable_ascii_prefix(const char* src, size_t size)
+    {
+        size_t j = 0;
+        while (j < size && (unsigned char)src[j] >= 0x20 && (unsigned char)src[j] < 0x7F)
+            ++j;
+        return j;
+    }
+
+    inline size_t count_code_points(const char* src, size_t size)
+    {
+        size_t count = 0;
+        for (size_t j = 0; j < size; ++j)
+            count += ((unsigned char)src[j] & 0xC0) != 0x80;
+        return count;
+    }
+
+    inline size_t skip_code_points(const char* src, size_t size, size_t n)
+    {
+        for (size_t j = 0; j < size; ++j)
+            if (((unsigned char)src[j] & 0xC0) != 0x80 && n-- == 0)
+                return j;
+        return size;
+    }
+
+    inline size_t strnlen_32(const char32_t* src, size_t max)
+    {
+        size_t j = 0;
+        while (j < max && src[j])
+            ++j;
+        return j;
+    }
+
+    inline size_t find_32(const char32_t* src, size_t count, char32_t cp)
+    {
+        for (size_t j = 0; j < count; ++j)
+            if (src[j] == cp)
+                return j;
+        return count;
+    }
+
+    inline size_t rfind_32(const char32_t* src, size_t count, char32_t cp)
+    {
+        for (size_t j = count; j-- > 0;)
+            if (src[j] == cp)
+                return j;
+        return count;
+    }
+
+    inline size_t mismatch_32(const char32_t* left, const char32_t* right, size_t count)
+    {
+        size_t j = 0;
+        while (j < count && left[j] == right[j])
+            ++j;
+        return j;
+    }
+
+    inline bool match_32(const char32_t* src, const char32_t* needle, size_t needle_count)
+    {
+        return mismatch_32(src, needle, needle_count) == needle_count;
+    }
+
+    inline size_t find_32(const char32_t* src, size_t count, const char32_t* needle, size_t needle_count)
+    {
+        for (size_t j = 0; j + needle_count <= count; ++j)
+            if (match_32(src + j, needle, needle_count))
+                return j;
+        return needle_count ? count : 0;
+    }
+
+    inline size_t rfind_32(const char32_t* src, size_t count, const char32_t* needle, size_t needle_count)
+    {
+        if (needle_count > count)
+            return count;
+        for (size_t j = count - needle_count + 1; j-- > 0;)
+            if (match_32(src + j, needle, needle_count))
+                return j;
+        return count;
+    }
+
+    inline size_t stop_32(const char32_t* left, const char32_t* right, size_t count)
+    {
+        size_t j = 0;
+        while (j < count && left[j] && left[j] == right[j])
+            ++j;
+        return j;
+    }
+
+    template <typename C>
+    inline uint32_t or_all(const C* src, size_t count)
+    {
+        uint32_t bits = 0;
+        for (size_t j = 0; j < count; ++j)
+            bits |= src[j];
+        return bits;
+    }
+
+} // reference
+
+static void bits()
+{
+    for (unsigned j = 0; j < 32; ++j) {
+        DBJ_CHECK(simd::lowest_bit(1u << j) == j);
+        DBJ_CHECK(simd::highest_bit(1u << j) == j);
+        DBJ_CHECK(simd::lowest_bit(0x80000000u | (1u << j)) == j);
+        DBJ_CHECK(simd::highest_bit(1u | (1u << j)) == j);
+    }
+    DBJ_CHECK(simd::popcount(0) == 0);
+    DBJ_CHECK(simd::popcount(0xFFFFFFFFu) == 32);
+    DBJ_CHECK(simd::popcount(0x80000001u) == 2);
+}
+
+// bytes mostly printable ASCII, one odd byte now and then
+static void utf8_kernels(test::random& rng)
+{
+    static const unsigned char odd[] = { 0x00, 0x09, 0x1F, 0x7F, 0x80, 0xBF, 0xC3, 0xE4, 0xF0, 0xFF };
+    std::vector<char> buffer(256);
+
+    for (int round = 0; round < 2000; ++round) {
+        const uint32_t density = 1 + rng.below(64);
+        for (char& c : buffer)
+            c = rng.below(density) ? char(0x20 + rng.below(0x5F)) : char(odd[rng.below(sizeof(odd))]);
+
+        for (size_t offset = 0; offset < 16; ++offset) {
+            for (size_t size = 0; size <= 70; ++size) {
+                const char* src = buffer.data() + offset;
+                DBJ_CHECK(simd::ascii_prefix(src, size) == reference::ascii_prefix(src, size));
+                DBJ_CHECK(simd::printable_ascii_prefix(src, size) == reference::printable_ascii_prefix(src, size));
+                const size_t count = reference::count_code_points(src, size);
+                DBJ_CHECK(simd::count_code_points(src, size) == count);
+                for (size_t n = 0; n <= count + 1; n += 1 + n / 4)
+                    DBJ_CHECK(simd::skip_code_points(src, size, n) == reference::skip_code_points(src, size, n));
+            }
+        }
+        if (test::failures)
+            break;
+    }
+}
+
+// units from a small alphabet, so that the needles are found, zeros now and then
+static void utf32_kernels(test::random& rng)
+{
+    static const char32_t alphabet[] = { U'a', U'b', U'c', 0x00E9, 0x4E2D, 0x1F600, 0x10FFFF, 0xFFFFFFFF };
+    // zero terminated
+    std::vector<char32_t> buffer(128), other(128);
+    std::vector<char16_t> buffer16(128);
+
+    for (int round = 0; round < 1000; ++round) {
+        const uint32_t letters = 2 + rng.below(7);
+        const uint32_t zeros = rng.below(4) ? 0 : 1 + rng.below(40);
+        for (size_t j = 0; j < buffer.size(); ++j) {
+            buffer[j] = zeros && !rng.below(zeros) ? 0 : alphabet[rng.below(letters)];
+            buffer16[j] = char16_t(buffer[j]);
+        }
+        buffer.back() = 0;
+        other = buffer;
+        other[rng.below(128)] = U'z';
+
+        for (size_t offset = 0; offset < 4; ++offset) {
+            const char32_t* src = buffer.data() + offset;
+            for (size_t size = 0; size <= 60; ++size) {
+                DBJ_CHECK(simd::strnlen_32(src, size) == reference::strnlen_32(src, size));
+                DBJ_CHECK(simd::or_32(src, size) == reference::or_all(src, size));
+                DBJ_CHECK(simd::or_16(buffer16.data() + offset, size) == reference::or_all(buffer16.data() + offset, size));
+
+                const char32_t cp = alphabet[rng.below(letters)];
+                DBJ_CHECK(simd::find_32(src, size, cp) == reference::find_32(src, size, cp));
+                DBJ_CHECK(simd::rfind_32(src, size, cp) == reference::rfind_32(src, size, cp));
+
+                const char32_t* right = other.data() + offset + rng.below(2);
+                DBJ_CHECK(simd::mismatch_32(src, right, size) == reference::mismatch_32(src, right, size));
+                DBJ_CHECK(simd::stop_32(src, right, size) == reference::stop_32(src, right, size));
+
+                // needle out of the text itself or random
+                const size_t needle_count = rng.below(7);
+                const char32_t* needle = buffer.data() + rng.below(uint32_t(buffer.size() - needle_count));
+                DBJ_CHECK(simd::find_32(src, size, needle, needle_count) == reference::find_32(src, size, needle, needle_count));
+                DBJ_CHECK(simd::rfind_32(src, size, needle, needle_count) == reference::rfind_32(src, size, needle, needle_count));
+            }
+            // the length found through the aligned blocks
+            DBJ_CHECK(simd::strlen_32(src) == reference::strnlen_32(src, SIZE_MAX));
+        }
+        if (test::failures)
+            break;
+    }
+}
+
+// values that fit, narrowed and widened back, nothing written past count
+static void narrow_widen(test::random& rng)
+{
+    std::vector<char32_t> wide(80), back(80);
+    std::vector<char16_t> wide16(80);
+    std::vector<uint8_t> narrow8(80);
+    std::vector<uint16_t> narrow16(80);
+
+    for (int round = 0; round < 2000 && !test::failures; ++round) {
+        for (size_t j = 0; j < wide.size(); ++j) {
+            wide[j] = rng.below(round % 2 ? 0x100 : 0x10000);
+            wide16[j] = char16_t(wide[j] & 0xFF);
+        }
+        const size_t offset = rng.below(4);
+        const size_t count = rng.below(uint32_t(wide.size() - offset - 1));
+        const char32_t* src = wide.data() + offset;
+
+        if (round % 2) {
+            narrow8.assign(narrow8.size(), 0xAA);
+            simd::narrow_32_to_8(narrow8.data(), src, count);
+            bool ok = narrow8[count] == 0xAA;
+            for (size_t j = 0; j < count; ++j)
+                ok = ok && narrow8[j] == src[j];
+            back.assign(back.size(), U'#');
+            simd::widen_8_to_32(back.data(), narrow8.data(), count);
+            ok = ok && back[count] == U'#' && 0 == memcmp(back.data(), src, count * sizeof(char32_t));
+            DBJ_CHECK(ok);
+
+            narrow8.assign(narrow8.size(), 0xAA);
+            simd::narrow_16_to_8(narrow8.data(), wide16.data() + offset, count);
+            ok = narrow8[count] == 0xAA;
+            for (size_t j = 0; j < count; ++j)
+                ok = ok && narrow8[j] == wide16[offset + j];
+            DBJ_CHECK(ok);
+        }
+        else {
+            narrow16.assign(narrow16.size(), 0xAAAA);
+            simd::narrow_32_to_16(narrow16.data(), src, count);
+            bool ok = narrow16[count] == 0xAAAA;
+            for (size_t j = 0; j < count; ++j)
+                ok = ok && narrow16[j] == src[j];
+            back.assign(back.size(), U'#');
+            simd::widen_16_to_32(back.data(), narrow16.data(), count);
+            ok = ok && back[count] == U'#' && 0 == memcmp(back.data(), src, count * sizeof(char32_t));
+            DBJ_CHECK(ok);
+        }
+    }
+}
+
+#ifdef DBJ_UTF_TEST_GUARD_PAGE
+/*
+strings ending right before the page that can not be read:
+the kernels reading ahead must not touch it
+*/
+static void guard_page()
+{
+    const size_t page = size_t(sysconf(_SC_PAGESIZE));
+    char* pages = static_cast<char*>(mmap(nullptr, 2 * page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (!DBJ_CHECK(pages != MAP_FAILED))
+        return;
+    mprotect(pages + page, page, PROT_NONE);
+
+    char32_t* end = reinterpret_cast<char32_t*>(pages + page);
+    for (size_t size = 1; size <= 9; ++size) {
+        char32_t* src = end - size;
+        for (size_t j = 0; j < size; ++j)
+            src[j] = U'a' + char32_t(j);
+        src[size - 1] = 0;
+        DBJ_CHECK(simd::strlen_32(src) == size - 1);
+        DBJ_CHECK(simd::strnlen_32(src, SIZE_MAX) == size - 1);
+
+        // equal up to the end of the page, the terminator stops
+        std::vector<char32_t> copy(src, src + size);
+        DBJ_CHECK(simd::stop_32(src, copy.data(), SIZE_MAX) == size - 1);
+        DBJ_CHECK(simd::stop_32(copy.data(), src, SIZE_MAX) == size - 1);
+    }
+    munmap(pages, 2 * page);
+}
+#endif
+
+int main()
+{
+    test::random rng;
+    bits();
+    utf8_kernels(rng);
+    utf32_kernels(rng);
+    narrow_widen(rng);
+#ifdef DBJ_UTF_TEST_GUARD_PAGE
+    guard_page();
+#endif
+    return DBJ_TEST_RESULT;
+}
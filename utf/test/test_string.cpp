@@ -0,0 +1,365 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+utf8_string, utf16_string and utf32_string from dbj_utf_cpp.h
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_cpp.h"
+
+#include <string>
+#include <vector>
+
+using namespace dbj::utf;
+
+// ASCII, controls, Latin, combining marks, CJK, astral
+static const char32_t code_point_pool[] = {
+    U'a', U'Z', U' ', U'7', 0x09, 0x7F, 0x85, U'é', U'Ж', 0x0301, 0x20DD,
+    U'中', 0xFFFD, U'\U0001F600', U'\U00010348', 0x1D165,
+};
+
+static std::u32string random_text(test::random& rng, size_t max_length)
+{
+    std::u32string text;
+    const uint32_t pool_size = 1 + rng.below(sizeof(code_point_pool) / sizeof(code_point_pool[0]));
+    for (size_t n = rng.below(uint32_t(max_length + 1)); n; --n)
+        text += code_point_pool[rng.below(pool_size)];
+    return text;
+}
+
+static std::string to_utf8(const std::u32string& text)
+{
+    std::string result(text.size() * 4 + 1, '\0');
+    size_t written = 0;
+    transcode(text.data(), text.size(), encoding::utf32, &result[0], result.size(), encoding::utf8, written);
+    result.resize(written);
+    return result;
+}
+
+static std::u16string to_utf16(const std::u32string& text)
+{
+    std::u16string result(text.size() * 2 + 1, u'\0');
+    size_t written = 0;
+    transcode(text.data(), text.size(), encoding::utf32, &result[0], result.size(), encoding::utf16, written);
+    result.resize(written);
+    return result;
+}
+
+// the flags, by the definition
+static uint8_t expected_flags(const std::u32string& text)
+{
+    uint8_t flags = text_flags::known | text_flags::ascii | text_flags::bmp;
+    for (char32_t cp : text) {
+        if (cp >= 0x80)
+            flags &= uint8_t(~text_flags::ascii);
+        if (cp > 0xFFFF)
+            flags &= uint8_t(~text_flags::bmp);
+        if (properties(cp).is_mark())
+            flags |= text_flags::combining;
+        if (cp < 0x20 || (cp >= 0x7F && cp < 0xA0))
+            flags |= text_flags::control;
+    }
+    return flags;
+}
+
+// flags, length, at() and width() of the three, made from every encoding
+static void flags(test::random& rng)
+{
+    for (int round = 0; round < 3000 && !test::failures; ++round) {
+        const std::u32string text = random_text(rng, 200);
+        const std::string text8 = to_utf8(text);
+        const std::u16string text16 = to_utf16(text);
+        const uint8_t expected = expected_flags(text);
+
+        const utf32_string s32(text.data(), text.size());
+        const utf32_string s32_from8(text8.data(), text8.size());
+        const utf32_string s32_from16(text16.data(), text16.size());
+        for (const utf32_string* s : { &s32, &s32_from8, &s32_from16 }) {
+            DBJ_CHECK(s->flags() == expected);
+            DBJ_CHECK(s->length() == text.size() && 0 == memcmp(s->get(), text.data(), text.size() * 4));
+            DBJ_CHECK(s->width() == dbj_wcswidth(text.c_str(), text.size()));
+        }
+
+        const utf8_string s8(s32);
+        const utf8_string s8_from8(text8.data(), text8.size());
+        const utf8_string s8_from16(text16.data(), text16.size());
+        for (const utf8_string* s : { &s8, &s8_from8, &s8_from16 }) {
+            DBJ_CHECK(s->flags() == expected && s->length() == text.size());
+            DBJ_CHECK(s->bytes() == text8.size() && 0 == memcmp(s->get(), text8.c_str(), text8.size() + 1));
+        }
+
+        const utf16_string s16(s32);
+        const utf16_string s16_from8(text8.data(), text8.size());
+        const utf16_string s16_from32(text.data(), text.size());
+        for (const utf16_string* s : { &s16, &s16_from8, &s16_from32 }) {
+            DBJ_CHECK(s->flags() == expected && s->length() == text.size());
+            DBJ_CHECK(s->units() == text16.size() && 0 == memcmp(s->get(), text16.c_str(), (text16.size() + 1) * 2));
+        }
+
+        for (size_t j = 0; j < text.size(); j += 1 + j / 8) {
+            DBJ_CHECK(s8.at(j) == text[j]);
+            DBJ_CHECK(s16.at(j) == text[j]);
+        }
+        DBJ_CHECK(s8.at(text.size()) == 0 && s16.at(text.size()) == 0);
+    }
+
+    // set() keeps the flags exact
+    for (int round = 0; round < 300 && !test::failures; ++round) {
+        std::u32string text = random_text(rng, 40);
+        if (text.empty())
+            continue;
+        utf32_string s(text.data(), text.size());
+        for (int edit = 0; edit < 100; ++edit) {
+            const size_t pos = rng.below(uint32_t(text.size()));
+            const char32_t cp = code_point_pool[rng.below(sizeof(code_point_pool) / sizeof(code_point_pool[0]))];
+            text[pos] = cp;
+            s.set(pos, cp);
+            DBJ_CHECK(s[pos] == cp);
+            if (!DBJ_CHECK(s.flags() == expected_flags(text)))
+                break;
+        }
+    }
+
+    {
+        // written through get(), refresh_flags() brings them up to date
+        utf32_string s(U"abc", 3);
+        s.get()[1] = U'中';
+        s.refresh_flags();
+        DBJ_CHECK(s.flags() == expected_flags(U"a中c"));
+        DBJ_CHECK(s.width() == 4);
+    }
+    {
+        // values above U+10FFFF are replaced, flags are of the result
+        const char32_t bad[] = { U'a', 0x110000, U'\U0001F600' };
+        const utf32_string s(bad, 3);
+        const utf8_string s8(s);
+        const utf16_string s16(s);
+        DBJ_CHECK(s8.get()[s8.bytes()] == 0 && s16.get()[s16.units()] == 0);
+        size_t code_points = 0;
+        DBJ_CHECK(s8.flags() == text_flags::scan_utf8(s8.get(), s8.bytes(), code_points) && code_points == s8.length());
+        DBJ_CHECK(s16.flags() == text_flags::scan_utf16(reinterpret_cast<const char16_t*>(s16.get()), s16.units(), code_points) && code_points == s16.length());
+    }
+    {
+        const utf32_string empty(U"", size_t(0));
+        DBJ_CHECK(empty.flags() == text_flags::of_empty() && empty.width() == 0);
+    }
+}
+
+template <typename S>
+static bool inside(const S& s, const void* data)
+{
+    const char* object = reinterpret_cast<const char*>(&s);
+    return (const char*)data >= object && (const char*)data < object + sizeof(S);
+}
+
+// up to the inline capacity the text is in the object itself
+static void small_strings()
+{
+    static_assert(sizeof(utf32_string) <= 128 && sizeof(utf8_string) <= 128 && sizeof(utf16_string) <= 128);
+
+    for (size_t length = 0; length < 2 * utf8_string::inline_capacity; ++length) {
+        std::u32string text;
+        for (size_t j = 0; j < length; ++j)
+            text += char32_t(U'a' + j % 26);
+        const std::string text8 = to_utf8(text);
+        const std::u16string text16 = to_utf16(text);
+
+        const utf32_string s32(text.data(), text.size());
+        DBJ_CHECK(s32.is_inline() == (length + 1 <= utf32_string::inline_capacity));
+        DBJ_CHECK(inside(s32, s32.get()) == s32.is_inline());
+        DBJ_CHECK(0 == memcmp(s32.get(), text.c_str(), (length + 1) * 4));
+
+        const utf8_string s8(text8.data(), text8.size());
+        DBJ_CHECK(inside(s8, s8.get()) == (length + 1 <= utf8_string::inline_capacity));
+        DBJ_CHECK(0 == memcmp(s8.get(), text8.c_str(), length + 1));
+
+        const utf16_string s16(text16.data(), text16.size());
+        DBJ_CHECK(inside(s16, s16.get()) == (length + 1 <= utf16_string::inline_capacity));
+        DBJ_CHECK(0 == memcmp(s16.get(), text16.c_str(), (length + 1) * 2));
+
+        // the copy is inline or not by its own length
+        const utf32_string copy(s32);
+        DBJ_CHECK(copy == s32 && copy.is_inline() == s32.is_inline());
+        utf32_string assigned(U"x", 1);
+        assigned = s32;
+        DBJ_CHECK(assigned == s32 && assigned.is_inline() == s32.is_inline());
+    }
+
+    // non ASCII text, inline by the units, not by the code points
+    const std::u32string cjk(utf8_string::inline_capacity / 3 - 1, U'中');
+    const std::string cjk8 = to_utf8(cjk);
+    const utf8_string s8(cjk8.data(), cjk8.size());
+    DBJ_CHECK(inside(s8, s8.get()) && s8.length() == cjk.size());
+    const std::u32string astral(utf16_string::inline_capacity / 2 + 1, U'\U0001F600');
+    const utf16_string s16(astral.data(), astral.size());
+    DBJ_CHECK(!inside(s16, s16.get()) && s16.length() == astral.size());
+}
+
+// moved from is empty and usable, heap buffers change hands, buffers are exactly sized
+static void moves(test::random& rng)
+{
+    for (int round = 0; round < 500 && !test::failures; ++round) {
+        const std::u32string text = random_text(rng, round % 2 ? 10 : 200);
+        const std::string text8 = to_utf8(text);
+        const std::u16string text16 = to_utf16(text);
+
+        utf32_string s32(text.data(), text.size());
+        const char32_t* data32 = s32.get();
+        const bool heap32 = !s32.is_inline();
+        utf32_string moved32(std::move(s32));
+        DBJ_CHECK(moved32.length() == text.size() && 0 == memcmp(moved32.get(), text.c_str(), (text.size() + 1) * 4));
+        DBJ_CHECK(!heap32 || moved32.get() == data32);
+        DBJ_CHECK(s32.length() == 0 && s32.get()[0] == 0 && s32.flags() == text_flags::of_empty());
+        s32 = std::move(moved32);
+        DBJ_CHECK(s32.length() == text.size() && moved32.length() == 0);
+        utf32_string& self32 = s32;
+        s32 = std::move(self32);
+        DBJ_CHECK(s32.length() == text.size() && 0 == memcmp(s32.get(), text.c_str(), text.size() * 4));
+
+        utf8_string s8(text8.data(), text8.size());
+        DBJ_CHECK(s8.size() == text8.size() + 1);
+        const char* data8 = s8.get();
+        utf8_string moved8(std::move(s8));
+        DBJ_CHECK(moved8.bytes() == text8.size() && 0 == memcmp(moved8.get(), text8.c_str(), text8.size() + 1));
+        DBJ_CHECK(inside(s8, data8) || moved8.get() == data8);
+        DBJ_CHECK(s8.bytes() == 0 && s8.length() == 0 && s8.get()[0] == 0 && s8.flags() == text_flags::of_empty());
+        s8 = std::move(moved8);
+        DBJ_CHECK(s8.bytes() == text8.size() && s8.length() == text.size() && moved8.bytes() == 0);
+
+        utf16_string s16(text16.data(), text16.size());
+        DBJ_CHECK(s16.size() == text16.size() + 1);
+        utf16_string moved16(std::move(s16));
+        DBJ_CHECK(moved16.units() == text16.size() && 0 == memcmp(moved16.get(), text16.c_str(), (text16.size() + 1) * 2));
+        DBJ_CHECK(s16.units() == 0 && s16.get()[0] == 0 && s16.flags() == text_flags::of_empty());
+        s16 = std::move(moved16);
+        DBJ_CHECK(s16.units() == text16.size() && s16.length() == text.size());
+
+        // exactly sized from utf32 too
+        DBJ_CHECK(utf8_string(s32).size() == text8.size() + 1);
+        DBJ_CHECK(utf16_string(s32).size() == text16.size() + 1);
+    }
+
+    // strings in the vector move on its growth
+    std::vector<utf8_string> strings;
+    for (int j = 0; j < 100; ++j) {
+        const std::string text = std::string(size_t(j) * 3, 'x') + std::to_string(j);
+        strings.emplace_back(text.data(), text.size());
+    }
+    for (int j = 0; j < 100; ++j)
+        DBJ_CHECK(std::string(strings[size_t(j)].get()) == std::string(size_t(j) * 3, 'x') + std::to_string(j));
+}
+
+// every factory, counted and zero terminated, from every encoding
+static void factories(test::random& rng)
+{
+    for (int round = 0; round < 500 && !test::failures; ++round) {
+        const std::u32string text = random_text(rng, 100);
+        const std::string text8 = to_utf8(text);
+        const std::u16string text16 = to_utf16(text);
+
+        auto same8 = [&](const utf8_string& s) {
+            return s.bytes() == text8.size() && 0 == memcmp(s.get(), text8.c_str(), text8.size() + 1);
+        };
+        auto same16 = [&](const utf16_string& s) {
+            return s.units() == text16.size() && 0 == memcmp(s.get(), text16.c_str(), (text16.size() + 1) * 2);
+        };
+        auto same32 = [&](const utf32_string& s) {
+            return s.length() == text.size() && 0 == memcmp(s.get(), text.c_str(), (text.size() + 1) * 4);
+        };
+
+        DBJ_CHECK(same8(make_utf8_string(text8.data(), text8.size())));
+        DBJ_CHECK(same8(make_utf8_string(text16.data(), text16.size())));
+        DBJ_CHECK(same8(make_utf8_string(text.data(), text.size())));
+        DBJ_CHECK(same16(make_utf16_string(text8.data(), text8.size())));
+        DBJ_CHECK(same16(make_utf16_string(text16.data(), text16.size())));
+        DBJ_CHECK(same16(make_utf16_string(text.data(), text.size())));
+        DBJ_CHECK(same32(make_utf32_string(text8.data(), text8.size())));
+        DBJ_CHECK(same32(make_utf32_string(text16.data(), text16.size())));
+        DBJ_CHECK(same32(make_utf32_string(text.data(), text.size())));
+
+        // no NUL in the pool, zero terminated are the same
+        DBJ_CHECK(same8(make_utf8_string(text8.c_str())));
+        DBJ_CHECK(same8(make_utf8_string(text16.c_str())));
+        DBJ_CHECK(same8(make_utf8_string(text.c_str())));
+        DBJ_CHECK(same16(make_utf16_string(text8.c_str())));
+        DBJ_CHECK(same16(make_utf16_string(text16.c_str())));
+        DBJ_CHECK(same16(make_utf16_string(text.c_str())));
+        DBJ_CHECK(same32(make_utf32_string(text8.c_str())));
+        DBJ_CHECK(same32(make_utf32_string(text16.c_str())));
+        DBJ_CHECK(same32(make_utf32_string(text.c_str())));
+        DBJ_CHECK(same32(utf32_string(text8.c_str())));
+        DBJ_CHECK(same32(utf32_string(text.c_str())));
+        DBJ_CHECK(same32(utf32_string(reinterpret_cast<const char8_t*>(text8.c_str()))));
+    }
+
+    // literal 0 count is not ambiguous, and makes the empty string
+    DBJ_CHECK(make_utf32_string(U"abc", 0).length() == 0);
+    DBJ_CHECK(make_utf32_string("abc", 0).length() == 0);
+    DBJ_CHECK(make_utf8_string(u"abc", 0).bytes() == 0);
+    DBJ_CHECK(make_utf16_string("abc", 0).units() == 0);
+    DBJ_CHECK(utf32_string(U"abc", 0).length() == 0);
+    DBJ_CHECK(utf32_string("abc", 0).length() == 0);
+    DBJ_CHECK(utf8_string(U"abc", 0).get()[0] == 0);
+
+    // illegal utf8, what was converted is kept and terminated
+    const utf32_string broken("ab\xC3(", 4);
+    DBJ_CHECK(broken.length() >= 2 && broken[0] == U'a' && broken[1] == U'b' && broken.get()[broken.length()] == 0);
+}
+
+// find, rfind and compare against std::u32string, strncmp32 against the plain loop
+static void searching(test::random& rng)
+{
+    for (int round = 0; round < 3000 && !test::failures; ++round) {
+        // few distinct code points, the needles are found
+        const std::u32string text = random_text(rng, round % 10 ? 40 : 300);
+        const std::u32string needle = text.empty() || rng.below(4) == 0
+            ? random_text(rng, 4) : text.substr(rng.below(uint32_t(text.size())), rng.below(6));
+        const utf32_string s(text.data(), text.size());
+        const utf32_string what(needle.data(), needle.size());
+        const size_t from = rng.below(3) ? rng.below(uint32_t(text.size() + 3)) : npos;
+        const char32_t cp = code_point_pool[rng.below(6)];
+
+        DBJ_CHECK(s.find(cp) == text.find(cp));
+        DBJ_CHECK(s.rfind(cp) == text.rfind(cp));
+        DBJ_CHECK(s.find(what) == text.find(needle));
+        DBJ_CHECK(s.rfind(what) == text.rfind(needle));
+        if (from != npos) {
+            DBJ_CHECK(s.find(cp, from) == text.find(cp, from));
+            DBJ_CHECK(s.find(what, from) == text.find(needle, from));
+        }
+        DBJ_CHECK(s.rfind(cp, from) == text.rfind(cp, from));
+        DBJ_CHECK(s.rfind(what, from) == text.rfind(needle, from));
+
+        const int expected = text.compare(needle);
+        const int found = s.compare(what);
+        DBJ_CHECK((found < 0) == (expected < 0) && (found > 0) == (expected > 0));
+        DBJ_CHECK((s == what) == (text == needle) && (s != what) == (text != needle));
+        DBJ_CHECK((s < what) == (text < needle));
+
+        // strncmp32 stops at the terminator of the left one
+        const size_t len = rng.below(uint32_t(text.size() + 2));
+        const char32_t* left = text.c_str();
+        const char32_t* right = needle.c_str();
+        int plain = 0;
+        for (size_t j = 0; j < len && left[j]; ++j)
+            if (left[j] != right[j]) {
+                plain = int(left[j] - right[j]);
+                break;
+            }
+        DBJ_CHECK(strncmp32(left, right, len) == plain);
+    }
+
+    // values above 0x7FFFFFFF order as unsigned
+    const char32_t high[] = { 0x80000000u, 0 }, low[] = { 1, 0 };
+    DBJ_CHECK(compare_32(high, 1, low, 1) > 0 && compare_32(low, 1, high, 1) < 0);
+}
+
+int main()
+{
+    test::random rng;
+    flags(rng);
+    small_strings();
+    moves(rng);
+    factories(rng);
+    searching(rng);
+    return DBJ_TEST_RESULT;
+}
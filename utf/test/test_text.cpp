@@ -0,0 +1,80 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+utf_text: every form from every original, made once, also when
+requested from many threads at once
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_text.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace dbj::utf;
+
+// u and the combining diaeresis, CJK, astral
+static const char text8[] = "Zu\xCC\x88rich \xE4\xB8\xAD \xF0\x9F\x98\x80!";
+static const char16_t text16[] = u"Zu\u0308rich \u4E2D \U0001F600!";
+static const char32_t text32[] = U"Zu\u0308rich \u4E2D \U0001F600!";
+
+static bool forms(const utf_text& text)
+{
+    const utf8_string& s8 = text.utf8();
+    const utf16_string& s16 = text.utf16();
+    const utf32_string& s32 = text.utf32();
+    return text.length() == strlen_32(text32)
+        && s8.bytes() == strlen(text8) && 0 == memcmp(s8.get(), text8, sizeof(text8))
+        && s16.units() == strlen_16(text16) && 0 == memcmp(s16.get(), text16, sizeof(text16))
+        && s32.length() == strlen_32(text32) && 0 == memcmp(s32.get(), text32, sizeof(text32))
+        // made once
+        && &text.utf8() == &s8 && &text.utf16() == &s16 && &text.utf32() == &s32;
+}
+
+int main()
+{
+    {
+        const utf_text from8(text8);
+        const utf_text from16(text16);
+        const utf_text from32(text32);
+        DBJ_CHECK(from8.original() == encoding::utf8 && forms(from8));
+        DBJ_CHECK(from16.original() == encoding::utf16 && forms(from16));
+        DBJ_CHECK(from32.original() == encoding::utf32 && forms(from32));
+
+        // length comes from the original, nothing is converted for it
+        const utf_text counted(text8, 1);
+        DBJ_CHECK(counted.length() == 1 && counted.utf32()[0] == U'Z');
+        const utf_text empty(U"", 0);
+        DBJ_CHECK(empty.length() == 0 && empty.utf8().bytes() == 0 && empty.utf16().units() == 0);
+    }
+
+    // 8 threads ask for the forms not yet made, in different order
+    for (int round = 0; round < 50; ++round) {
+        const utf_text text(text16);
+        std::atomic<const void*> seen[3]{};
+        std::atomic<int> wrong{ 0 };
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t)
+            threads.emplace_back([&, t] {
+                const void* made[3]{};
+                for (int j = 0; j < 3; ++j) {
+                    const int form = (t + j) % 3;
+                    made[form] = form == 0 ? (const void*)&text.utf8()
+                        : form == 1 ? (const void*)&text.utf16() : (const void*)&text.utf32();
+                }
+                for (int form = 0; form < 3; ++form) {
+                    const void* expected = nullptr;
+                    if (!seen[form].compare_exchange_strong(expected, made[form]) && expected != made[form])
+                        ++wrong;
+                }
+                if (!forms(text))
+                    ++wrong;
+            });
+        for (std::thread& t : threads)
+            t.join();
+        DBJ_CHECK(wrong == 0);
+    }
+
+    return DBJ_TEST_RESULT;
+}
@@ -0,0 +1,152 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+utf8_tokenizer against the code point by code point split, for the sets
+of one, few and more than 16 candidate bytes, ASCII and not; more than
+16 non ASCII delimiters are rejected
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_tokenizer.h"
+
+#include <string>
+#include <vector>
+
+using namespace dbj::utf;
+
+using tokens = std::vector<std::pair<size_t, size_t>>;
+
+static tokens split_slowly(const std::string& text, const char* delimiters, bool skip_empty)
+{
+    std::vector<std::string> set;
+    for (const char *walker = delimiters, *end = delimiters + strlen(delimiters); walker < end;) {
+        char32_t cp{};
+        const unsigned step = decode_utf8(walker, end, cp);
+        set.emplace_back(walker, step);
+        walker += step;
+    }
+
+    tokens result;
+    size_t start = 0, j = 0;
+    auto emit = [&](size_t end) {
+        if (!skip_empty || end > start)
+            result.emplace_back(start, end - start);
+    };
+    while (j < text.size()) {
+        size_t length = 0;
+        for (const std::string& d : set)
+            if (0 == text.compare(j, d.size(), d)) {
+                length = d.size();
+                break;
+            }
+        if (length) {
+            emit(j);
+            j += length;
+            start = j;
+        }
+        else {
+            char32_t cp{};
+            j += decode_utf8(text.data() + j, text.data() + text.size(), cp);
+        }
+    }
+    emit(text.size());
+    return result;
+}
+
+static tokens split(const std::string& text, const delimiter_set& set, bool skip_empty)
+{
+    tokens result;
+    utf8_tokenizer tok(text.data(), text.size(), set, skip_empty);
+    for (token t; tok.next(t);)
+        result.emplace_back(t.offset, t.length);
+    DBJ_CHECK(tok.position() == text.size());
+    return result;
+}
+
+int main()
+{
+    {
+        // the set is a temporary, tokenizer has its own copy
+        const std::string query = "a=1&b=\xC2\xA7;c";
+        utf8_tokenizer tok(query.data(), query.size(), delimiter_set("&=;\xC2\xA7"));
+        tokens found;
+        for (token t; tok.next(t);)
+            found.emplace_back(t.offset, t.length);
+        DBJ_CHECK(found == tokens({ { 0, 1 }, { 2, 1 }, { 4, 1 }, { 6, 0 }, { 8, 0 }, { 9, 1 } }));
+    }
+    {
+        const char32_t wide[] = { U'§', U',' };
+        const delimiter_set set(wide, 2);
+        token array[8]{};
+        DBJ_CHECK(tokenize_utf8("a\xC2\xA7" "b,c", 6, set, array, 8) == 3);
+        DBJ_CHECK(array[1].offset == 3 && array[1].length == 1);
+        // stops when the array is full
+        DBJ_CHECK(tokenize_utf8("a,b,c,d", 7, set, array, 2) == 2);
+        // empty text is one empty token
+        DBJ_CHECK(tokenize_utf8("", 0, set, array, 8) == 1 && array[0].length == 0);
+        DBJ_CHECK(tokenize_utf8("", 0, set, array, 8, true) == 0);
+    }
+    {
+        // illegal utf8 is not a delimiter
+        const delimiter_set set("\xFF,");
+        DBJ_CHECK(!set.is_candidate(0xFF));
+        DBJ_CHECK(split("a\xFF" "b,c", set, false) == tokens({ { 0, 3 }, { 4, 1 } }));
+    }
+
+    {
+        // 16 distinct non ASCII delimiters, duplicates do not count
+        std::string sixteen, split_text, seventeen;
+        for (unsigned j = 0; j < 16; ++j) {
+            const char delimiter[] = { char(0xC2), char(0xA0 + j), 0 };
+            sixteen += delimiter;
+            split_text += 'a';
+            split_text += delimiter;
+        }
+        const delimiter_set set((sixteen + sixteen.substr(0, 4)).c_str());
+        DBJ_CHECK(set.valid() && split(split_text, set, false) == split_slowly(split_text, sixteen.c_str(), false));
+        DBJ_CHECK(split(split_text, set, false).size() == 17);
+
+        // the 17th is not ignored, the set is not valid, no tokens
+        seventeen = sixteen + "\xE2\x82\xAC,";
+        const delimiter_set too_many(seventeen.c_str());
+        DBJ_CHECK(!too_many.valid());
+        utf8_tokenizer tok(split_text.data(), split_text.size(), too_many);
+        token t{};
+        DBJ_CHECK(!tok.next(t) && tok.position() == 0);
+        token array[4]{};
+        DBJ_CHECK(tokenize_utf8("a\xE2\x82\xAC" "b", 5, too_many, array, 4) == 0);
+
+        std::u32string wide;
+        for (char32_t cp = 0x4E00; cp < 0x4E00 + 17; ++cp)
+            wide += cp;
+        DBJ_CHECK(delimiter_set(wide.data(), 16).valid() && !delimiter_set(wide.data(), 17).valid());
+        DBJ_CHECK(delimiter_set("&=;").valid());
+    }
+
+    static const char* const sets[] = {
+        ",", "&=;", "\xC2\xA7,", "\xE2\x80\xA2 \t",
+        // more than 16 candidate bytes
+        "abcdefghijklmnopqrstuvwxyz0123",
+        "\xF0\x9F\x98\x80\xC3\xA9|",
+        // lead bytes shared by many delimiters
+        "\xE2\x80\xA2\xE2\x80\xA3\xE2\x80\xA4\xC2\xA7\xC2\xB6",
+    };
+    static const char* const pieces[] = {
+        "a", "b", "hello", ",", "&", "=", ";", "\xC2\xA7", "\xC3\xA9", "\xE2\x80\xA2", " ", "\t",
+        "\xF0\x9F\x98\x80", "|", "xyzXYZ0123456789ABCDEF", "\xE2\x80\xA3", "\xC2\xB6", "\xE2\x82\xAC",
+    };
+
+    test::random rng;
+    for (const char* delimiters : sets) {
+        const delimiter_set set(delimiters);
+        for (int round = 0; round < 5000 && !test::failures; ++round) {
+            std::string text;
+            for (unsigned n = rng.below(40); n; --n)
+                text += pieces[rng.below(sizeof(pieces) / sizeof(pieces[0]))];
+            for (bool skip_empty : { false, true })
+                if (!DBJ_CHECK(split(text, set, skip_empty) == split_slowly(text, delimiters, skip_empty)))
+                    fprintf(stderr, "    set \"%s\" text \"%s\"\n", delimiters, text.c_str());
+        }
+    }
+
+    return DBJ_TEST_RESULT;
+}
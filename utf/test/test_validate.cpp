@@ -0,0 +1,85 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+validate_utf16() against the definition, in both byte orders, at the
+sizes and offsets around the 8 unit blocks
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_validate.h"
+
+#include <vector>
+
+using namespace dbj::utf;
+
+// first unpaired surrogate, or count
+static size_t first_unpaired(const char16_t* src, size_t count)
+{
+    size_t j = 0;
+    while (j < count) {
+        const char16_t u = src[j];
+        if (u >= 0xD800 && u <= 0xDBFF) {
+            if (j + 1 < count && src[j + 1] >= 0xDC00 && src[j + 1] <= 0xDFFF) {
+                j += 2;
+                continue;
+            }
+            return j;
+        }
+        if (u >= 0xDC00 && u <= 0xDFFF)
+            return j;
+        ++j;
+    }
+    return count;
+}
+
+int main()
+{
+    const char16_t emoji[] = u"a\U0001F600b";
+    DBJ_CHECK(is_valid_utf16(emoji, 4));
+    // split pair
+    DBJ_CHECK(validate_utf16(emoji, 2) == 1);
+    DBJ_CHECK(validate_utf16(emoji + 2, 2) == 0);
+    DBJ_CHECK(validate_utf16(emoji, 0) == 0);
+
+    const char16_t reversed[] = { u'x', 0xDE00, 0xD83D, u'y' };
+    DBJ_CHECK(validate_utf16(reversed, 4) == 1);
+
+    const char16_t swapped[] = { 0x6100, 0x3DD8, 0x00DE };
+    const utf16_byte_order foreign = utf16_byte_order::native == utf16_byte_order::little_endian
+        ? utf16_byte_order::big_endian : utf16_byte_order::little_endian;
+    DBJ_CHECK(is_valid_utf16(swapped, 3, foreign));
+    // Ø, read the other way it is a lone surrogate
+    const char16_t lone[] = { 0x00D8 };
+    DBJ_CHECK(is_valid_utf16(lone, 1));
+    DBJ_CHECK(!is_valid_utf16(lone, 1, foreign));
+
+    // mostly text with pairs, now and then a lone or misplaced surrogate
+    static const char16_t pool[] = { u'a', 0x4E2D, 0xD800, 0xDBFF, 0xDC00, 0xDFFF, 0xFFFF, 0x00D8, 0xF8FF };
+    test::random rng;
+    std::vector<char16_t> units(96), swapped_units(96);
+
+    for (int round = 0; round < 30000 && !test::failures; ++round) {
+        const uint32_t density = 1 + rng.below(40);
+        for (size_t j = 0; j < units.size(); ++j) {
+            const uint32_t r = rng.below(density);
+            if (r == 0)
+                units[j] = pool[rng.below(sizeof(pool) / sizeof(pool[0]))];
+            else if (r == 1 && j + 1 < units.size()) {
+                units[j] = char16_t(0xD800 + rng.below(0x400));
+                units[++j] = char16_t(0xDC00 + rng.below(0x400));
+            }
+            else
+                units[j] = char16_t(0x20 + rng.below(0x5F));
+        }
+        for (size_t j = 0; j < units.size(); ++j)
+            swapped_units[j] = detail::byte_swap_16(units[j]);
+
+        const size_t offset = rng.below(8);
+        const size_t count = rng.below(uint32_t(units.size() - offset + 1));
+        const size_t expected = first_unpaired(units.data() + offset, count);
+        DBJ_CHECK(validate_utf16(units.data() + offset, count) == expected);
+        DBJ_CHECK(validate_utf16(swapped_units.data() + offset, count, foreign) == expected);
+        DBJ_CHECK(is_valid_utf16(units.data() + offset, count) == (expected == count));
+    }
+
+    return DBJ_TEST_RESULT;
+}
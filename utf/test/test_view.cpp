@@ -0,0 +1,227 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+utf8_view, utf16_view and utf32_view against std::basic_string doing the
+same searching, slicing and ordering; length() and find() of the code
+point against the decoded text; is_valid() against the definition of
+the well formed text, validity kept by validate() only, passed on by the
+cuts on the code point boundaries only
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_utf_view.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace dbj::utf;
+
+// same results as std::basic_string, npos is the same value
+template <typename Unit>
+static bool same_as_string(const std::basic_string<Unit>& text, const std::basic_string<Unit>& needle, size_t from)
+{
+    using view = basic_utf_view<Unit>;
+    const view v(text.data(), text.size()), w(needle.data(), needle.size());
+
+    const int order = v.compare(w), expected = text.compare(needle);
+    bool ok = v.find(w, from) == text.find(needle, from)
+        && v.rfind(w, from) == text.rfind(needle, from)
+        && v.rfind(w) == text.rfind(needle)
+        && (order < 0) == (expected < 0) && (order > 0) == (expected > 0)
+        && (v == w) == (text == needle) && (v < w) == (text < needle)
+        && v.starts_with(w) == (needle.size() <= text.size() && 0 == text.compare(0, needle.size(), needle))
+        && v.ends_with(w) == (needle.size() <= text.size() && 0 == text.compare(text.size() - needle.size(), npos, needle));
+
+    const size_t count = from % 7;
+    const view part = v.substr(from, count);
+    const std::basic_string<Unit> expected_part = from <= text.size() ? text.substr(from, count) : std::basic_string<Unit>();
+    ok = ok && part == view(expected_part.data(), expected_part.size());
+
+    view trimmed = v;
+    trimmed.remove_prefix(from % 5);
+    trimmed.remove_suffix(from % 3);
+    const size_t front = from % 5 < text.size() ? from % 5 : text.size();
+    const size_t back = from % 3 < text.size() - front ? from % 3 : text.size() - front;
+    return ok && trimmed.data() == text.data() + front && trimmed.size() == text.size() - front - back;
+}
+
+// few letters, the needles are found; high units sort after the low ones
+static void searching(test::random& rng)
+{
+    static const char32_t letters[] = { U'a', U'b', U'c', 0xFF };
+    for (int round = 0; round < 30000 && !test::failures; ++round) {
+        std::string a, b;
+        std::u16string a16, b16;
+        std::u32string a32, b32;
+        for (size_t n = rng.below(40); n; --n) {
+            const char32_t cp = letters[rng.below(4)];
+            a += char(cp);
+            a16 += char16_t(cp);
+            a32 += cp;
+        }
+        for (size_t n = rng.below(5); n; --n) {
+            const char32_t cp = letters[rng.below(4)];
+            b += char(cp);
+            b16 += char16_t(cp);
+            b32 += cp;
+        }
+        const size_t from = rng.below(4) ? rng.below(45) : npos;
+        DBJ_CHECK(same_as_string(a, b, from));
+        DBJ_CHECK(same_as_string(a16, b16, from));
+        DBJ_CHECK(same_as_string(a32, b32, from));
+    }
+}
+
+// code points of the views of the same text, in every encoding
+static void code_points()
+{
+    const utf32_string text(U"Z\u00FCrich \U0001F600 Z\u00FCrich", 15);
+    const utf8_string text8(text);
+    const utf16_string text16(text);
+    const utf8_view v8 = view_of(text8);
+    const utf16_view v16 = view_of(text16);
+    const utf32_view v32 = view_of(text);
+
+    DBJ_CHECK(v8.length() == 15 && v16.length() == 15 && v32.length() == 15);
+    DBJ_CHECK(v8.size() == text8.bytes() && v16.size() == text16.units() && v32.size() == 15);
+    // positions in code units of each encoding
+    DBJ_CHECK(v8.find(U'\U0001F600') == 8 && v16.find(U'\U0001F600') == 7 && v32.find(U'\U0001F600') == 7);
+    DBJ_CHECK(v8.find(U'\u00FC', 2) == 14 && v16.find(U'\u00FC', 2) == 11 && v32.find(U'\u00FC', 2) == 10);
+    DBJ_CHECK(v8.find(U'x') == npos && v8.find(char32_t(0xD800)) == npos);
+
+    // convert into the caller's buffer
+    char16_t out[32]{};
+    size_t written = 0;
+    DBJ_CHECK(v8.converted_length(encoding::utf16) == text16.units());
+    DBJ_CHECK(conversionOK == v8.substr(0, 6).convert(out, 32, encoding::utf16, written));
+    DBJ_CHECK(written == 5 && out[1] == 0x00FC && out[5] == 0);
+
+    // lone surrogates count as one code point each
+    const char16_t lone[] = { 0xDC00, u'a', 0xD800, 0xD800, 0xDC00 };
+    DBJ_CHECK(utf16_view(lone, 5).length() == 4);
+
+    // zero terminated
+    DBJ_CHECK(utf8_view("abc").size() == 3 && utf16_view(u"abc").size() == 3 && utf32_view(U"abc").size() == 3);
+    DBJ_CHECK(utf8_view().empty() && utf8_view().length() == 0 && utf8_view().is_valid());
+}
+
+/*
+well formed utf8 by the table 3-7 of the Unicode standard
+*/
+static bool well_formed(const unsigned char* s, size_t size)
+{
+    for (size_t j = 0; j < size;) {
+        const unsigned char b = s[j];
+        size_t length = 0;
+        unsigned char low = 0x80, high = 0xBF;
+        if (b < 0x80) length = 1;
+        else if (b >= 0xC2 && b <= 0xDF) length = 2;
+        else if (b == 0xE0) length = 3, low = 0xA0;
+        else if (b >= 0xE1 && b <= 0xEC) length = 3;
+        else if (b == 0xED) length = 3, high = 0x9F;
+        else if (b >= 0xEE && b <= 0xEF) length = 3;
+        else if (b == 0xF0) length = 4, low = 0x90;
+        else if (b >= 0xF1 && b <= 0xF3) length = 4;
+        else if (b == 0xF4) length = 4, high = 0x8F;
+        else return false;
+
+        if (size - j < length)
+            return false;
+        for (size_t k = 1; k < length; ++k) {
+            const unsigned char c = s[j + k];
+            if (c < (k == 1 ? low : 0x80) || c > (k == 1 ? high : 0xBF))
+                return false;
+        }
+        j += length;
+    }
+    return true;
+}
+
+static void validity(test::random& rng)
+{
+    // mostly legal sequences, a random byte now and then
+    static const char* pieces[] = { "a", "\xC3\xA9", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80", "\xF4\x8F\xBF\xBF", "\xEF\xBF\xBF" };
+    static const unsigned char odd[] = { 0x80, 0xBF, 0xC0, 0xC1, 0xE0, 0xED, 0xF0, 0xF4, 0xF5, 0xFF, 0xA0, 0x90, 0x8F };
+
+    for (int round = 0; round < 20000 && !test::failures; ++round) {
+        std::string text;
+        for (size_t n = rng.below(30); n; --n) {
+            if (rng.below(20))
+                text += pieces[rng.below(6)];
+            else
+                text += char(odd[rng.below(sizeof(odd))]);
+        }
+        const bool expected = well_formed(reinterpret_cast<const unsigned char*>(text.data()), text.size());
+        const utf8_view v(text.data(), text.size());
+        DBJ_CHECK(v.is_valid() == expected && v.validity() == view_validity::unknown);
+    }
+
+    // ASCII after the lead bytes with the narrower second byte range
+    DBJ_CHECK(!utf8_view("\xED\x61\xBF").is_valid() && !utf8_view("\xF4\x61\x80\x80").is_valid());
+
+    // utf16 and utf32, lone surrogates and values above U+10FFFF
+    const char16_t pair[] = { 0xD83D, 0xDE00 }, reversed[] = { 0xDE00, 0xD83D };
+    DBJ_CHECK(utf16_view(pair, 2).is_valid() && !utf16_view(reversed, 2).is_valid() && !utf16_view(pair, 1).is_valid());
+    const char32_t legal[] = { 0x10FFFF, 0xFFFF, 0 }, surrogate[] = { U'a', 0xDFFF }, above[] = { 0x110000 };
+    DBJ_CHECK(utf32_view(legal, 3).is_valid() && !utf32_view(surrogate, 2).is_valid() && !utf32_view(above, 1).is_valid());
+
+    // validate() keeps the result, substr() passes on the valid one only
+    utf8_view good("ab\xC3\xA9"), bad("ab\xC3");
+    DBJ_CHECK(good.validate() && good.validity() == view_validity::valid);
+    DBJ_CHECK(!bad.validate() && bad.validity() == view_validity::invalid);
+    DBJ_CHECK(good.substr(1).validity() == view_validity::valid);
+    DBJ_CHECK(bad.substr(0, 2).validity() == view_validity::unknown && bad.substr(0, 2).is_valid());
+
+    // cut inside the sequence or between the surrogates, validity is not passed on
+    utf8_view text8("a\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80");
+    DBJ_CHECK(text8.validate());
+    for (size_t pos = 0; pos <= text8.size(); ++pos)
+        for (size_t count = 0; pos + count <= text8.size(); ++count) {
+            const utf8_view part = text8.substr(pos, count);
+            const bool expected = well_formed(reinterpret_cast<const unsigned char*>(part.data()), part.size());
+            DBJ_CHECK((part.validity() == view_validity::valid) == expected && part.is_valid() == expected);
+        }
+    utf8_view cut = text8;
+    cut.remove_prefix(2);
+    DBJ_CHECK(cut.validity() == view_validity::unknown && !cut.is_valid());
+    cut = text8;
+    cut.remove_suffix(1);
+    DBJ_CHECK(cut.validity() == view_validity::unknown && !cut.is_valid());
+    cut = text8;
+    cut.remove_suffix(4);
+    DBJ_CHECK(cut.validity() == view_validity::valid && cut.is_valid());
+
+    utf16_view text16(u"a\U0001F600b");
+    DBJ_CHECK(text16.validate());
+    DBJ_CHECK(text16.substr(0, 2).validity() == view_validity::unknown && !text16.substr(0, 2).is_valid());
+    DBJ_CHECK(text16.substr(2).validity() == view_validity::unknown && !text16.substr(2).is_valid());
+    DBJ_CHECK(text16.substr(1, 2).validity() == view_validity::valid && text16.substr(3).validity() == view_validity::valid);
+    utf32_view text32(U"a\U0001F600b");
+    DBJ_CHECK(text32.validate() && text32.substr(1, 1).validity() == view_validity::valid);
+
+    // stated up front, not checked
+    const utf8_view trusted("\xFF", 1, view_validity::valid);
+    DBJ_CHECK(trusted.is_valid());
+
+    // a const view checked from 8 threads at once
+    std::string big;
+    for (int j = 0; j < 10000; ++j)
+        big += pieces[j % 6];
+    const utf8_view shared(big.data(), big.size());
+    std::vector<std::thread> threads;
+    std::vector<char> results(8);
+    for (size_t t = 0; t < 8; ++t)
+        threads.emplace_back([&, t] { results[t] = shared.is_valid(); });
+    for (std::thread& t : threads)
+        t.join();
+    DBJ_CHECK(results == std::vector<char>(8, 1) && shared.validity() == view_validity::unknown);
+}
+
+int main()
+{
+    test::random rng;
+    searching(rng);
+    code_points();
+    validity(rng);
+    return DBJ_TEST_RESULT;
+}
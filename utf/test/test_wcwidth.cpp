@@ -0,0 +1,614 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+    test_wcwidth [UCD folder]
+
+dbj_wcwidth for every code point against wcwidth.c as it was before the
+two stage table: Markus Kuhn's function of 2007, its intervals copied
+here as they were, but for the Unicode 14 differences listed here.
+
+With the UCD folder the two stage table lookup is compared, for every
+code point and every profile, with the lookup wcwidth.c did before it:
+binary search in the sorted intervals, here made from
+DerivedGeneralCategory.txt, EastAsianWidth.txt and emoji-data.txt by the
+rules of Markus Kuhn's wcwidth.
+
+dbj_wcswidth_utf8 and dbj_wcswidth_utf16 against dbj_wcswidth of the
+same text decoded: one U+FFFD for each byte of the illegal utf8, lone
+surrogates as they are, NUL ends the text, -1 on the control characters.
+*/
+#include "dbj_utf_test.h"
+#include "../dbj_wcwidth.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct interval {
+        char32_t first;
+        char32_t last;
+    };
+
+    // bisearch() of the old wcwidth.c, max is the index of the last interval
+    bool bisearch(char32_t ucs, const interval* table, int max)
+    {
+        if (ucs < table[0].first || ucs > table[max].last)
+            return false;
+        int min = 0;
+        while (max >= min) {
+            const int mid = (min + max) / 2;
+            if (ucs > table[mid].last)
+                min = mid + 1;
+            else if (ucs < table[mid].first)
+                max = mid - 1;
+            else
+                return true;
+        }
+        return false;
+    }
+
+    /*
+    Markus Kuhn -- 2007-05-26 (Unicode 5.0), the non spacing characters,
+    generated by "uniset +cat=Me +cat=Mn +cat=Cf -00AD +1160-11FF +200B c"
+    */
+    const interval kuhn_combining[] = {
+        { 0x0300, 0x036F }, { 0x0483, 0x0486 }, { 0x0488, 0x0489 },
+        { 0x0591, 0x05BD }, { 0x05BF, 0x05BF }, { 0x05C1, 0x05C2 },
+        { 0x05C4, 0x05C5 }, { 0x05C7, 0x05C7 }, { 0x0600, 0x0603 },
+        { 0x0610, 0x0615 }, { 0x064B, 0x065E }, { 0x0670, 0x0670 },
+        { 0x06D6, 0x06E4 }, { 0x06E7, 0x06E8 }, { 0x06EA, 0x06ED },
+        { 0x070F, 0x070F }, { 0x0711, 0x0711 }, { 0x0730, 0x074A },
+        { 0x07A6, 0x07B0 }, { 0x07EB, 0x07F3 }, { 0x0901, 0x0902 },
+        { 0x093C, 0x093C }, { 0x0941, 0x0948 }, { 0x094D, 0x094D },
+        { 0x0951, 0x0954 }, { 0x0962, 0x0963 }, { 0x0981, 0x0981 },
+        { 0x09BC, 0x09BC }, { 0x09C1, 0x09C4 }, { 0x09CD, 0x09CD },
+        { 0x09E2, 0x09E3 }, { 0x0A01, 0x0A02 }, { 0x0A3C, 0x0A3C },
+        { 0x0A41, 0x0A42 }, { 0x0A47, 0x0A48 }, { 0x0A4B, 0x0A4D },
+        { 0x0A70, 0x0A71 }, { 0x0A81, 0x0A82 }, { 0x0ABC, 0x0ABC },
+        { 0x0AC1, 0x0AC5 }, { 0x0AC7, 0x0AC8 }, { 0x0ACD, 0x0ACD },
+        { 0x0AE2, 0x0AE3 }, { 0x0B01, 0x0B01 }, { 0x0B3C, 0x0B3C },
+        { 0x0B3F, 0x0B3F }, { 0x0B41, 0x0B43 }, { 0x0B4D, 0x0B4D },
+        { 0x0B56, 0x0B56 }, { 0x0B82, 0x0B82 }, { 0x0BC0, 0x0BC0 },
+        { 0x0BCD, 0x0BCD }, { 0x0C3E, 0x0C40 }, { 0x0C46, 0x0C48 },
+        { 0x0C4A, 0x0C4D }, { 0x0C55, 0x0C56 }, { 0x0CBC, 0x0CBC },
+        { 0x0CBF, 0x0CBF }, { 0x0CC6, 0x0CC6 }, { 0x0CCC, 0x0CCD },
+        { 0x0CE2, 0x0CE3 }, { 0x0D41, 0x0D43 }, { 0x0D4D, 0x0D4D },
+        { 0x0DCA, 0x0DCA }, { 0x0DD2, 0x0DD4 }, { 0x0DD6, 0x0DD6 },
+        { 0x0E31, 0x0E31 }, { 0x0E34, 0x0E3A }, { 0x0E47, 0x0E4E },
+        { 0x0EB1, 0x0EB1 }, { 0x0EB4, 0x0EB9 }, { 0x0EBB, 0x0EBC },
+        { 0x0EC8, 0x0ECD }, { 0x0F18, 0x0F19 }, { 0x0F35, 0x0F35 },
+        { 0x0F37, 0x0F37 }, { 0x0F39, 0x0F39 }, { 0x0F71, 0x0F7E },
+        { 0x0F80, 0x0F84 }, { 0x0F86, 0x0F87 }, { 0x0F90, 0x0F97 },
+        { 0x0F99, 0x0FBC }, { 0x0FC6, 0x0FC6 }, { 0x102D, 0x1030 },
+        { 0x1032, 0x1032 }, { 0x1036, 0x1037 }, { 0x1039, 0x1039 },
+        { 0x1058, 0x1059 }, { 0x1160, 0x11FF }, { 0x135F, 0x135F },
+        { 0x1712, 0x1714 }, { 0x1732, 0x1734 }, { 0x1752, 0x1753 },
+        { 0x1772, 0x1773 }, { 0x17B4, 0x17B5 }, { 0x17B7, 0x17BD },
+        { 0x17C6, 0x17C6 }, { 0x17C9, 0x17D3 }, { 0x17DD, 0x17DD },
+        { 0x180B, 0x180D }, { 0x18A9, 0x18A9 }, { 0x1920, 0x1922 },
+        { 0x1927, 0x1928 }, { 0x1932, 0x1932 }, { 0x1939, 0x193B },
+        { 0x1A17, 0x1A18 }, { 0x1B00, 0x1B03 }, { 0x1B34, 0x1B34 },
+        { 0x1B36, 0x1B3A }, { 0x1B3C, 0x1B3C }, { 0x1B42, 0x1B42 },
+        { 0x1B6B, 0x1B73 }, { 0x1DC0, 0x1DCA }, { 0x1DFE, 0x1DFF },
+        { 0x200B, 0x200F }, { 0x202A, 0x202E }, { 0x2060, 0x2063 },
+        { 0x206A, 0x206F }, { 0x20D0, 0x20EF }, { 0x302A, 0x302F },
+        { 0x3099, 0x309A }, { 0xA806, 0xA806 }, { 0xA80B, 0xA80B },
+        { 0xA825, 0xA826 }, { 0xFB1E, 0xFB1E }, { 0xFE00, 0xFE0F },
+        { 0xFE20, 0xFE23 }, { 0xFEFF, 0xFEFF }, { 0xFFF9, 0xFFFB },
+        { 0x10A01, 0x10A03 }, { 0x10A05, 0x10A06 }, { 0x10A0C, 0x10A0F },
+        { 0x10A38, 0x10A3A }, { 0x10A3F, 0x10A3F }, { 0x1D167, 0x1D169 },
+        { 0x1D173, 0x1D182 }, { 0x1D185, 0x1D18B }, { 0x1D1AA, 0x1D1AD },
+        { 0x1D242, 0x1D244 }, { 0xE0001, 0xE0001 }, { 0xE0020, 0xE007F },
+        { 0xE0100, 0xE01EF }
+    };
+
+    // dbj_wcwidth of the old wcwidth.c, the wide ranges as they were
+    int kuhn_wcwidth(char32_t ucs)
+    {
+        if (ucs == 0)
+            return 0;
+        if (ucs < 32 || (ucs >= 0x7f && ucs < 0xa0))
+            return -1;
+        if (bisearch(ucs, kuhn_combining, int(sizeof(kuhn_combining) / sizeof(interval)) - 1))
+            return 0;
+
+        return 1 +
+            (ucs >= 0x1100 &&
+                (ucs <= 0x115f ||                    /* Hangul Jamo init. consonants */
+                    ucs == 0x2329 || ucs == 0x232a ||
+                    (ucs >= 0x2e80 && ucs <= 0xa4cf &&
+                        ucs != 0x303f) ||                  /* CJK ... Yi */
+                    (ucs >= 0xac00 && ucs <= 0xd7a3) || /* Hangul Syllables */
+                    (ucs >= 0xf900 && ucs <= 0xfaff) || /* CJK Compatibility Ideographs */
+                    (ucs >= 0xfe10 && ucs <= 0xfe19) || /* Vertical forms */
+                    (ucs >= 0xfe30 && ucs <= 0xfe6f) || /* CJK Compatibility Forms */
+                    (ucs >= 0xff00 && ucs <= 0xff60) || /* Fullwidth Forms */
+                    (ucs >= 0xffe0 && ucs <= 0xffe6) ||
+                    (ucs >= 0x20000 && ucs <= 0x2fffd) ||
+                    (ucs >= 0x30000 && ucs <= 0x3fffd)));
+    }
+
+    /*
+    the widths the Unicode 14 table changes on purpose, anything else is
+    as Kuhn's; a change of the table that is not listed here fails
+    */
+
+    // Mn, Me and Cf added since Unicode 5.0, the jamo D7B0..D7FF
+    const interval now_zero[] = {
+        { 0x0487, 0x0487 }, { 0x0604, 0x0605 }, { 0x0616, 0x061A },
+        { 0x061C, 0x061C }, { 0x065F, 0x065F }, { 0x07FD, 0x07FD },
+        { 0x0816, 0x0819 }, { 0x081B, 0x0823 }, { 0x0825, 0x0827 },
+        { 0x0829, 0x082D }, { 0x0859, 0x085B }, { 0x0890, 0x0891 },
+        { 0x0898, 0x089F }, { 0x08CA, 0x0900 }, { 0x093A, 0x093A },
+        { 0x0955, 0x0957 }, { 0x09FE, 0x09FE }, { 0x0A51, 0x0A51 },
+        { 0x0A75, 0x0A75 }, { 0x0AFA, 0x0AFF }, { 0x0B44, 0x0B44 },
+        { 0x0B55, 0x0B55 }, { 0x0B62, 0x0B63 }, { 0x0C00, 0x0C00 },
+        { 0x0C04, 0x0C04 }, { 0x0C3C, 0x0C3C }, { 0x0C62, 0x0C63 },
+        { 0x0C81, 0x0C81 }, { 0x0D00, 0x0D01 }, { 0x0D3B, 0x0D3C },
+        { 0x0D44, 0x0D44 }, { 0x0D62, 0x0D63 }, { 0x0D81, 0x0D81 },
+        { 0x0EBA, 0x0EBA }, { 0x0F8D, 0x0F8F }, { 0x1033, 0x1035 },
+        { 0x103A, 0x103A }, { 0x103D, 0x103E }, { 0x105E, 0x1060 },
+        { 0x1071, 0x1074 }, { 0x1082, 0x1082 }, { 0x1085, 0x1086 },
+        { 0x108D, 0x108D }, { 0x109D, 0x109D }, { 0x135D, 0x135E },
+        { 0x180E, 0x180F }, { 0x1885, 0x1886 }, { 0x1A1B, 0x1A1B },
+        { 0x1A56, 0x1A56 }, { 0x1A58, 0x1A5E }, { 0x1A60, 0x1A60 },
+        { 0x1A62, 0x1A62 }, { 0x1A65, 0x1A6C }, { 0x1A73, 0x1A7C },
+        { 0x1A7F, 0x1A7F }, { 0x1AB0, 0x1ACE }, { 0x1B80, 0x1B81 },
+        { 0x1BA2, 0x1BA5 }, { 0x1BA8, 0x1BA9 }, { 0x1BAB, 0x1BAD },
+        { 0x1BE6, 0x1BE6 }, { 0x1BE8, 0x1BE9 }, { 0x1BED, 0x1BED },
+        { 0x1BEF, 0x1BF1 }, { 0x1C2C, 0x1C33 }, { 0x1C36, 0x1C37 },
+        { 0x1CD0, 0x1CD2 }, { 0x1CD4, 0x1CE0 }, { 0x1CE2, 0x1CE8 },
+        { 0x1CED, 0x1CED }, { 0x1CF4, 0x1CF4 }, { 0x1CF8, 0x1CF9 },
+        { 0x1DCB, 0x1DFD }, { 0x2064, 0x2064 }, { 0x2066, 0x2069 },
+        { 0x20F0, 0x20F0 }, { 0x2CEF, 0x2CF1 }, { 0x2D7F, 0x2D7F },
+        { 0x2DE0, 0x2DFF }, { 0xA66F, 0xA672 }, { 0xA674, 0xA67D },
+        { 0xA69E, 0xA69F }, { 0xA6F0, 0xA6F1 }, { 0xA802, 0xA802 },
+        { 0xA82C, 0xA82C }, { 0xA8C4, 0xA8C5 }, { 0xA8E0, 0xA8F1 },
+        { 0xA8FF, 0xA8FF }, { 0xA926, 0xA92D }, { 0xA947, 0xA951 },
+        { 0xA980, 0xA982 }, { 0xA9B3, 0xA9B3 }, { 0xA9B6, 0xA9B9 },
+        { 0xA9BC, 0xA9BD }, { 0xA9E5, 0xA9E5 }, { 0xAA29, 0xAA2E },
+        { 0xAA31, 0xAA32 }, { 0xAA35, 0xAA36 }, { 0xAA43, 0xAA43 },
+        { 0xAA4C, 0xAA4C }, { 0xAA7C, 0xAA7C }, { 0xAAB0, 0xAAB0 },
+        { 0xAAB2, 0xAAB4 }, { 0xAAB7, 0xAAB8 }, { 0xAABE, 0xAABF },
+        { 0xAAC1, 0xAAC1 }, { 0xAAEC, 0xAAED }, { 0xAAF6, 0xAAF6 },
+        { 0xABE5, 0xABE5 }, { 0xABE8, 0xABE8 }, { 0xABED, 0xABED },
+        { 0xD7B0, 0xD7FF }, { 0xFE24, 0xFE2F }, { 0x101FD, 0x101FD },
+        { 0x102E0, 0x102E0 }, { 0x10376, 0x1037A }, { 0x10AE5, 0x10AE6 },
+        { 0x10D24, 0x10D27 }, { 0x10EAB, 0x10EAC }, { 0x10F46, 0x10F50 },
+        { 0x10F82, 0x10F85 }, { 0x11001, 0x11001 }, { 0x11038, 0x11046 },
+        { 0x11070, 0x11070 }, { 0x11073, 0x11074 }, { 0x1107F, 0x11081 },
+        { 0x110B3, 0x110B6 }, { 0x110B9, 0x110BA }, { 0x110BD, 0x110BD },
+        { 0x110C2, 0x110C2 }, { 0x110CD, 0x110CD }, { 0x11100, 0x11102 },
+        { 0x11127, 0x1112B }, { 0x1112D, 0x11134 }, { 0x11173, 0x11173 },
+        { 0x11180, 0x11181 }, { 0x111B6, 0x111BE }, { 0x111C9, 0x111CC },
+        { 0x111CF, 0x111CF }, { 0x1122F, 0x11231 }, { 0x11234, 0x11234 },
+        { 0x11236, 0x11237 }, { 0x1123E, 0x1123E }, { 0x112DF, 0x112DF },
+        { 0x112E3, 0x112EA }, { 0x11300, 0x11301 }, { 0x1133B, 0x1133C },
+        { 0x11340, 0x11340 }, { 0x11366, 0x1136C }, { 0x11370, 0x11374 },
+        { 0x11438, 0x1143F }, { 0x11442, 0x11444 }, { 0x11446, 0x11446 },
+        { 0x1145E, 0x1145E }, { 0x114B3, 0x114B8 }, { 0x114BA, 0x114BA },
+        { 0x114BF, 0x114C0 }, { 0x114C2, 0x114C3 }, { 0x115B2, 0x115B5 },
+        { 0x115BC, 0x115BD }, { 0x115BF, 0x115C0 }, { 0x115DC, 0x115DD },
+        { 0x11633, 0x1163A }, { 0x1163D, 0x1163D }, { 0x1163F, 0x11640 },
+        { 0x116AB, 0x116AB }, { 0x116AD, 0x116AD }, { 0x116B0, 0x116B5 },
+        { 0x116B7, 0x116B7 }, { 0x1171D, 0x1171F }, { 0x11722, 0x11725 },
+        { 0x11727, 0x1172B }, { 0x1182F, 0x11837 }, { 0x11839, 0x1183A },
+        { 0x1193B, 0x1193C }, { 0x1193E, 0x1193E }, { 0x11943, 0x11943 },
+        { 0x119D4, 0x119D7 }, { 0x119DA, 0x119DB }, { 0x119E0, 0x119E0 },
+        { 0x11A01, 0x11A0A }, { 0x11A33, 0x11A38 }, { 0x11A3B, 0x11A3E },
+        { 0x11A47, 0x11A47 }, { 0x11A51, 0x11A56 }, { 0x11A59, 0x11A5B },
+        { 0x11A8A, 0x11A96 }, { 0x11A98, 0x11A99 }, { 0x11C30, 0x11C36 },
+        { 0x11C38, 0x11C3D }, { 0x11C3F, 0x11C3F }, { 0x11C92, 0x11CA7 },
+        { 0x11CAA, 0x11CB0 }, { 0x11CB2, 0x11CB3 }, { 0x11CB5, 0x11CB6 },
+        { 0x11D31, 0x11D36 }, { 0x11D3A, 0x11D3A }, { 0x11D3C, 0x11D3D },
+        { 0x11D3F, 0x11D45 }, { 0x11D47, 0x11D47 }, { 0x11D90, 0x11D91 },
+        { 0x11D95, 0x11D95 }, { 0x11D97, 0x11D97 }, { 0x11EF3, 0x11EF4 },
+        { 0x13430, 0x13438 }, { 0x16AF0, 0x16AF4 }, { 0x16B30, 0x16B36 },
+        { 0x16F4F, 0x16F4F }, { 0x16F8F, 0x16F92 }, { 0x16FE4, 0x16FE4 },
+        { 0x1BC9D, 0x1BC9E }, { 0x1BCA0, 0x1BCA3 }, { 0x1CF00, 0x1CF2D },
+        { 0x1CF30, 0x1CF46 }, { 0x1DA00, 0x1DA36 }, { 0x1DA3B, 0x1DA6C },
+        { 0x1DA75, 0x1DA75 }, { 0x1DA84, 0x1DA84 }, { 0x1DA9B, 0x1DA9F },
+        { 0x1DAA1, 0x1DAAF }, { 0x1E000, 0x1E006 }, { 0x1E008, 0x1E018 },
+        { 0x1E01B, 0x1E021 }, { 0x1E023, 0x1E024 }, { 0x1E026, 0x1E02A },
+        { 0x1E130, 0x1E136 }, { 0x1E2AE, 0x1E2AE }, { 0x1E2EC, 0x1E2EF },
+        { 0x1E8D0, 0x1E8D6 }, { 0x1E944, 0x1E94A }
+    };
+
+    // W and F added since, the emoji presentation; the Hangul tone marks
+    // 302E..302F were Mn, are Mc and W
+    const interval now_wide[] = {
+        { 0x231A, 0x231B }, { 0x23E9, 0x23EC }, { 0x23F0, 0x23F0 },
+        { 0x23F3, 0x23F3 }, { 0x25FD, 0x25FE }, { 0x2614, 0x2615 },
+        { 0x2648, 0x2653 }, { 0x267F, 0x267F }, { 0x2693, 0x2693 },
+        { 0x26A1, 0x26A1 }, { 0x26AA, 0x26AB }, { 0x26BD, 0x26BE },
+        { 0x26C4, 0x26C5 }, { 0x26CE, 0x26CE }, { 0x26D4, 0x26D4 },
+        { 0x26EA, 0x26EA }, { 0x26F2, 0x26F3 }, { 0x26F5, 0x26F5 },
+        { 0x26FA, 0x26FA }, { 0x26FD, 0x26FD }, { 0x2705, 0x2705 },
+        { 0x270A, 0x270B }, { 0x2728, 0x2728 }, { 0x274C, 0x274C },
+        { 0x274E, 0x274E }, { 0x2753, 0x2755 }, { 0x2757, 0x2757 },
+        { 0x2795, 0x2797 }, { 0x27B0, 0x27B0 }, { 0x27BF, 0x27BF },
+        { 0x2B1B, 0x2B1C }, { 0x2B50, 0x2B50 }, { 0x2B55, 0x2B55 },
+        { 0x302E, 0x302F }, { 0xA960, 0xA97C }, { 0x16FE0, 0x16FE3 },
+        { 0x16FF0, 0x16FF1 }, { 0x17000, 0x187F7 }, { 0x18800, 0x18CD5 },
+        { 0x18D00, 0x18D08 }, { 0x1AFF0, 0x1AFF3 }, { 0x1AFF5, 0x1AFFB },
+        { 0x1AFFD, 0x1AFFE }, { 0x1B000, 0x1B122 }, { 0x1B150, 0x1B152 },
+        { 0x1B164, 0x1B167 }, { 0x1B170, 0x1B2FB }, { 0x1F004, 0x1F004 },
+        { 0x1F0CF, 0x1F0CF }, { 0x1F18E, 0x1F18E }, { 0x1F191, 0x1F19A },
+        { 0x1F200, 0x1F202 }, { 0x1F210, 0x1F23B }, { 0x1F240, 0x1F248 },
+        { 0x1F250, 0x1F251 }, { 0x1F260, 0x1F265 }, { 0x1F300, 0x1F320 },
+        { 0x1F32D, 0x1F335 }, { 0x1F337, 0x1F37C }, { 0x1F37E, 0x1F393 },
+        { 0x1F3A0, 0x1F3CA }, { 0x1F3CF, 0x1F3D3 }, { 0x1F3E0, 0x1F3F0 },
+        { 0x1F3F4, 0x1F3F4 }, { 0x1F3F8, 0x1F43E }, { 0x1F440, 0x1F440 },
+        { 0x1F442, 0x1F4FC }, { 0x1F4FF, 0x1F53D }, { 0x1F54B, 0x1F54E },
+        { 0x1F550, 0x1F567 }, { 0x1F57A, 0x1F57A }, { 0x1F595, 0x1F596 },
+        { 0x1F5A4, 0x1F5A4 }, { 0x1F5FB, 0x1F64F }, { 0x1F680, 0x1F6C5 },
+        { 0x1F6CC, 0x1F6CC }, { 0x1F6D0, 0x1F6D2 }, { 0x1F6D5, 0x1F6D7 },
+        { 0x1F6DD, 0x1F6DF }, { 0x1F6EB, 0x1F6EC }, { 0x1F6F4, 0x1F6FC },
+        { 0x1F7E0, 0x1F7EB }, { 0x1F7F0, 0x1F7F0 }, { 0x1F90C, 0x1F93A },
+        { 0x1F93C, 0x1F945 }, { 0x1F947, 0x1F9FF }, { 0x1FA70, 0x1FA74 },
+        { 0x1FA78, 0x1FA7C }, { 0x1FA80, 0x1FA86 }, { 0x1FA90, 0x1FAAC },
+        { 0x1FAB0, 0x1FABA }, { 0x1FAC0, 0x1FAC5 }, { 0x1FAD0, 0x1FAD9 },
+        { 0x1FAE0, 0x1FAE7 }, { 0x1FAF0, 0x1FAF6 }
+    };
+
+    // U+06DE and U+1734 are not Mn or Me any more; the rest is in Kuhn's
+    // wide ranges and is not W or F: unassigned, the circled numbers
+    // 3248..324F are A, the Yijing hexagrams 4DC0..4DFF are N
+    const interval now_one[] = {
+        { 0x06DE, 0x06DE }, { 0x1734, 0x1734 },
+        { 0x2E9A, 0x2E9A }, { 0x2EF4, 0x2EFF }, { 0x2FD6, 0x2FEF },
+        { 0x2FFC, 0x2FFF }, { 0x3040, 0x3040 }, { 0x3097, 0x3098 },
+        { 0x3100, 0x3104 }, { 0x3130, 0x3130 }, { 0x318F, 0x318F },
+        { 0x31E4, 0x31EF }, { 0x321F, 0x321F }, { 0x3248, 0x324F },
+        { 0x4DC0, 0x4DFF }, { 0xA48D, 0xA48F }, { 0xA4C7, 0xA4CF },
+        { 0xFE53, 0xFE53 }, { 0xFE67, 0xFE67 }, { 0xFE6C, 0xFE6F },
+        { 0xFF00, 0xFF00 }
+    };
+
+    template <size_t N>
+    bool in(char32_t ucs, const interval(&table)[N])
+    {
+        return bisearch(ucs, table, int(N) - 1);
+    }
+
+    int unicode_14_width(char32_t ucs)
+    {
+        if (in(ucs, now_zero))
+            return 0;
+        if (in(ucs, now_wide))
+            return 2;
+        if (in(ucs, now_one))
+            return 1;
+        return kuhn_wcwidth(ucs);
+    }
+
+    // sorted, non overlapping, neighbours joined
+    class interval_set final {
+    public:
+        void add(char32_t first, char32_t last)
+        {
+            if (!ranges_.empty() && ranges_.back().last + 1 == first)
+                ranges_.back().last = last;
+            else
+                ranges_.push_back({ first, last });
+        }
+
+        bool contains(char32_t ucs) const
+        {
+            return !ranges_.empty() && bisearch(ucs, ranges_.data(), int(ranges_.size()) - 1);
+        }
+
+        size_t size() const { return ranges_.size(); }
+
+    private:
+        std::vector<interval> ranges_;
+    };
+
+    // the old interval tables, from the UCD
+    struct old_tables final {
+        interval_set combining, wide, ambiguous, emoji;
+    };
+
+    // Kuhn's rules, the ambiguous and emoji ones only for the spacing characters of width 1
+    int old_wcwidth(const old_tables& tables, char32_t ucs, int profile)
+    {
+        if (ucs == 0)
+            return 0;
+        if (ucs < 32 || (ucs >= 0x7F && ucs < 0xA0))
+            return -1;
+        if (tables.combining.contains(ucs))
+            return 0;
+        if (tables.wide.contains(ucs))
+            return 2;
+        if ((profile & DBJ_WCWIDTH_PROFILE_CJK) && tables.ambiguous.contains(ucs))
+            return 2;
+        if ((profile & DBJ_WCWIDTH_PROFILE_EMOJI) && tables.emoji.contains(ucs))
+            return 2;
+        return 1;
+    }
+
+    const char32_t max_code_point = 0x10FFFF;
+
+    const int profiles[] = {
+        DBJ_WCWIDTH_PROFILE_DEFAULT, DBJ_WCWIDTH_PROFILE_CJK, DBJ_WCWIDTH_PROFILE_EMOJI,
+        DBJ_WCWIDTH_PROFILE_CJK | DBJ_WCWIDTH_PROFILE_EMOJI,
+    };
+
+} // namespace
+
+// every code point and a few past the last one
+static void against_kuhn_2007()
+{
+    for (char32_t cp = 0; cp <= 0x11FFFF; ++cp) {
+        if (!DBJ_CHECK(dbj_wcwidth(cp) == unicode_14_width(cp)))
+            fprintf(stderr, "    U+%04X: %d, Kuhn's %d\n", unsigned(cp), dbj_wcwidth(cp), kuhn_wcwidth(cp));
+        if (dbj::utf::test::failures > 32)
+            break;
+    }
+}
+
+static bool load(const char* ucd, old_tables& tables)
+{
+    std::vector<std::string> category(max_code_point + 1, "Cn");
+    std::vector<char> east_asian(max_code_point + 1, 'N');
+    std::vector<bool> emoji(max_code_point + 1);
+
+    bool ok = dbj::utf::test::read_ucd(ucd, "DerivedGeneralCategory.txt", [&](char32_t first, char32_t last, const char* value) {
+        for (char32_t cp = first; cp <= last; ++cp)
+            category[cp] = value;
+    });
+    ok = ok && dbj::utf::test::read_ucd(ucd, "EastAsianWidth.txt", [&](char32_t first, char32_t last, const char* value) {
+        for (char32_t cp = first; cp <= last; ++cp)
+            east_asian[cp] = value[0] == 'N' && value[1] == 'a' ? 'n' : value[0];
+    });
+    ok = ok && dbj::utf::test::read_ucd(ucd, "emoji-data.txt", [&](char32_t first, char32_t last, const char* value) {
+        if (0 == strcmp(value, "Emoji"))
+            for (char32_t cp = first; cp <= last; ++cp)
+                emoji[cp] = true;
+    });
+    if (!ok)
+        return false;
+
+    // unassigned code points of the CJK blocks and planes are W, the @missing lines
+    static const interval cjk[] = { { 0x3400, 0x4DBF }, { 0x4E00, 0x9FFF }, { 0xF900, 0xFAFF }, { 0x20000, 0x2FFFD }, { 0x30000, 0x3FFFD } };
+    for (const interval& block : cjk)
+        for (char32_t cp = block.first; cp <= block.last; ++cp)
+            if (category[cp] == "Cn")
+                east_asian[cp] = 'W';
+
+    for (char32_t cp = 0xA0; cp <= max_code_point; ++cp) {
+        const std::string& gc = category[cp];
+        const bool zero = cp != 0xAD && (gc == "Mn" || gc == "Me" || gc == "Cf"
+            || (cp >= 0x1160 && cp <= 0x11FF) || (cp >= 0xD7B0 && cp <= 0xD7FF) || cp == 0x200B);
+        if (zero)
+            tables.combining.add(cp, cp);
+        else if (east_asian[cp] == 'W' || east_asian[cp] == 'F')
+            tables.wide.add(cp, cp);
+        else if (east_asian[cp] == 'A' && gc != "Cf")
+            tables.ambiguous.add(cp, cp);
+        if (!zero && emoji[cp] && east_asian[cp] != 'W' && east_asian[cp] != 'F')
+            tables.emoji.add(cp, cp);
+    }
+    return true;
+}
+
+static void against_old_lookup(const char* ucd)
+{
+    old_tables tables;
+    if (!DBJ_CHECK(load(ucd, tables)))
+        return;
+    DBJ_CHECK(tables.combining.size() > 100 && tables.wide.size() > 50 && tables.ambiguous.size() > 50);
+
+    for (char32_t cp = 0; cp <= max_code_point; ++cp) {
+        bool same = dbj_wcwidth(cp) == old_wcwidth(tables, cp, 0)
+            && dbj_wcwidth_cjk(cp) == old_wcwidth(tables, cp, DBJ_WCWIDTH_PROFILE_CJK);
+        for (int profile : profiles)
+            same = same && dbj_wcwidth_ex(cp, profile) == old_wcwidth(tables, cp, profile);
+        if (!DBJ_CHECK(same))
+            fprintf(stderr, "    U+%04X: %d, the old lookup %d\n", unsigned(cp), dbj_wcwidth(cp), old_wcwidth(tables, cp, 0));
+        if (dbj::utf::test::failures > 32)
+            break;
+    }
+}
+
+/*
+the well formed sequences of the table 3-7 of the Unicode standard,
+anything else is one U+FFFD for each byte
+*/
+static std::u32string decoded(const std::string& text)
+{
+    const unsigned char* s = reinterpret_cast<const unsigned char*>(text.data());
+    std::u32string out;
+    for (size_t j = 0; j < text.size();) {
+        const unsigned char b = s[j];
+        size_t length = 0;
+        unsigned char low = 0x80, high = 0xBF;
+        if (b < 0x80) length = 1;
+        else if (b >= 0xC2 && b <= 0xDF) length = 2;
+        else if (b == 0xE0) length = 3, low = 0xA0;
+        else if (b >= 0xE1 && b <= 0xEC) length = 3;
+        else if (b == 0xED) length = 3, high = 0x9F;
+        else if (b >= 0xEE && b <= 0xEF) length = 3;
+        else if (b == 0xF0) length = 4, low = 0x90;
+        else if (b >= 0xF1 && b <= 0xF3) length = 4;
+        else if (b == 0xF4) length = 4, high = 0x8F;
+
+        bool legal = length && text.size() - j >= length;
+        for (size_t k = 1; legal && k < length; ++k)
+            legal = s[j + k] >= (k == 1 ? low : 0x80) && s[j + k] <= (k == 1 ? high : 0xBF);
+        if (!legal) {
+            out += char32_t(0xFFFD);
+            ++j;
+            continue;
+        }
+        char32_t cp = length == 1 ? b : length == 2 ? b & 0x1F : length == 3 ? b & 0x0F : b & 0x07;
+        for (size_t k = 1; k < length; ++k)
+            cp = (cp << 6) | (s[j + k] & 0x3F);
+        out += cp;
+        j += length;
+    }
+    return out;
+}
+
+static std::u32string decoded(const std::u16string& text)
+{
+    std::u32string out;
+    for (size_t j = 0; j < text.size(); ++j) {
+        const char32_t unit = text[j];
+        if (unit >= 0xD800 && unit <= 0xDBFF && j + 1 < text.size() && text[j + 1] >= 0xDC00 && text[j + 1] <= 0xDFFF)
+            out += 0x10000 + ((unit - 0xD800) << 10) + (text[++j] - 0xDC00);
+        else
+            out += unit;
+    }
+    return out;
+}
+
+static void encode(char32_t cp, std::string& utf8, std::u16string& utf16)
+{
+    if (cp < 0x80)
+        utf8 += char(cp);
+    else if (cp < 0x800)
+        utf8 += char(0xC0 | cp >> 6), utf8 += char(0x80 | (cp & 0x3F));
+    else if (cp < 0x10000)
+        utf8 += char(0xE0 | cp >> 12), utf8 += char(0x80 | (cp >> 6 & 0x3F)), utf8 += char(0x80 | (cp & 0x3F));
+    else
+        utf8 += char(0xF0 | cp >> 18), utf8 += char(0x80 | (cp >> 12 & 0x3F)),
+            utf8 += char(0x80 | (cp >> 6 & 0x3F)), utf8 += char(0x80 | (cp & 0x3F));
+
+    if (cp < 0x10000)
+        utf16 += char16_t(cp);
+    else
+        utf16 += char16_t(0xD800 + ((cp - 0x10000) >> 10)), utf16 += char16_t(0xDC00 + (cp & 0x3FF));
+}
+
+// long runs of printable ASCII for the SSE2 path, the rest of every kind
+static char32_t random_code_point(dbj::utf::test::random& rng)
+{
+    static const char32_t some[] = { 0x00A1, 0x00AD, 0x00E9, 0x0301, 0x1100, 0x1160, 0x200B, 0x200D,
+        0x2194, 0x263A, 0x4E2D, 0xAC00, 0xFF21, 0xFFFD, 0x1F600, 0x20000 };
+    switch (rng.below(8)) {
+    case 0: return rng.below(0x20);
+    case 1: return rng.below(3) ? some[rng.below(16)] : 0x7F + rng.below(0x21);
+    case 2: {
+        const char32_t cp = 0x80 + rng.below(0x110000 - 0x80 - 0x800);
+        return cp < 0xD800 ? cp : cp + 0x800;
+    }
+    default: return 0x20 + rng.below(0x5F);
+    }
+}
+
+static void strings(dbj::utf::test::random& rng)
+{
+    static const unsigned char odd[] = { 0x80, 0xBF, 0xC0, 0xC1, 0xC3, 0xE0, 0xED, 0xF0, 0xF4, 0xF5, 0xFF };
+    for (int round = 0; round < 20000 && !dbj::utf::test::failures; ++round) {
+        std::string text8;
+        std::u16string text16;
+        // controls rarely, for the text to be measured to the end mostly
+        const bool controls = round % 4 == 0;
+        for (size_t n = rng.below(round % 10 ? 60 : 600); n; --n) {
+            char32_t cp = random_code_point(rng);
+            if (!controls && (cp < 0x20 || (cp >= 0x7F && cp < 0xA0)))
+                cp = U'x';
+            if (cp == 0 && rng.below(4))
+                cp = U'y';
+            encode(cp, text8, text16);
+            if (!rng.below(30))
+                text8 += char(odd[rng.below(sizeof(odd))]);
+            if (!rng.below(30))
+                text16 += char16_t(0xD800 + rng.below(0x800));
+        }
+        // any start, for the unaligned loads, any end
+        const size_t from8 = rng.below(uint32_t(text8.size() + 1)), from16 = rng.below(uint32_t(text16.size() + 1));
+        const std::string part8 = rng.below(2) ? text8 : text8.substr(from8, rng.below(uint32_t(text8.size() + 1)));
+        const std::u16string part16 = rng.below(2) ? text16 : text16.substr(from16, rng.below(uint32_t(text16.size() + 1)));
+        const std::u32string expected8 = decoded(part8), expected16 = decoded(part16);
+
+        for (int profile : profiles) {
+            const int width8 = dbj_wcswidth_utf8_ex(part8.data(), part8.size(), profile);
+            const int width16 = dbj_wcswidth_utf16_ex(part16.data(), part16.size(), profile);
+            DBJ_CHECK(width8 == dbj_wcswidth_ex(expected8.data(), expected8.size(), profile));
+            DBJ_CHECK(width16 == dbj_wcswidth_ex(expected16.data(), expected16.size(), profile));
+        }
+        DBJ_CHECK(dbj_wcswidth_utf8(part8.data(), part8.size()) == dbj_wcswidth(expected8.data(), expected8.size()));
+        DBJ_CHECK(dbj_wcswidth_utf16(part16.data(), part16.size()) == dbj_wcswidth(expected16.data(), expected16.size()));
+        if (!controls)
+            DBJ_CHECK(dbj_wcswidth_utf8(part8.data(), part8.size()) >= 0);
+    }
+
+    // the documented cases
+    DBJ_CHECK(dbj_wcswidth_utf8("a\xE4\xB8\xAD" "b", 5) == 4);
+    DBJ_CHECK(dbj_wcswidth_utf8("\xE0\x80\x80", 3) == 3 && dbj_wcswidth_utf8("\xF0\x9F\x98", 3) == 3);
+    DBJ_CHECK(dbj_wcswidth_utf8("\xED\xA0\x80", 3) == 3 && dbj_wcswidth_utf8("\xF4\x90\x80\x80", 4) == 4);
+    DBJ_CHECK(dbj_wcswidth_utf8("abcdefghijklmnopqrs\0tuv", 23) == 19 && dbj_wcswidth_utf8("abc", 2) == 2);
+    DBJ_CHECK(dbj_wcswidth_utf8("abcdefghijklmnopqrs\ttuv", 23) == -1 && dbj_wcswidth_utf8("", 0) == 0);
+    const char16_t lone[] = { u'a', 0xD800, u'b', 0xDC00 }, pair[] = { 0xD83D, 0xDE00, 0 };
+    DBJ_CHECK(dbj_wcswidth_utf16(lone, 4) == 2 + 2 * dbj_wcwidth(0xD800) && dbj_wcswidth_utf16(pair, 3) == 2);
+    DBJ_CHECK(dbj_wcswidth_utf16(pair, 1) == dbj_wcwidth(0xD83D));
+}
+
+// each profile widens its own characters only, none narrows
+static void width_profiles()
+{
+    const int cjk = DBJ_WCWIDTH_PROFILE_CJK, emoji = DBJ_WCWIDTH_PROFILE_EMOJI;
+    // ambiguous
+    DBJ_CHECK(dbj_wcwidth(0x00A1) == 1 && dbj_wcwidth_cjk(0x00A1) == 2 && dbj_wcwidth_ex(0x00A1, emoji) == 1);
+    DBJ_CHECK(dbj_wcwidth_ex(0x03B1, cjk) == 2 && dbj_wcwidth_ex(0x2500, cjk) == 2 && dbj_wcwidth_ex(0xFFFD, cjk) == 2);
+    // emoji in the text presentation
+    DBJ_CHECK(dbj_wcwidth(0x00A9) == 1 && dbj_wcwidth_cjk(0x00A9) == 1 && dbj_wcwidth_ex(0x00A9, emoji) == 2);
+    DBJ_CHECK(dbj_wcwidth(0x2122) == 1 && dbj_wcwidth_ex(0x2122, emoji) == 2);
+    // both
+    DBJ_CHECK(dbj_wcwidth(0x2194) == 1 && dbj_wcwidth_cjk(0x2194) == 2 && dbj_wcwidth_ex(0x2194, emoji) == 2);
+    DBJ_CHECK(dbj_wcwidth_ex(0x00AE, cjk | emoji) == 2);
+    // format characters are never widened, U+00AD is ambiguous and a format character
+    DBJ_CHECK(dbj_wcwidth_cjk(0x00AD) == 1 && dbj_wcwidth_ex(0x00AD, cjk | emoji) == 1);
+    DBJ_CHECK(dbj_wcwidth_ex(0x200D, cjk | emoji) == 0 && dbj_wcwidth_ex(0xFE0F, cjk | emoji) == 0);
+    // ASCII keycap bases are Emoji, stay 1
+    DBJ_CHECK(dbj_wcwidth_ex(U'#', cjk | emoji) == 1 && dbj_wcwidth_ex(U'0', emoji) == 1);
+
+    for (int profile : profiles) {
+        DBJ_CHECK(dbj_wcwidth_ex(0, profile) == 0 && dbj_wcwidth_ex(0x1B, profile) == -1 && dbj_wcwidth_ex(0x85, profile) == -1);
+        DBJ_CHECK(dbj_wcwidth_ex(0x0301, profile) == 0 && dbj_wcwidth_ex(0x4E2D, profile) == 2 && dbj_wcwidth_ex(0x1F600, profile) == 2);
+        DBJ_CHECK(dbj_wcwidth_ex(U'a', profile) == 1 && dbj_wcwidth_ex(0x110000, profile) == 1);
+    }
+    // unknown bits are ignored
+    DBJ_CHECK(dbj_wcwidth_ex(0x00A1, 0x100) == 1 && dbj_wcwidth_ex(0x00A1, 0x100 | cjk) == 2);
+
+    // the strings
+    const char32_t text[] = { U'a', 0x00A1, 0x00A9, 0x2194, 0x4E2D, 0x0301 };
+    DBJ_CHECK(dbj_wcswidth(text, 6) == 6 && dbj_wcswidth_cjk(text, 6) == 8 && dbj_wcswidth_ex(text, 6, cjk) == 8);
+    DBJ_CHECK(dbj_wcswidth_ex(text, 6, emoji) == 8 && dbj_wcswidth_ex(text, 6, cjk | emoji) == 9);
+    const char utf8[] = "a\xC2\xA1\xC2\xA9\xE2\x86\x94\xE4\xB8\xAD\xCC\x81";
+    const char16_t utf16[] = { u'a', 0x00A1, 0x00A9, 0x2194, 0x4E2D, 0x0301 };
+    DBJ_CHECK(dbj_wcswidth_utf8_ex(utf8, sizeof(utf8) - 1, cjk | emoji) == 9 && dbj_wcswidth_utf16_ex(utf16, 6, cjk) == 8);
+}
+
+static void spot_checks()
+{
+    DBJ_CHECK(dbj_wcwidth(0) == 0);
+    DBJ_CHECK(dbj_wcwidth(U'a') == 1 && dbj_wcwidth(U'~') == 1);
+    DBJ_CHECK(dbj_wcwidth(0x01) == -1 && dbj_wcwidth(0x7F) == -1 && dbj_wcwidth(0x9F) == -1);
+    DBJ_CHECK(dbj_wcwidth(0x00A0) == 1 && dbj_wcwidth(0x00AD) == 1);
+    // combining, format, conjoining jamo, zero width space
+    DBJ_CHECK(dbj_wcwidth(0x0301) == 0 && dbj_wcwidth(0x20DD) == 0 && dbj_wcwidth(0x200D) == 0);
+    DBJ_CHECK(dbj_wcwidth(0x1160) == 0 && dbj_wcwidth(0x11FF) == 0 && dbj_wcwidth(0xD7B0) == 0 && dbj_wcwidth(0x200B) == 0);
+    // wide and full width
+    DBJ_CHECK(dbj_wcwidth(0x1100) == 2 && dbj_wcwidth(0x4E2D) == 2 && dbj_wcwidth(0xAC00) == 2 && dbj_wcwidth(0xFF21) == 2);
+    DBJ_CHECK(dbj_wcwidth(0x1F600) == 2 && dbj_wcwidth(0x20000) == 2 && dbj_wcwidth(0x3FFFD) == 2);
+    // unassigned CJK is wide, unassigned elsewhere is 1
+    DBJ_CHECK(dbj_wcwidth(0x9FFF) == 2 && dbj_wcwidth(0x2FFFD) == 2 && dbj_wcwidth(0x0378) == 1);
+    // half width, not in Unicode
+    DBJ_CHECK(dbj_wcwidth(0xFF61) == 1 && dbj_wcwidth(0x110000) == 1 && dbj_wcwidth(0xFFFFFFFF) == 1);
+}
+
+int main(int argc, char** argv)
+{
+    dbj::utf::test::random rng;
+    spot_checks();
+    against_kuhn_2007();
+    width_profiles();
+    strings(rng);
+    if (argc > 1)
+        against_old_lookup(argv[1]);
+    return DBJ_TEST_RESULT;
+}
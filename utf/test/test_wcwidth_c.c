@@ -0,0 +1,33 @@
+/*
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+dbj_wcwidth.h included from C, first and alone: the header brings what
+it needs, the profiles are usable from C
+*/
+#include "../dbj_wcwidth.h"
+
+#include <stdio.h>
+
+static int failures = 0;
+
+#define DBJ_C_CHECK(x) ((x) ? 1 : (fprintf(stderr, "%s(%d): failed: %s\n", __FILE__, __LINE__, #x), ++failures, 0))
+
+int main(void)
+{
+    const char32_t text[] = { 'a', 0x00A1, 0x4E2D };
+    const char16_t text16[] = { 'a', 0x00A1, 0x4E2D };
+    const int profile = DBJ_WCWIDTH_PROFILE_CJK | DBJ_WCWIDTH_PROFILE_EMOJI;
+
+    DBJ_C_CHECK(dbj_wcwidth('a') == 1 && dbj_wcwidth(0x4E2D) == 2 && dbj_wcwidth(0x0301) == 0);
+    DBJ_C_CHECK(dbj_wcwidth_cjk(0x00A1) == 2 && dbj_wcwidth_cjk(0x00AD) == 1);
+    DBJ_C_CHECK(dbj_wcwidth_ex(0x00A9, DBJ_WCWIDTH_PROFILE_EMOJI) == 2 && dbj_wcwidth_ex(0x00A9, DBJ_WCWIDTH_PROFILE_DEFAULT) == 1);
+    DBJ_C_CHECK(dbj_wcswidth(text, 3) == 4 && dbj_wcswidth_cjk(text, 3) == 5 && dbj_wcswidth_ex(text, 3, profile) == 5);
+    DBJ_C_CHECK(dbj_wcswidth_utf8("a\xC2\xA1\xE4\xB8\xAD", 6) == 4 && dbj_wcswidth_utf8_ex("a\xC2\xA1", 3, profile) == 3);
+    DBJ_C_CHECK(dbj_wcswidth_utf16(text16, 3) == 4 && dbj_wcswidth_utf16_ex(text16, 3, profile) == 5);
+
+    if (failures)
+        fprintf(stderr, "%s: %d checks failed\n", __FILE__, failures);
+    else
+        printf("%s: OK\n", __FILE__);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,416 @@
+#!/usr/bin/env python3
+"""
+(c) 2020 by dbj@dbj.org, licence CC BY SA 4.0
+
+Offline generator of the dbj utf lookup tables.
+
+Reads the local copy of the Unicode Character Database text files
+and writes the generated headers next to the utf sources.
+Nothing in here is needed at build time, the generated headers are
+committed. Rerun only when moving to the new Unicode version.
+
+usage:
+
+    python3 dbj_ucd_gen.py <ucd folder> [<output folder>]
+
+output folder is by default the parent of this tools folder, ie. utf/
+
+UCD files used:
+
+    DerivedGeneralCategory.txt
+    Scripts.txt
+    DerivedCoreProperties.txt  (Alphabetic)
+    PropList.txt               (White_Space)
+    GraphemeBreakProperty.txt
+    EastAsianWidth.txt
+    emoji-data.txt             (Extended_Pictographic, Emoji)
+
+All the tables are multi stage tries. Code point is split into
+three parts, each part indexing one stage:
+
+    value = stage3[ stage2[ stage1[cp >> (s2+s3)] << s2 | (cp >> s3) & mask2 ] << s3 | cp & mask3 ]
+
+The split (s2,s3) is chosen by brute force, so that the total size
+of the three arrays is minimal. Identical blocks are stored once.
+
+dbj_wcwidth_tables.h is C and has two stages, so that dbj_wcwidth is
+two loads. Widths follow the rules of Markus Kuhn's wcwidth.c, on the
+current EastAsianWidth.txt and DerivedGeneralCategory.txt.
+"""
+
+import os
+import re
+import sys
+
+MAX_CP = 0x110000
+
+# ---------------------------------------------------------------------------
+# UCD parsing
+
+
+def ucd_version(path):
+    with open(path, encoding="utf-8") as f:
+        first = f.readline()
+    m = re.search(r"-(\d+\.\d+\.\d+)\.txt", first)
+    return m.group(1) if m else "unknown"
+
+
+def ucd_ranges(path):
+    """yield (first, last, value) for every data line of the UCD file"""
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            fields = [x.strip() for x in line.split(";")]
+            first, _, last = fields[0].partition("..")
+            first = int(first, 16)
+            last = int(last, 16) if last else first
+            yield first, last, fields[1]
+
+
+def ucd_map(path, default):
+    """full code point -> property value map"""
+    values = [default] * MAX_CP
+    for first, last, value in ucd_ranges(path):
+        for cp in range(first, min(last, MAX_CP - 1) + 1):
+            values[cp] = value
+    return values
+
+
+def ucd_set(path, property_name):
+    """binary property -> list of bools"""
+    values = [False] * MAX_CP
+    for first, last, value in ucd_ranges(path):
+        if value == property_name:
+            for cp in range(first, min(last, MAX_CP - 1) + 1):
+                values[cp] = True
+    return values
+
+
+# ---------------------------------------------------------------------------
+# multi stage trie
+
+
+def c_uint(max_value):
+    if max_value < 0x100:
+        return "uint8_t", 1
+    if max_value < 0x10000:
+        return "uint16_t", 2
+    return "uint32_t", 4
+
+
+def dedup_blocks(values, block_size):
+    blocks = {}
+    index = []
+    data = []
+    for i in range(0, len(values), block_size):
+        block = tuple(values[i:i + block_size])
+        at = blocks.get(block)
+        if at is None:
+            at = len(blocks)
+            blocks[block] = at
+            data.extend(block)
+        index.append(at)
+    return index, data
+
+
+class Trie:
+    def __init__(self, values):
+        leaf_type, leaf_size = c_uint(max(values))
+        best = None
+        for s3 in range(2, 9):
+            mid, leaves = dedup_blocks(values, 1 << s3)
+            for s2 in range(2, 9):
+                if len(mid) % (1 << s2):
+                    continue
+                top, mids = dedup_blocks(mid, 1 << s2)
+                size = (len(top) * c_uint(max(top))[1]
+                        + len(mids) * c_uint(max(mids))[1]
+                        + len(leaves) * leaf_size)
+                if best is None or size < best[0]:
+                    best = (size, s2, s3, top, mids, leaves)
+        self.size, self.s2, self.s3, self.stage1, self.stage2, self.stage3 = best
+        self.leaf_type = leaf_type
+
+    def lookup(self, cp):
+        m2 = (1 << self.s2) - 1
+        m3 = (1 << self.s3) - 1
+        i2 = (self.stage1[cp >> (self.s2 + self.s3)] << self.s2) | ((cp >> self.s3) & m2)
+        return self.stage3[(self.stage2[i2] << self.s3) | (cp & m3)]
+
+
+# ---------------------------------------------------------------------------
+# emitting
+
+
+def c_array(out, qualifier, name, ctype, values, per_line=16):
+    out.append("%s %s %s[%d] = {" % (qualifier, ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        out.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    out.append("};")
+    out.append("")
+
+
+def emit_trie(out, qualifier, prefix, trie):
+    out.append("%s unsigned %s_shift2 = %d;" % (qualifier, prefix, trie.s2))
+    out.append("%s unsigned %s_shift3 = %d;" % (qualifier, prefix, trie.s3))
+    out.append("")
+    c_array(out, qualifier, prefix + "_stage1", c_uint(max(trie.stage1))[0], trie.stage1)
+    c_array(out, qualifier, prefix + "_stage2", c_uint(max(trie.stage2))[0], trie.stage2)
+    c_array(out, qualifier, prefix + "_stage3", trie.leaf_type, trie.stage3)
+
+
+def header_begin(guard, version, what):
+    return [
+        "#pragma once",
+        "#ifndef %s" % guard,
+        "#define %s" % guard,
+        "/*",
+        "    GENERATED by utf/tools/dbj_ucd_gen.py -- do not edit",
+        "    Unicode %s" % version,
+        "",
+        "    %s" % what,
+        "*/",
+        "#include <stdint.h>",
+        "",
+    ]
+
+
+def header_end(out, guard):
+    out.append("#endif // !%s" % guard)
+    out.append("")
+
+
+def write(path, lines):
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines))
+    print("written:", path)
+
+
+# ---------------------------------------------------------------------------
+# utf/dbj_utf_property_tables.h
+
+# bit layout of the property record, must match dbj_utf_property.h
+PROP_GC_BITS = 5
+PROP_SCRIPT_SHIFT = 5
+PROP_SCRIPT_BITS = 8
+PROP_ALPHABETIC = 1 << 13
+PROP_WHITE_SPACE = 1 << 14
+
+# UCD order, not alphabetical
+GENERAL_CATEGORIES = [
+    "Lu", "Ll", "Lt", "Lm", "Lo",
+    "Mn", "Mc", "Me",
+    "Nd", "Nl", "No",
+    "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po",
+    "Sm", "Sc", "Sk", "So",
+    "Zs", "Zl", "Zp",
+    "Cc", "Cf", "Cs", "Co", "Cn",
+]
+
+
+def gen_property_tables(ucd, out_dir):
+    version = ucd_version(os.path.join(ucd, "DerivedGeneralCategory.txt"))
+    gc = ucd_map(os.path.join(ucd, "DerivedGeneralCategory.txt"), "Cn")
+    sc = ucd_map(os.path.join(ucd, "Scripts.txt"), "Unknown")
+    alpha = ucd_set(os.path.join(ucd, "DerivedCoreProperties.txt"), "Alphabetic")
+    white = ucd_set(os.path.join(ucd, "PropList.txt"), "White_Space")
+
+    # Unknown, Common and Inherited first, the rest alphabetical
+    specials = ["Unknown", "Common", "Inherited"]
+    scripts = specials + sorted(set(sc) - set(specials))
+    assert len(GENERAL_CATEGORIES) < (1 << PROP_GC_BITS)
+    assert len(scripts) < (1 << PROP_SCRIPT_BITS)
+
+    gc_index = {g: i for i, g in enumerate(GENERAL_CATEGORIES)}
+    sc_index = {s: i for i, s in enumerate(scripts)}
+
+    values = [
+        gc_index[gc[cp]]
+        | (sc_index[sc[cp]] << PROP_SCRIPT_SHIFT)
+        | (PROP_ALPHABETIC if alpha[cp] else 0)
+        | (PROP_WHITE_SPACE if white[cp] else 0)
+        for cp in range(MAX_CP)
+    ]
+    trie = Trie(values)
+    for cp in range(MAX_CP):
+        assert trie.lookup(cp) == values[cp]
+
+    guard = "DBJ_UTF_PROPERTY_TABLES_INC"
+    out = header_begin(guard, version,
+                       "general category, script, alphabetic and white space\n"
+                       "    packed in one 16 bit record per code point, %d bytes in total" % trie.size)
+    out.append("namespace dbj::utf {")
+    out.append("")
+    out.append("    enum class general_category : uint8_t {")
+    for i in range(0, len(GENERAL_CATEGORIES), 10):
+        out.append("        " + ", ".join(GENERAL_CATEGORIES[i:i + 10]) + ",")
+    out.append("    };")
+    out.append("")
+    out.append("    enum class script : uint8_t {")
+    for i in range(0, len(scripts), 6):
+        out.append("        " + ", ".join(scripts[i:i + 6]) + ",")
+    out.append("    };")
+    out.append("")
+    out.append("    inline constexpr unsigned script_count = %d;" % len(scripts))
+    out.append("")
+    out.append("    namespace detail {")
+    out.append("")
+    body = []
+    emit_trie(body, "inline constexpr", "property", trie)
+    c_array(body, "inline constexpr", "script_names", "const char*",
+            ['"%s"' % s for s in scripts], per_line=6)
+    out.extend(("        " + line) if line else line for line in body)
+    out.append("    } // detail")
+    out.append("} // dbj::utf")
+    out.append("")
+    header_end(out, guard)
+    write(os.path.join(out_dir, "dbj_utf_property_tables.h"), out)
+
+
+# ---------------------------------------------------------------------------
+# utf/dbj_utf_grapheme_tables.h
+
+# must match dbj::utf::grapheme_class
+GRAPHEME_CLASSES = [
+    "Other", "CR", "LF", "Control", "Extend", "ZWJ", "Regional_Indicator",
+    "Prepend", "SpacingMark", "L", "V", "T", "LV", "LVT",
+    "Extended_Pictographic",
+]
+
+
+def gen_grapheme_tables(ucd, out_dir):
+    version = ucd_version(os.path.join(ucd, "GraphemeBreakProperty.txt"))
+    gcb = ucd_map(os.path.join(ucd, "GraphemeBreakProperty.txt"), "Other")
+    pict = ucd_set(os.path.join(ucd, "emoji-data.txt"), "Extended_Pictographic")
+
+    index = {g: i for i, g in enumerate(GRAPHEME_CLASSES)}
+    values = []
+    for cp in range(MAX_CP):
+        if pict[cp]:
+            # Extended_Pictographic are all Grapheme_Cluster_Break=Other
+            assert gcb[cp] == "Other", hex(cp)
+            values.append(index["Extended_Pictographic"])
+        else:
+            values.append(index[gcb[cp]])
+    trie = Trie(values)
+    for cp in range(MAX_CP):
+        assert trie.lookup(cp) == values[cp]
+
+    guard = "DBJ_UTF_GRAPHEME_TABLES_INC"
+    out = header_begin(guard, version,
+                       "Grapheme_Cluster_Break property with Extended_Pictographic folded in\n"
+                       "    as one more class, %d bytes in total" % trie.size)
+    out.append("namespace dbj::utf::detail {")
+    out.append("")
+    body = []
+    emit_trie(body, "inline constexpr", "grapheme", trie)
+    out.extend(("    " + line) if line else line for line in body)
+    out.append("} // dbj::utf::detail")
+    out.append("")
+    header_end(out, guard)
+    write(os.path.join(out_dir, "dbj_utf_grapheme_tables.h"), out)
+
+
+# ---------------------------------------------------------------------------
+# utf/dbj_wcwidth_tables.h
+
+# bit layout of the width record, wcwidth.c depends on it
+WIDTH_MASK = 3          # width + 1, 0 .. 3
+WIDTH_AMBIGUOUS = 4     # East Asian Ambiguous, 2 columns for the CJK profile
+WIDTH_EMOJI = 8         # Emoji in text presentation, 2 columns for the emoji profile
+
+
+def wcwidth_of(cp, gc, eaw):
+    """the rules of Markus Kuhn's wcwidth, on the current UCD"""
+    if cp == 0:
+        return 0
+    if cp < 0x20 or 0x7F <= cp < 0xA0:
+        return -1
+    # SOFT HYPHEN is Cf, but it is printed
+    if cp == 0xAD:
+        return 1
+    # medial vowels and final consonants of the conjoining jamo
+    if gc in ("Mn", "Me", "Cf") or 0x1160 <= cp <= 0x11FF or 0xD7B0 <= cp <= 0xD7FF or cp == 0x200B:
+        return 0
+    if eaw in ("W", "F"):
+        return 2
+    return 1
+
+
+class TwoStage:
+    """value = stage2[ stage1[cp >> shift] << shift | cp & mask ], two loads"""
+
+    def __init__(self, values):
+        best = None
+        for shift in range(4, 11):
+            top, leaves = dedup_blocks(values, 1 << shift)
+            size = len(top) * c_uint(max(top))[1] + len(leaves)
+            if best is None or size < best[0]:
+                best = (size, shift, top, leaves)
+        self.size, self.shift, self.stage1, self.stage2 = best
+
+    def lookup(self, cp):
+        return self.stage2[(self.stage1[cp >> self.shift] << self.shift) | (cp & ((1 << self.shift) - 1))]
+
+
+def gen_wcwidth_tables(ucd, out_dir):
+    version = ucd_version(os.path.join(ucd, "EastAsianWidth.txt"))
+    gc = ucd_map(os.path.join(ucd, "DerivedGeneralCategory.txt"), "Cn")
+    eaw = ucd_map(os.path.join(ucd, "EastAsianWidth.txt"), "N")
+    emoji = ucd_set(os.path.join(ucd, "emoji-data.txt"), "Emoji")
+    # unassigned code points of the CJK blocks and planes are W (@missing lines)
+    for first, last in ((0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF), (0x20000, 0x2FFFD), (0x30000, 0x3FFFD)):
+        for cp in range(first, last + 1):
+            if gc[cp] == "Cn":
+                eaw[cp] = "W"
+
+    values = []
+    for cp in range(MAX_CP):
+        width = wcwidth_of(cp, gc[cp], eaw[cp])
+        value = width + 1
+        # format chars are not drawn, not even U+00AD forced to 1 above
+        if width == 1 and eaw[cp] == "A" and gc[cp] != "Cf":
+            value |= WIDTH_AMBIGUOUS
+        # not the ASCII keycap bases, # * 0 .. 9
+        if width == 1 and emoji[cp] and cp >= 0x80:
+            value |= WIDTH_EMOJI
+        values.append(value)
+    table = TwoStage(values)
+    for cp in range(MAX_CP):
+        assert table.lookup(cp) == values[cp]
+
+    guard = "DBJ_WCWIDTH_TABLES_INC"
+    out = header_begin(guard, version,
+                       "dbj_wcwidth, one byte per code point, %d bytes in total\n"
+                       "    width + 1 in the low two bits, and the ambiguous and emoji flags\n"
+                       "    C, included by wcwidth.c only" % table.size)
+    out.append("#define DBJ_WCWIDTH_SHIFT %d" % table.shift)
+    out.append("#define DBJ_WCWIDTH_MASK %d" % WIDTH_MASK)
+    out.append("#define DBJ_WCWIDTH_AMBIGUOUS %d" % WIDTH_AMBIGUOUS)
+    out.append("#define DBJ_WCWIDTH_EMOJI %d" % WIDTH_EMOJI)
+    out.append("")
+    c_array(out, "static const", "dbj_wcwidth_stage1", c_uint(max(table.stage1))[0], table.stage1)
+    c_array(out, "static const", "dbj_wcwidth_stage2", "uint8_t", table.stage2, per_line=32)
+    header_end(out, guard)
+    write(os.path.join(out_dir, "dbj_wcwidth_tables.h"), out)
+
+
+# ---------------------------------------------------------------------------
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+    ucd = argv[1]
+    out_dir = argv[2] if len(argv) > 2 else os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    gen_property_tables(ucd, out_dir)
+    gen_grapheme_tables(ucd, out_dir)
+    gen_wcwidth_tables(ucd, out_dir)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -61,37 +61,15 @@
 
 #include <wchar.h>
 
- // NOTE! must match  line_noise_convert.h 
-#if !defined __cplusplus || (defined _MSC_VER && _MSC_VER < 1900)
-typedef unsigned short char16_t;
-typedef unsigned int char32_t;
-#endif
-
-struct interval {
-    char32_t first;
-    char32_t last;
-};
-
-/* auxiliary function for binary search in interval table */
-static int bisearch(char32_t ucs, const struct interval* table, int max) {
-    int min = 0;
-    int mid;
-
-    if (ucs < table[0].first || ucs > table[max].last)
-        return 0;
-    while (max >= min) {
-        mid = (min + max) / 2;
-        if (ucs > table[mid].last)
-            min = mid + 1;
-        else if (ucs < table[mid].first)
-            max = mid - 1;
-        else
-            return 1;
-    }
-
-    return 0;
-}
+/* char16_t and char32_t come with it */
+#include "dbj_wcwidth.h"
+#include "dbj_wcwidth_tables.h"
 
+/* as in dbj_utf_simd.h */
+#if !defined(DBJ_UTF_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define DBJ_WCWIDTH_SSE2 1
+#include <emmintrin.h>
+#endif
 
 /* The following two functions define the column width of an ISO 10646
  * character as follows:
@@ -110,8 +88,8 @@ static int bisearch(char32_t ucs, const struct interval* table, int max) {
  *    - Other format characters (general category code Cf in the Unicode
  *      database) and ZERO WIDTH SPACE (U+200B) have a column width of 0.
  *
- *    - Hangul Jamo medial vowels and final consonants (U+1160-U+11FF)
- *      have a column width of 0.
+ *    - Hangul Jamo medial vowels and final consonants (U+1160-U+11FF,
+ *      U+D7B0-U+D7FF) have a column width of 0.
  *
  *    - Spacing characters in the East Asian Wide (W) or East Asian
  *      Full-width (F) category as defined in Unicode Technical
@@ -123,99 +101,76 @@ static int bisearch(char32_t ucs, const struct interval* table, int max) {
  *
  * This implementation assumes that wchar_t characters are encoded
  * in ISO 10646.
+ *
+ * DBJ: the categories come from the Unicode Character Database, through
+ * the table generated by utf/tools/dbj_ucd_gen.py (dbj_wcwidth_tables.h).
+ *
+ * The _ex variants take the profile, a combination of:
+ *
+ *    - DBJ_WCWIDTH_PROFILE_CJK: East Asian Ambiguous (A) characters
+ *      have a column width of 2, as in the CJK legacy encodings.
+ *
+ *    - DBJ_WCWIDTH_PROFILE_EMOJI: Emoji with the default text
+ *      presentation have a column width of 2, as the terminals showing
+ *      every emoji in color do. ASCII keycap bases (# * 0-9) stay 1.
+ *
+ * The table record carries both flags next to the width, the profile
+ * costs one AND per code point, not another lookup.
  */
 
+/* profile bits are the record flags shifted down by 2 */
+#define DBJ_WCWIDTH_PROFILE_SHIFT 2
+/* fails to compile if the profile bits do not match dbj_wcwidth_tables.h */
+typedef char dbj_wcwidth_profile_check[
+    (DBJ_WCWIDTH_PROFILE_CJK << DBJ_WCWIDTH_PROFILE_SHIFT) == DBJ_WCWIDTH_AMBIGUOUS
+    && (DBJ_WCWIDTH_PROFILE_EMOJI << DBJ_WCWIDTH_PROFILE_SHIFT) == DBJ_WCWIDTH_EMOJI ? 1 : -1];
+
+static unsigned width_record(char32_t ucs)
+{
+    /* not in Unicode, width 1 */
+    if (ucs >= 0x110000)
+        return 2;
+
+    return dbj_wcwidth_stage2[
+        (dbj_wcwidth_stage1[ucs >> DBJ_WCWIDTH_SHIFT] << DBJ_WCWIDTH_SHIFT)
+            | (ucs & ((1u << DBJ_WCWIDTH_SHIFT) - 1))];
+}
+
+/* flags are the record flags selected by the profile */
+static int width_of(char32_t ucs, unsigned flags)
+{
+    const unsigned record = width_record(ucs);
+    return (record & flags) ? 2 : (int)(record & DBJ_WCWIDTH_MASK) - 1;
+}
+
+static unsigned flags_of(int profile)
+{
+    return ((unsigned)profile << DBJ_WCWIDTH_PROFILE_SHIFT) & (DBJ_WCWIDTH_AMBIGUOUS | DBJ_WCWIDTH_EMOJI);
+}
+
 int dbj_wcwidth(char32_t ucs)
 {
-    /* sorted list of non-overlapping intervals of non-spacing characters */
-    /* generated by "uniset +cat=Me +cat=Mn +cat=Cf -00AD +1160-11FF +200B c" */
-    static const struct interval combining[] = {
-      { 0x0300, 0x036F }, { 0x0483, 0x0486 }, { 0x0488, 0x0489 },
-      { 0x0591, 0x05BD }, { 0x05BF, 0x05BF }, { 0x05C1, 0x05C2 },
-      { 0x05C4, 0x05C5 }, { 0x05C7, 0x05C7 }, { 0x0600, 0x0603 },
-      { 0x0610, 0x0615 }, { 0x064B, 0x065E }, { 0x0670, 0x0670 },
-      { 0x06D6, 0x06E4 }, { 0x06E7, 0x06E8 }, { 0x06EA, 0x06ED },
-      { 0x070F, 0x070F }, { 0x0711, 0x0711 }, { 0x0730, 0x074A },
-      { 0x07A6, 0x07B0 }, { 0x07EB, 0x07F3 }, { 0x0901, 0x0902 },
-      { 0x093C, 0x093C }, { 0x0941, 0x0948 }, { 0x094D, 0x094D },
-      { 0x0951, 0x0954 }, { 0x0962, 0x0963 }, { 0x0981, 0x0981 },
-      { 0x09BC, 0x09BC }, { 0x09C1, 0x09C4 }, { 0x09CD, 0x09CD },
-      { 0x09E2, 0x09E3 }, { 0x0A01, 0x0A02 }, { 0x0A3C, 0x0A3C },
-      { 0x0A41, 0x0A42 }, { 0x0A47, 0x0A48 }, { 0x0A4B, 0x0A4D },
-      { 0x0A70, 0x0A71 }, { 0x0A81, 0x0A82 }, { 0x0ABC, 0x0ABC },
-      { 0x0AC1, 0x0AC5 }, { 0x0AC7, 0x0AC8 }, { 0x0ACD, 0x0ACD },
-      { 0x0AE2, 0x0AE3 }, { 0x0B01, 0x0B01 }, { 0x0B3C, 0x0B3C },
-      { 0x0B3F, 0x0B3F }, { 0x0B41, 0x0B43 }, { 0x0B4D, 0x0B4D },
-      { 0x0B56, 0x0B56 }, { 0x0B82, 0x0B82 }, { 0x0BC0, 0x0BC0 },
-      { 0x0BCD, 0x0BCD }, { 0x0C3E, 0x0C40 }, { 0x0C46, 0x0C48 },
-      { 0x0C4A, 0x0C4D }, { 0x0C55, 0x0C56 }, { 0x0CBC, 0x0CBC },
-      { 0x0CBF, 0x0CBF }, { 0x0CC6, 0x0CC6 }, { 0x0CCC, 0x0CCD },
-      { 0x0CE2, 0x0CE3 }, { 0x0D41, 0x0D43 }, { 0x0D4D, 0x0D4D },
-      { 0x0DCA, 0x0DCA }, { 0x0DD2, 0x0DD4 }, { 0x0DD6, 0x0DD6 },
-      { 0x0E31, 0x0E31 }, { 0x0E34, 0x0E3A }, { 0x0E47, 0x0E4E },
-      { 0x0EB1, 0x0EB1 }, { 0x0EB4, 0x0EB9 }, { 0x0EBB, 0x0EBC },
-      { 0x0EC8, 0x0ECD }, { 0x0F18, 0x0F19 }, { 0x0F35, 0x0F35 },
-      { 0x0F37, 0x0F37 }, { 0x0F39, 0x0F39 }, { 0x0F71, 0x0F7E },
-      { 0x0F80, 0x0F84 }, { 0x0F86, 0x0F87 }, { 0x0F90, 0x0F97 },
-      { 0x0F99, 0x0FBC }, { 0x0FC6, 0x0FC6 }, { 0x102D, 0x1030 },
-      { 0x1032, 0x1032 }, { 0x1036, 0x1037 }, { 0x1039, 0x1039 },
-      { 0x1058, 0x1059 }, { 0x1160, 0x11FF }, { 0x135F, 0x135F },
-      { 0x1712, 0x1714 }, { 0x1732, 0x1734 }, { 0x1752, 0x1753 },
-      { 0x1772, 0x1773 }, { 0x17B4, 0x17B5 }, { 0x17B7, 0x17BD },
-      { 0x17C6, 0x17C6 }, { 0x17C9, 0x17D3 }, { 0x17DD, 0x17DD },
-      { 0x180B, 0x180D }, { 0x18A9, 0x18A9 }, { 0x1920, 0x1922 },
-      { 0x1927, 0x1928 }, { 0x1932, 0x1932 }, { 0x1939, 0x193B },
-      { 0x1A17, 0x1A18 }, { 0x1B00, 0x1B03 }, { 0x1B34, 0x1B34 },
-      { 0x1B36, 0x1B3A }, { 0x1B3C, 0x1B3C }, { 0x1B42, 0x1B42 },
-      { 0x1B6B, 0x1B73 }, { 0x1DC0, 0x1DCA }, { 0x1DFE, 0x1DFF },
-      { 0x200B, 0x200F }, { 0x202A, 0x202E }, { 0x2060, 0x2063 },
-      { 0x206A, 0x206F }, { 0x20D0, 0x20EF }, { 0x302A, 0x302F },
-      { 0x3099, 0x309A }, { 0xA806, 0xA806 }, { 0xA80B, 0xA80B },
-      { 0xA825, 0xA826 }, { 0xFB1E, 0xFB1E }, { 0xFE00, 0xFE0F },
-      { 0xFE20, 0xFE23 }, { 0xFEFF, 0xFEFF }, { 0xFFF9, 0xFFFB },
-      { 0x10A01, 0x10A03 }, { 0x10A05, 0x10A06 }, { 0x10A0C, 0x10A0F },
-      { 0x10A38, 0x10A3A }, { 0x10A3F, 0x10A3F }, { 0x1D167, 0x1D169 },
-      { 0x1D173, 0x1D182 }, { 0x1D185, 0x1D18B }, { 0x1D1AA, 0x1D1AD },
-      { 0x1D242, 0x1D244 }, { 0xE0001, 0xE0001 }, { 0xE0020, 0xE007F },
-      { 0xE0100, 0xE01EF }
-    };
-
-    /* test for 8-bit control characters */
-    if (ucs == 0)
-        return 0;
-    if (ucs < 32 || (ucs >= 0x7f && ucs < 0xa0))
-        return -1;
-
-    /* binary search in table of non-spacing characters */
-    if (bisearch(ucs, combining,
-        sizeof(combining) / sizeof(struct interval) - 1))
-        return 0;
-
-    /* if we arrive here, ucs is not a combining or C0/C1 control character */
-
-    return 1 +
-        (ucs >= 0x1100 &&
-            (ucs <= 0x115f ||                    /* Hangul Jamo init. consonants */
-                ucs == 0x2329 || ucs == 0x232a ||
-                (ucs >= 0x2e80 && ucs <= 0xa4cf &&
-                    ucs != 0x303f) ||                  /* CJK ... Yi */
-                (ucs >= 0xac00 && ucs <= 0xd7a3) || /* Hangul Syllables */
-                (ucs >= 0xf900 && ucs <= 0xfaff) || /* CJK Compatibility Ideographs */
-                (ucs >= 0xfe10 && ucs <= 0xfe19) || /* Vertical forms */
-                (ucs >= 0xfe30 && ucs <= 0xfe6f) || /* CJK Compatibility Forms */
-                (ucs >= 0xff00 && ucs <= 0xff60) || /* Fullwidth Forms */
-                (ucs >= 0xffe0 && ucs <= 0xffe6) ||
-                (ucs >= 0x20000 && ucs <= 0x2fffd) ||
-                (ucs >= 0x30000 && ucs <= 0x3fffd)));
+    return (int)(width_record(ucs) & DBJ_WCWIDTH_MASK) - 1;
 }
 
+int dbj_wcwidth_ex(char32_t ucs, int profile)
+{
+    return width_of(ucs, flags_of(profile));
+}
 
-int dbj_wcswidth(const char32_t* pwcs, size_t n)
+int dbj_wcwidth_cjk(char32_t ucs)
+{
+    return width_of(ucs, DBJ_WCWIDTH_AMBIGUOUS);
+}
+
+
+int dbj_wcswidth_ex(const char32_t* pwcs, size_t n, int profile)
 {
+    const unsigned flags = flags_of(profile);
     int w, width = 0;
 
-    for (; *pwcs && n-- > 0; pwcs++)
-        if ((w = dbj_wcwidth(*pwcs)) < 0)
+    for (; n > 0 && *pwcs; --n, pwcs++)
+        if ((w = width_of(*pwcs, flags)) < 0)
             return -1;
         else
             width += w;
@@ -223,98 +178,188 @@ int dbj_wcswidth(const char32_t* pwcs, size_t n)
     return width;
 }
 
+int dbj_wcswidth(const char32_t* pwcs, size_t n)
+{
+    return dbj_wcswidth_ex(pwcs, n, DBJ_WCWIDTH_PROFILE_DEFAULT);
+}
+
+int dbj_wcswidth_cjk(const char32_t* pwcs, size_t n)
+{
+    return dbj_wcswidth_ex(pwcs, n, DBJ_WCWIDTH_PROFILE_CJK);
+}
 
-/*
- DBJ Excluded these on 2020 Apr 08
-*/
 
-#if 0
 /*
- * The following functions are the same as dbj_wcwidth() and
- * dbj_wcswidth(), except that spacing characters in the East Asian
- * Ambiguous (A) category as defined in Unicode Technical Report #11
- * have a column width of 2. This variant might be useful for users of
- * CJK legacy encodings who want to migrate to UCS without changing
- * the traditional terminal character-width behaviour. It is not
- * otherwise recommended for general use.
+ * The same as dbj_wcswidth(), straight on the utf8 or utf16 text, n in
+ * code units, no conversion to utf32 needed.
+ *
+ * Printable ASCII (0x20 .. 0x7E) counts one column, those are consumed 16
+ * bytes or 8 utf16 units at a time with SSE2. Only the rest is decoded
+ * and looked up. Illegal or truncated utf8 sequence is taken as one
+ * U+FFFD per byte, lone utf16 surrogate as it is.
  */
-int dbj_wcwidth_cjk(wchar_t ucs)
+
+/* printable ASCII units at the front of the next 16 bytes, 16 if all are */
+#ifdef DBJ_WCWIDTH_SSE2
+static unsigned printable_bytes(const char* s)
 {
-    /* sorted list of non-overlapping intervals of East Asian Ambiguous
-     * characters, generated by "uniset +WIDTH-A -cat=Me -cat=Mn -cat=Cf c" */
-    static const struct interval ambiguous[] = {
-      { 0x00A1, 0x00A1 }, { 0x00A4, 0x00A4 }, { 0x00A7, 0x00A8 },
-      { 0x00AA, 0x00AA }, { 0x00AE, 0x00AE }, { 0x00B0, 0x00B4 },
-      { 0x00B6, 0x00BA }, { 0x00BC, 0x00BF }, { 0x00C6, 0x00C6 },
-      { 0x00D0, 0x00D0 }, { 0x00D7, 0x00D8 }, { 0x00DE, 0x00E1 },
-      { 0x00E6, 0x00E6 }, { 0x00E8, 0x00EA }, { 0x00EC, 0x00ED },
-      { 0x00F0, 0x00F0 }, { 0x00F2, 0x00F3 }, { 0x00F7, 0x00FA },
-      { 0x00FC, 0x00FC }, { 0x00FE, 0x00FE }, { 0x0101, 0x0101 },
-      { 0x0111, 0x0111 }, { 0x0113, 0x0113 }, { 0x011B, 0x011B },
-      { 0x0126, 0x0127 }, { 0x012B, 0x012B }, { 0x0131, 0x0133 },
-      { 0x0138, 0x0138 }, { 0x013F, 0x0142 }, { 0x0144, 0x0144 },
-      { 0x0148, 0x014B }, { 0x014D, 0x014D }, { 0x0152, 0x0153 },
-      { 0x0166, 0x0167 }, { 0x016B, 0x016B }, { 0x01CE, 0x01CE },
-      { 0x01D0, 0x01D0 }, { 0x01D2, 0x01D2 }, { 0x01D4, 0x01D4 },
-      { 0x01D6, 0x01D6 }, { 0x01D8, 0x01D8 }, { 0x01DA, 0x01DA },
-      { 0x01DC, 0x01DC }, { 0x0251, 0x0251 }, { 0x0261, 0x0261 },
-      { 0x02C4, 0x02C4 }, { 0x02C7, 0x02C7 }, { 0x02C9, 0x02CB },
-      { 0x02CD, 0x02CD }, { 0x02D0, 0x02D0 }, { 0x02D8, 0x02DB },
-      { 0x02DD, 0x02DD }, { 0x02DF, 0x02DF }, { 0x0391, 0x03A1 },
-      { 0x03A3, 0x03A9 }, { 0x03B1, 0x03C1 }, { 0x03C3, 0x03C9 },
-      { 0x0401, 0x0401 }, { 0x0410, 0x044F }, { 0x0451, 0x0451 },
-      { 0x2010, 0x2010 }, { 0x2013, 0x2016 }, { 0x2018, 0x2019 },
-      { 0x201C, 0x201D }, { 0x2020, 0x2022 }, { 0x2024, 0x2027 },
-      { 0x2030, 0x2030 }, { 0x2032, 0x2033 }, { 0x2035, 0x2035 },
-      { 0x203B, 0x203B }, { 0x203E, 0x203E }, { 0x2074, 0x2074 },
-      { 0x207F, 0x207F }, { 0x2081, 0x2084 }, { 0x20AC, 0x20AC },
-      { 0x2103, 0x2103 }, { 0x2105, 0x2105 }, { 0x2109, 0x2109 },
-      { 0x2113, 0x2113 }, { 0x2116, 0x2116 }, { 0x2121, 0x2122 },
-      { 0x2126, 0x2126 }, { 0x212B, 0x212B }, { 0x2153, 0x2154 },
-      { 0x215B, 0x215E }, { 0x2160, 0x216B }, { 0x2170, 0x2179 },
-      { 0x2190, 0x2199 }, { 0x21B8, 0x21B9 }, { 0x21D2, 0x21D2 },
-      { 0x21D4, 0x21D4 }, { 0x21E7, 0x21E7 }, { 0x2200, 0x2200 },
-      { 0x2202, 0x2203 }, { 0x2207, 0x2208 }, { 0x220B, 0x220B },
-      { 0x220F, 0x220F }, { 0x2211, 0x2211 }, { 0x2215, 0x2215 },
-      { 0x221A, 0x221A }, { 0x221D, 0x2220 }, { 0x2223, 0x2223 },
-      { 0x2225, 0x2225 }, { 0x2227, 0x222C }, { 0x222E, 0x222E },
-      { 0x2234, 0x2237 }, { 0x223C, 0x223D }, { 0x2248, 0x2248 },
-      { 0x224C, 0x224C }, { 0x2252, 0x2252 }, { 0x2260, 0x2261 },
-      { 0x2264, 0x2267 }, { 0x226A, 0x226B }, { 0x226E, 0x226F },
-      { 0x2282, 0x2283 }, { 0x2286, 0x2287 }, { 0x2295, 0x2295 },
-      { 0x2299, 0x2299 }, { 0x22A5, 0x22A5 }, { 0x22BF, 0x22BF },
-      { 0x2312, 0x2312 }, { 0x2460, 0x24E9 }, { 0x24EB, 0x254B },
-      { 0x2550, 0x2573 }, { 0x2580, 0x258F }, { 0x2592, 0x2595 },
-      { 0x25A0, 0x25A1 }, { 0x25A3, 0x25A9 }, { 0x25B2, 0x25B3 },
-      { 0x25B6, 0x25B7 }, { 0x25BC, 0x25BD }, { 0x25C0, 0x25C1 },
-      { 0x25C6, 0x25C8 }, { 0x25CB, 0x25CB }, { 0x25CE, 0x25D1 },
-      { 0x25E2, 0x25E5 }, { 0x25EF, 0x25EF }, { 0x2605, 0x2606 },
-      { 0x2609, 0x2609 }, { 0x260E, 0x260F }, { 0x2614, 0x2615 },
-      { 0x261C, 0x261C }, { 0x261E, 0x261E }, { 0x2640, 0x2640 },
-      { 0x2642, 0x2642 }, { 0x2660, 0x2661 }, { 0x2663, 0x2665 },
-      { 0x2667, 0x266A }, { 0x266C, 0x266D }, { 0x266F, 0x266F },
-      { 0x273D, 0x273D }, { 0x2776, 0x277F }, { 0xE000, 0xF8FF },
-      { 0xFFFD, 0xFFFD }, { 0xF0000, 0xFFFFD }, { 0x100000, 0x10FFFD }
-    };
-
-    /* binary search in table of non-spacing characters */
-    if (bisearch(ucs, ambiguous,
-        sizeof(ambiguous) / sizeof(struct interval) - 1))
-        return 2;
+    const __m128i bytes = _mm_loadu_si128((const __m128i*)s);
+    /* signed compare, bytes >= 0x80 are negative */
+    const __m128i printable = _mm_and_si128(
+        _mm_cmpgt_epi8(bytes, _mm_set1_epi8(0x1F)),
+        _mm_cmplt_epi8(bytes, _mm_set1_epi8(0x7F)));
+    const unsigned others = ~(unsigned)_mm_movemask_epi8(printable) & 0xFFFF;
+    unsigned count = 0;
+    if (!others)
+        return 16;
+    while (!(others & (1u << count)))
+        ++count;
+    return count;
+}
+
+/* the same for the next 8 utf16 units, 8 if all are */
+static unsigned printable_units(const char16_t* s)
+{
+    const __m128i units = _mm_loadu_si128((const __m128i*)s);
+    const __m128i printable = _mm_and_si128(
+        _mm_cmpgt_epi16(units, _mm_set1_epi16(0x1F)),
+        _mm_cmplt_epi16(units, _mm_set1_epi16(0x7F)));
+    const unsigned others = ~(unsigned)_mm_movemask_epi8(printable) & 0xFFFF;
+    unsigned count = 0;
+    if (!others)
+        return 8;
+    while (!(others & (1u << count)))
+        ++count;
+    return count / 2;
+}
+#endif
+
+/* one code point from s[0 .. n), returns the units consumed, at least 1 */
+static size_t decode_utf8(const unsigned char* s, size_t n, char32_t* cp)
+{
+    size_t length, k;
+    char32_t c = s[0];
+
+    if (c < 0x80) {
+        *cp = c;
+        return 1;
+    }
+    if (c >= 0xC2 && c <= 0xDF) {
+        length = 2;
+        c &= 0x1F;
+    }
+    else if (c >= 0xE0 && c <= 0xEF) {
+        length = 3;
+        c &= 0x0F;
+    }
+    else if (c >= 0xF0 && c <= 0xF4) {
+        length = 4;
+        c &= 0x07;
+    }
+    else {
+        *cp = 0xFFFD;
+        return 1;
+    }
 
-    return dbj_wcwidth(ucs);
+    if (n < length) {
+        *cp = 0xFFFD;
+        return 1;
+    }
+    for (k = 1; k < length; ++k) {
+        if ((s[k] & 0xC0) != 0x80) {
+            *cp = 0xFFFD;
+            return 1;
+        }
+        c = (c << 6) | (s[k] & 0x3F);
+    }
+    /* overlong, surrogate or beyond U+10FFFF */
+    if ((length == 3 && (c < 0x800 || (c >= 0xD800 && c <= 0xDFFF)))
+        || (length == 4 && (c < 0x10000 || c > 0x10FFFF))) {
+        *cp = 0xFFFD;
+        return 1;
+    }
+    *cp = c;
+    return length;
 }
-int dbj_wcswidth_cjk(const wchar_t* pwcs, size_t n)
+
+int dbj_wcswidth_utf8_ex(const char* pstr, size_t n, int profile)
 {
+    const unsigned char* s = (const unsigned char*)pstr;
+    const unsigned flags = flags_of(profile);
     int w, width = 0;
+    size_t i = 0;
+    char32_t cp;
 
-    for (; *pwcs && n-- > 0; pwcs++)
-        if ((w = dbj_wcwidth_cjk(*pwcs)) < 0)
+    while (i < n) {
+#ifdef DBJ_WCWIDTH_SSE2
+        while (n - i >= 16) {
+            const unsigned run = printable_bytes(pstr + i);
+            i += run;
+            width += (int)run;
+            if (run < 16)
+                break;
+        }
+        if (i >= n)
+            break;
+#endif
+        if (s[i] >= 0x20 && s[i] < 0x7F) {
+            ++i;
+            ++width;
+            continue;
+        }
+        if (!s[i])
+            break;
+        i += decode_utf8(s + i, n - i, &cp);
+        if ((w = width_of(cp, flags)) < 0)
             return -1;
-        else
-            width += w;
+        width += w;
+    }
 
     return width;
 }
 
-#endif // 0
+int dbj_wcswidth_utf16_ex(const char16_t* pstr, size_t n, int profile)
+{
+    const unsigned flags = flags_of(profile);
+    int w, width = 0;
+    size_t i = 0;
+    char32_t cp;
+
+    while (i < n) {
+#ifdef DBJ_WCWIDTH_SSE2
+        while (n - i >= 8) {
+            const unsigned run = printable_units(pstr + i);
+            i += run;
+            width += (int)run;
+            if (run < 8)
+                break;
+        }
+        if (i >= n)
+            break;
+#endif
+        cp = pstr[i++];
+        if (cp >= 0x20 && cp < 0x7F) {
+            ++width;
+            continue;
+        }
+        if (!cp)
+            break;
+        if (cp >= 0xD800 && cp <= 0xDBFF && i < n && pstr[i] >= 0xDC00 && pstr[i] <= 0xDFFF)
+            cp = ((cp - 0xD800) << 10) + (pstr[i++] - 0xDC00) + 0x10000;
+        if ((w = width_of(cp, flags)) < 0)
+            return -1;
+        width += w;
+    }
+
+    return width;
+}
+
+int dbj_wcswidth_utf8(const char* pstr, size_t n)
+{
+    return dbj_wcswidth_utf8_ex(pstr, n, DBJ_WCWIDTH_PROFILE_DEFAULT);
+}
+
+int dbj_wcswidth_utf16(const char16_t* pstr, size_t n)
+{
+    return dbj_wcswidth_utf16_ex(pstr, n, DBJ_WCWIDTH_PROFILE_DEFAULT);
+}